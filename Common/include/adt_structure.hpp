@@ -4,7 +4,7 @@
  *        alternating digital tree (ADT).
  *        The subroutines and functions are in the <i>adt_structure.cpp</i> file.
  * \author E. van der Weide
- * \version 4.1.3 "Cardinal"
+ * \version 4.2.0 "Cardinal"
  *
  * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
  *                      Dr. Thomas D. Economon (economon@stanford.edu).
@@ -49,7 +49,7 @@ using namespace std;
  * \class su2_adtComparePointClass
  * \brief  Functor, used for the sorting of the points when building an ADT.
  * \author E. van der Weide
- * \version 4.1.3 "Cardinal"
+ * \version 4.2.0 "Cardinal"
  */
 class su2_adtComparePointClass {
 private:
@@ -90,7 +90,7 @@ private:
  * \class su2_adtNodeClass
  * \brief  Class for storing the information needed in a node of an ADT.
  * \author E. van der Weide
- * \version 4.1.3 "Cardinal"
+ * \version 4.2.0 "Cardinal"
  */
 class su2_adtNodeClass {
 public:
@@ -140,7 +140,7 @@ private:
  * \class su2_adtBaseClass
  * \brief  Base class for storing an ADT in an arbitrary number of dimensions.
  * \author E. van der Weide
- * \version 4.1.3 "Cardinal"
+ * \version 4.2.0 "Cardinal"
  */
 class su2_adtBaseClass {
 protected:
@@ -199,7 +199,7 @@ private:
  * \class su2_adtPointsOnlyClass
  * \brief  Class for storing an ADT of only points in an arbitrary number of dimensions.
  * \author E. van der Weide
- * \version 4.1.3 "Cardinal"
+ * \version 4.2.0 "Cardinal"
  */
 class su2_adtPointsOnlyClass : public su2_adtBaseClass {
 private:
@@ -219,11 +219,14 @@ public:
    * \param[in] nPoints Number of local points to be stored in the ADT.
    * \param[in] coor    Coordinates of the local points.
    * \param[in] pointID Local point IDs of the local points. 
+   * \param[in] globalTree Whether the points of all ranks are gathered in the ADT,
+                           otherwise only the local points are stored.
    */
   su2_adtPointsOnlyClass(unsigned short      nDim,
                          unsigned long       nPoints,
                          const su2double     *coor,
-                         const unsigned long *pointID);
+                         const unsigned long *pointID,
+                         const bool          globalTree = true);
 
   /*!
    * \brief Destructor of the class. Nothing to be done.
@@ -259,4 +262,115 @@ private:
   su2_adtPointsOnlyClass& operator=(const su2_adtPointsOnlyClass &);
 };
 
+/*! 
+ * \class su2_adtElemClass
+ * \brief  Class for storing an ADT of surface elements (line segments, triangles
+ *         and quadrilaterals) in 2D or 3D, which is used to determine the minimum
+ *         distance of a point to the surface.
+ * \version 4.2.0 "Cardinal"
+ */
+class su2_adtElemClass : public su2_adtBaseClass {
+private:
+  unsigned short nDim;  /*!< \brief Number of spatial dimensions of the elements. */
+
+  vector<vector<unsigned long> > frontLeaves;    /*!< \brief Vectors used in the tree traversal, one per thread. */
+  vector<vector<unsigned long> > frontLeavesNew; /*!< \brief Vectors used in the tree traversal, one per thread. */
+
+  vector<su2double>      coorPoints;    /*!< \brief Vector, which contains the coordinates of the nodes
+                                                    of the elements. */
+  vector<unsigned short> elemVTK_Type;  /*!< \brief Vector, which contains the VTK type of the elements. */
+  vector<unsigned long>  nDOFsPerElem;  /*!< \brief Vector, which contains the offsets of the elements
+                                                    in elemConns, cumulative storage format. */
+  vector<unsigned long>  elemConns;     /*!< \brief Vector, which contains the connectivities of the
+                                                    elements, i.e. indices in coorPoints/nDim. */
+  vector<su2double>      BBoxCoor;      /*!< \brief Vector, which contains the bounding boxes of the
+                                                    elements, the minimum and maximum coordinates. */
+public:
+  /*!
+   * \brief Constructor of the class. Only the given local elements are stored,
+   *        no communication takes place.
+   * \param[in] val_nDim     Number of spatial dimensions of the problem.
+   * \param[in] coor         Coordinates of the nodes of the elements.
+   * \param[in] elemConn     Connectivities of the elements, indices of the nodes in coor.
+   * \param[in] elemVTK      VTK type of the elements, LINE, TRIANGLE or QUADRILATERAL.
+   */
+  su2_adtElemClass(unsigned short               val_nDim,
+                   const vector<su2double>      &coor,
+                   const vector<unsigned long>  &elemConn,
+                   const vector<unsigned short> &elemVTK);
+
+  /*!
+   * \brief Destructor of the class. Nothing to be done.
+   */
+  ~su2_adtElemClass();
+
+  /*!
+   * \brief Function, which determines the bounding box of all the elements in the ADT.
+   * \param[out] xMin  Minimum coordinates of the bounding box.
+   * \param[out] xMax  Maximum coordinates of the bounding box.
+   */
+  void GetBoundingBox(su2double *xMin,
+                      su2double *xMax) const;
+
+  /*!
+   * \brief Function, which determines the element in the ADT nearest to the given
+   *        coordinate, i.e. the minimum distance to the surface. It can be called
+   *        by several threads at the same time.
+   * \param[in]  coor    Coordinate for which the nearest element must be determined.
+   * \param[out] dist    Distance to the nearest element in the ADT.
+   * \param[out] elemID  ID of the nearest element in the ADT.
+   */
+  void DetermineNearestElement(const su2double *coor,
+                               su2double       &dist,
+                               unsigned long   &elemID);
+private:
+  /*!
+   * \brief Function, which computes the distance squared of a point to an element.
+   * \param[in] coor    Coordinate of the point.
+   * \param[in] elemID  ID of the element.
+   * \return Distance squared of the point to the element.
+   */
+  su2double Dist2ToElement(const su2double *coor,
+                           const unsigned long elemID) const;
+
+  /*!
+   * \brief Function, which computes the distance squared of a point to a line segment.
+   * \param[in] coor  Coordinate of the point.
+   * \param[in] x0    Coordinates of the first node of the segment.
+   * \param[in] x1    Coordinates of the second node of the segment.
+   * \return Distance squared of the point to the segment.
+   */
+  su2double Dist2ToSegment(const su2double *coor,
+                           const su2double *x0,
+                           const su2double *x1) const;
+
+  /*!
+   * \brief Function, which computes the distance squared of a point to a triangle in 3D.
+   * \param[in] coor  Coordinate of the point.
+   * \param[in] x0    Coordinates of the first node of the triangle.
+   * \param[in] x1    Coordinates of the second node of the triangle.
+   * \param[in] x2    Coordinates of the third node of the triangle.
+   * \return Distance squared of the point to the triangle.
+   */
+  su2double Dist2ToTriangle(const su2double *coor,
+                            const su2double *x0,
+                            const su2double *x1,
+                            const su2double *x2) const;
+
+  /*!
+   * \brief Default constructor of the class, disabled.
+   */
+  su2_adtElemClass();
+
+  /*!
+   * \brief Copy constructor of the class, disabled.
+   */
+  su2_adtElemClass(const su2_adtElemClass &);
+
+  /*!
+   * \brief Assignment operator, disabled.
+   */
+  su2_adtElemClass& operator=(const su2_adtElemClass &);
+};
+
 #include "adt_structure.inl"
@@ -2,7 +2,7 @@
  * \file adt_structure.inl
  * \brief In-Line subroutines of the <i>adt_structure.hpp</i> file.
  * \author E. van der Weide
- * \version 4.1.3 "Cardinal"
+ * \version 4.2.0 "Cardinal"
  *
  * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
  *                      Dr. Thomas D. Economon (economon@stanford.edu).
@@ -53,3 +53,5 @@ inline su2_adtBaseClass::~su2_adtBaseClass(){}
 inline bool su2_adtBaseClass::IsEmpty(void) const {return isEmpty;}
 
 inline su2_adtPointsOnlyClass::~su2_adtPointsOnlyClass(){}
+
+inline su2_adtElemClass::~su2_adtElemClass(){}
@@ -43,6 +43,7 @@
 #include <stdlib.h>
 #include <cmath>
 #include <map>
+#include <ctime>
 #include <assert.h>
 
 #include "./option_structure.hpp"
@@ -112,6 +113,8 @@ private:
   su2double Damp_Engine_Exhaust;	/*!< \brief Damping factor for the engine exhaust. */
   su2double Damp_Res_Restric,	/*!< \brief Damping factor for the residual restriction. */
 	Damp_Correc_Prolong; /*!< \brief Damping factor for the correction prolongation. */
+  bool MG_Agglomeration_Reuse;  /*!< \brief Reuse the agglomeration of the coarse levels of a previous run. */
+  string MG_Agglomeration_FileName;  /*!< \brief Agglomeration file of the coarse levels. */
 	su2double Position_Plane; /*!< \brief Position of the Near-Field (y coordinate 2D, and z coordinate 3D). */
 	su2double WeightCd; /*!< \brief Weight of the drag coefficient. */
 	unsigned short Unsteady_Simulation;	/*!< \brief Steady or unsteady (time stepping or dual time stepping) computation. */
@@ -417,6 +420,11 @@ private:
   unsigned long Deform_Linear_Solver_Iter;   /*!< \brief Max iterations of the linear solver for the implicit formulation. */
 	unsigned long Linear_Solver_Iter_FSI_Struc;		/*!< \brief Max iterations of the linear solver for FSI applications and structural solver. */
 	unsigned long Linear_Solver_Restart_Frequency;   /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  bool Linear_Solver_Mixed_Precision;   /*!< \brief Store the Jacobian and the ILU preconditioner in single precision. */
+  unsigned short AMG_Levels,    /*!< \brief Maximum number of levels of the AMG preconditioner. */
+  Kind_AMG_Smoother,            /*!< \brief Smoother of the AMG preconditioner. */
+  AMG_PreSmooth,                /*!< \brief Number of pre-smoothing sweeps of the AMG preconditioner. */
+  AMG_PostSmooth;               /*!< \brief Number of post-smoothing sweeps of the AMG preconditioner. */
   su2double Roe_Kappa;		/*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Flow;		/*!< \brief Relaxation coefficient of the linear solver mean flow. */
   su2double Relaxation_Factor_Turb;		/*!< \brief Relaxation coefficient of the linear solver turbulence. */
@@ -469,7 +477,8 @@ private:
 	unsigned long Wrt_Sol_Freq,	/*!< \brief Writing solution frequency. */
 	Wrt_Sol_Freq_DualTime,	/*!< \brief Writing solution frequency for Dual Time. */
 	Wrt_Con_Freq,				/*!< \brief Writing convergence history frequency. */
-	Wrt_Con_Freq_DualTime;				/*!< \brief Writing convergence history frequency. */
+	Wrt_Con_Freq_DualTime,				/*!< \brief Writing convergence history frequency. */
+  FastOutput_Freq;        /*!< \brief Writing frequency of the fast output (surface stream and probes). */
 	bool Wrt_Unsteady;  /*!< \brief Write unsteady data adding header and prefix. */
   bool Wrt_Dynamic;  		/*!< \brief Write dynamic data adding header and prefix. */
 	bool LowFidelitySim;  /*!< \brief Compute a low fidelity simulation. */
@@ -479,6 +488,7 @@ private:
 	nMarker_Designing,					/*!< \brief Number of markers for the objective function. */
 	nMarker_GeoEval,					/*!< \brief Number of markers for the objective function. */
 	nMarker_Plotting,					/*!< \brief Number of markers to plot. */
+  nMarker_FastOutput,       /*!< \brief Number of markers in the fast output surface stream. */
 	nMarker_FSIinterface,					/*!< \brief Number of markers in the FSI interface. */
   nMarker_Moving,               /*!< \brief Number of markers in motion (DEFORMING, MOVING_WALL, or FLUID_STRUCTURE). */
 	nMarker_DV;               /*!< \brief Number of markers affected by the design variables. */
@@ -486,6 +496,7 @@ private:
   *Marker_Designing,         /*!< \brief Markers to plot. */
   *Marker_GeoEval,         /*!< \brief Markers to plot. */
   *Marker_Plotting,          /*!< \brief Markers to plot. */
+  *Marker_FastOutput,        /*!< \brief Markers in the fast output surface stream. */
   *Marker_FSIinterface,          /*!< \brief Markers in the FSI interface. */
   *Marker_Moving,            /*!< \brief Markers in motion (DEFORMING, MOVING_WALL, or FLUID_STRUCTURE). */
   *Marker_DV;            /*!< \brief Markers affected by the design variables. */
@@ -511,6 +522,7 @@ private:
 	unsigned short Analytical_Surface;	/*!< \brief Information about the analytical definition of the surface for grid adaptation. */
 	unsigned short Axis_Orientation;	/*!< \brief Axis orientation. */
 	unsigned short Mesh_FileFormat;	/*!< \brief Mesh input format. */
+	unsigned short Mesh_Out_FileFormat;	/*!< \brief Mesh output format. */
 	unsigned short Output_FileFormat;	/*!< \brief Format of the output files. */
   bool CFL_Adapt;      /*!< \brief Adaptive CFL number. */
 	su2double RefAreaCoeff,		/*!< \brief Reference area for coefficient computation. */
@@ -527,6 +539,15 @@ private:
   unsigned short nRefOriginMoment_X,    /*!< \brief Number of X-coordinate moment computation origins. */
 	nRefOriginMoment_Y,           /*!< \brief Number of Y-coordinate moment computation origins. */
 	nRefOriginMoment_Z;           /*!< \brief Number of Z-coordinate moment computation origins. */
+  su2double *Probe_Coords,      /*!< \brief Coordinates of the probes of the fast output (x, y, z per probe). */
+  *Plane_Sample;                /*!< \brief Sampling planes of the fast output (origin and normal per plane). */
+  unsigned short nProbe_Coords, /*!< \brief Number of values in the coordinates of the probes. */
+  nPlane_Sample,                /*!< \brief Number of values in the definition of the sampling planes. */
+  nRestart_Compression_Tol;     /*!< \brief Number of error tolerances of the compressed restart. */
+  su2double *Restart_Compression_Tol; /*!< \brief Absolute error tolerances of the fields of the compressed restart (0 is lossless). */
+  passivedouble Phase_Time[N_TIMING_PHASES], /*!< \brief Wall time spent in each phase since the last reset. */
+  Phase_Start;                  /*!< \brief Wall time at the start of the current phase. */
+  unsigned short Current_Phase; /*!< \brief Phase of the iteration being timed. */
 	string Mesh_FileName,			/*!< \brief Mesh input file. */
 	Mesh_Out_FileName,				/*!< \brief Mesh output file. */
 	Solution_FlowFileName,			/*!< \brief Flow solution input file. */
@@ -535,6 +556,7 @@ private:
 	Solution_FEMFileName,			/*!< \brief Solution input file for structural problem. */
   Solution_AdjFEMFileName,     /*!< \brief Adjoint solution input file for structural problem. */
 	Flow_FileName,					/*!< \brief Flow variables output file. */
+  FastOutput_FileName,    /*!< \brief Fast output files (w/o extension). */
 	Structure_FileName,					/*!< \brief Structure variables output file. */
 	SurfStructure_FileName,					/*!< \brief Surface structure variables output file. */
   AdjStructure_FileName,         /*!< \brief Structure variables output file. */
@@ -546,6 +568,7 @@ private:
 	AdjWave_FileName,					/*!< \brief Adjoint wave variables output file. */
 	Residual_FileName,				/*!< \brief Residual variables output file. */
 	Conv_FileName,					/*!< \brief Convergence history output file. */
+  Timing_FileName,        /*!< \brief History with the wall time of the phases of the iterations. */
   Breakdown_FileName,			    /*!< \brief Breakdown output file. */
   Conv_FileName_FSI,					/*!< \brief Convergence history output file. */
   Restart_FlowFileName,			/*!< \brief Restart file for flow variables. */
@@ -563,6 +586,10 @@ private:
   SurfSens_FileName,			/*!< \brief Output file for the sensitivity on the surface (discrete adjoint). */
   VolSens_FileName;			/*!< \brief Output file for the sensitivity in the volume (discrete adjoint). */
 	bool Low_MemoryOutput,      /*!< \brief Write a volume solution file */
+  Wrt_Binary_Restart,         /*!< \brief Write the restart files in binary format */
+  Wrt_Async_Output,           /*!< \brief Write the rank-local output files in the background */
+  Wrt_Compressed_Restart,     /*!< \brief Write the restart files in the compressed binary format */
+  Wrt_Timing_History,         /*!< \brief Write the history with the wall time of the phases of the iterations */
   Wrt_Vol_Sol,                /*!< \brief Write a volume solution file */
 	Wrt_Srf_Sol,                /*!< \brief Write a surface solution file */
 	Wrt_Csv_Sol,                /*!< \brief Write a surface comma-separated values solution file */
@@ -722,6 +749,10 @@ private:
   Gust_Begin_Time,            /*!< \brief Time at which to begin the gust. */
   Gust_Begin_Loc;             /*!< \brief Location at which the gust begins. */
   long Visualize_CV; /*!< \brief Node number for the CV to be visualized */
+  unsigned short Kind_Point_Ordering; /*!< \brief Renumbering of the points of the grid. */
+  bool Edge_Coloring;          /*!< \brief Build a coloring of the edges for conflict-free parallel loops. */
+  unsigned long Edge_Coloring_GroupSize; /*!< \brief Number of consecutive edges colored together. */
+  bool Edge_Block_Numerics;    /*!< \brief Compute the convective fluxes of blocks of edges at once. */
   bool ExtraOutput;
   bool DeadLoad; 		/*!< Application of dead loads to the FE analysis */
   bool PseudoStatic;    /*!< Application of dead loads to the FE analysis */
@@ -778,12 +809,15 @@ private:
   *default_grid_fix,          /*!< \brief Default fixed grid (non-deforming region) array for the COption class. */
   *default_inc_crit;          /*!< \brief Default incremental criteria array for the COption class. */
 
-  bool OneShot, OneShotConstraint, LineSearch, SecondOrder;
+  bool OneShot, OneShotConstraint, LineSearch, SecondOrder, HelmholtzStructured;
   su2double OneShotStepSize, OneShotAlpha, OneShotBeta, VolumeConstraint, ConstraintStart, FDStep, StressConstraint, HelmholtzFactor, StepTolerance;
-  unsigned long OneShotStop, OneShotStart, SearchCounterMax;
-  unsigned short ConstraintNum;
+  su2double HelmholtzLinSolverError;
+  unsigned long OneShotStop, OneShotStart, SearchCounterMax, HelmholtzLinSolverIter;
+  unsigned short Kind_HelmholtzLinSolver_Prec;
+  unsigned short ConstraintNum, OneShotLBFGSMemory;
   su2double* ConstraintFactor;
   su2double Emin,Penal;
+  bool FEA_StiffnessCache;
   unsigned long NElemx,NElemy;
 
   
@@ -2444,6 +2478,139 @@ public:
 	 * \return <code>TRUE</code> means that a volume solution file will be written.
 	 */
   bool GetLow_MemoryOutput(void);
+  
+  /*!
+	 * \brief Get information about the format of the restart files.
+	 * \return <code>TRUE</code> means that the restart files are written in binary format.
+	 */
+  bool GetWrt_Binary_Restart(void);
+  
+  /*!
+	 * \brief Get information about the asynchronous output.
+	 * \return <code>TRUE</code> means that the rank-local output files are written in the background.
+	 */
+  bool GetWrt_Async_Output(void);
+  
+  /*!
+	 * \brief Get information about the compression of the restart files.
+	 * \return <code>TRUE</code> means that the restart files are written in the compressed binary format.
+	 */
+  bool GetWrt_Compressed_Restart(void);
+  
+  /*!
+	 * \brief Get the error tolerance of a field of the compressed restart files.
+	 * \param[in] val_field - Index of the field, after the coordinates.
+	 * \return Absolute error tolerance of the field, 0 if it is stored without loss.
+	 */
+  su2double GetRestart_Compression_Tol(unsigned short val_field);
+  
+  /*!
+	 * \brief Get information about the timing history.
+	 * \return <code>TRUE</code> means that the wall time of the phases of the iterations is measured and written.
+	 */
+  bool GetWrt_Timing_History(void);
+  
+  /*!
+	 * \brief Get the name of the timing history file.
+	 * \return Name of the timing history file (w/o extension).
+	 */
+  string GetTiming_FileName(void);
+  
+  /*!
+	 * \brief Start a phase of the iteration, the time since the last change of phase is added to the current phase.
+   *        It does nothing inside the OpenMP parallel regions or without timing history.
+	 * \param[in] val_phase - Phase that starts (ENUM_TIMING_PHASE).
+	 * \return Phase that was being timed, to be given back to Stop_Phase.
+	 */
+  unsigned short Start_Phase(unsigned short val_phase);
+  
+  /*!
+	 * \brief End a phase of the iteration and go back to the previous phase.
+	 * \param[in] val_previous - Phase returned by Start_Phase.
+	 */
+  void Stop_Phase(unsigned short val_previous);
+  
+  /*!
+	 * \brief Get the wall time spent in a phase since the last reset (up to the last change of phase).
+	 * \param[in] val_phase - Phase (ENUM_TIMING_PHASE).
+	 * \return Wall time of the phase.
+	 */
+  passivedouble GetPhase_Time(unsigned short val_phase);
+  
+  /*!
+	 * \brief Set the time of all the phases to zero, the current phase starts again.
+	 */
+  void Reset_Phase_Time(void);
+  
+  /*!
+	 * \brief Wall clock used for the timing of the phases.
+	 * \return Wall time in seconds.
+	 */
+  passivedouble GetWall_Time(void);
+  
+  /*!
+	 * \brief Get information about the fast output (surface stream, probes and sampling planes).
+	 * \return <code>TRUE</code> if any marker, probe or plane of the fast output has been defined.
+	 */
+  bool GetFastOutput(void);
+  
+  /*!
+	 * \brief Get the frequency of the fast output.
+	 * \return The fast output is written every <i>FastOutput_Freq</i> iterations.
+	 */
+  unsigned long GetFastOutput_Freq(void);
+  
+  /*!
+	 * \brief Get the name of the fast output files.
+	 * \return Name of the fast output files (w/o extension).
+	 */
+  string GetFastOutput_FileName(void);
+  
+  /*!
+	 * \brief Get the number of markers of the fast output surface stream.
+	 * \return Number of markers of the fast output.
+	 */
+  unsigned short GetnMarker_FastOutput(void);
+  
+  /*!
+	 * \brief Get the name of a marker of the fast output surface stream.
+	 * \param[in] val_marker - Index of the marker in the list of the fast output.
+	 * \return Name of the marker.
+	 */
+  string GetMarker_FastOutput(unsigned short val_marker);
+  
+  /*!
+	 * \brief Get the number of probes of the fast output.
+	 * \return Number of probes.
+	 */
+  unsigned short GetnProbe(void);
+  
+  /*!
+	 * \brief Get the coordinates of a probe of the fast output.
+	 * \param[in] val_probe - Index of the probe.
+	 * \return Coordinates (x, y, z) of the probe.
+	 */
+  su2double *GetProbe_Coord(unsigned short val_probe);
+  
+  /*!
+	 * \brief Get the number of sampling planes of the fast output.
+	 * \return Number of sampling planes.
+	 */
+  unsigned short GetnPlane_Sample(void);
+  
+  /*!
+	 * \brief Get the origin of a sampling plane of the fast output.
+	 * \param[in] val_plane - Index of the plane.
+	 * \return Coordinates (x, y, z) of a point of the plane.
+	 */
+  su2double *GetPlane_Sample_Origin(unsigned short val_plane);
+  
+  /*!
+	 * \brief Get the normal of a sampling plane of the fast output.
+	 * \param[in] val_plane - Index of the plane.
+	 * \return Normal vector (x, y, z) of the plane.
+	 */
+  su2double *GetPlane_Sample_Normal(unsigned short val_plane);
 
 	/*!
 	 * \brief Get information about writing a surface solution file.
@@ -2979,6 +3146,36 @@ public:
    * \return Restart frequency of the linear solver for the implicit formulation.
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void);
+  
+  /*!
+   * \brief Get if the Jacobian and the ILU preconditioner are stored in single precision.
+   * \return <code>TRUE</code> if the matrix and its factorization are stored as float; otherwise <code>FALSE</code>.
+   */
+  bool GetLinear_Solver_Mixed_Precision(void);
+  
+  /*!
+   * \brief Get the maximum number of levels of the AMG preconditioner.
+   * \return Maximum number of levels, including the fine level.
+   */
+  unsigned short GetAMG_Levels(void);
+  
+  /*!
+   * \brief Get the smoother of the AMG preconditioner.
+   * \return Kind of smoother (JACOBI or ILU).
+   */
+  unsigned short GetKind_AMG_Smoother(void);
+  
+  /*!
+   * \brief Get the number of pre-smoothing sweeps of the AMG preconditioner.
+   * \return Number of sweeps before the coarse grid correction.
+   */
+  unsigned short GetAMG_PreSmooth(void);
+  
+  /*!
+   * \brief Get the number of post-smoothing sweeps of the AMG preconditioner.
+   * \return Number of sweeps after the coarse grid correction.
+   */
+  unsigned short GetAMG_PostSmooth(void);
 
 	/*!
 	 * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
@@ -3955,6 +4152,12 @@ public:
 	 */
 	unsigned short GetMesh_FileFormat(void);
 
+	/*!
+	 * \brief Get the format of the output grid.
+	 * \return Format of the output grid.
+	 */
+	unsigned short GetMesh_Out_FileFormat(void);
+
 	/*!
 	 * \brief Get the format of the output solution.
 	 * \return Format of the output solution.
@@ -4734,6 +4937,18 @@ public:
 	 */
 	su2double GetDamp_Correc_Prolong(void);
 
+	/*!
+	 * \brief Check if the agglomeration of the coarse levels is read from (or stored for) another run.
+	 * \return <code>TRUE</code> if the agglomeration is reused; otherwise <code>FALSE</code>.
+	 */
+	bool GetMG_Agglomeration_Reuse(void);
+
+	/*!
+	 * \brief Get the name of the agglomeration file of the coarse levels.
+	 * \return Name of the file, the partition and the level are appended to it.
+	 */
+	string GetMG_Agglomeration_FileName(void);
+
 	/*!
 	 * \brief Value of the position of the Near Field (y coordinate for 2D, and z coordinate for 3D).
 	 * \return Value of the Near Field position.
@@ -5471,6 +5686,30 @@ public:
 	 */
 	long GetVisualize_CV(void);
 
+  /*!
+	 * \brief Get the renumbering of the points of the grid.
+	 * \return Kind of ordering (see ENUM_POINT_ORDERING).
+	 */
+	unsigned short GetKind_Point_Ordering(void);
+  
+  /*!
+	 * \brief Check if a coloring of the edges must be built.
+	 * \return <code>TRUE</code> if the edges are colored; otherwise <code>FALSE</code>.
+	 */
+	bool GetEdge_Coloring(void);
+  
+  /*!
+	 * \brief Get the number of consecutive edges that are colored together.
+	 * \return Size of the edge groups.
+	 */
+	unsigned long GetEdge_Coloring_GroupSize(void);
+  
+  /*!
+	 * \brief Check if the convective fluxes are computed for blocks of edges at once.
+	 * \return <code>TRUE</code> if the batched numerics are used; otherwise <code>FALSE</code>.
+	 */
+	bool GetEdge_Block_Numerics(void);
+
   /*!
 	 * \brief Get information about whether to use fixed CL mode.
 	 * \return <code>TRUE</code> if fixed CL mode is active; otherwise <code>FALSE</code>.
@@ -5902,6 +6141,12 @@ public:
 
   unsigned long GetOneShotStart(void);
 
+  /*!
+   * \brief Get the history depth of the limited-memory BFGS update used in the one-shot method.
+   * \return Number of stored (s,y) pairs, 0 if the dense BFGS matrix is used.
+   */
+  unsigned short GetOneShotLBFGSMemory(void);
+
   unsigned long GetSearchCounterMax(void);
 
   unsigned long GetNx(void);
@@ -5909,6 +6154,12 @@ public:
   su2double GetEmin(void);
   su2double GetPenal(void);
 
+  /*!
+   * \brief Check whether the unscaled element stiffness blocks of linear elastic problems are cached.
+   * \return <code>TRUE</code> if the stiffness matrix is reassembled from the cached blocks.
+   */
+  bool GetFEA_StiffnessCache(void);
+
   su2double GetOneShotAlpha(void);
 
   su2double GetOneShotBeta(void);
@@ -5921,6 +6172,30 @@ public:
 
   su2double GetHelmholtzFactor(void);
 
+  /*!
+   * \brief Check whether the structured (NELEMX x NELEMY) Helmholtz filter is used.
+   * \return <code>TRUE</code> for the block-tridiagonal filter; otherwise the unstructured PDE filter is used.
+   */
+  bool GetHelmholtzStructured(void);
+
+  /*!
+   * \brief Get the residual reduction of the linear solve of the unstructured Helmholtz filter.
+   * \return Tolerance of the CG solver.
+   */
+  su2double GetHelmholtzLinSolver_Error(void);
+
+  /*!
+   * \brief Get the maximum number of iterations of the linear solve of the unstructured Helmholtz filter.
+   * \return Maximum number of CG iterations.
+   */
+  unsigned long GetHelmholtzLinSolver_Iter(void);
+  
+  /*!
+   * \brief Get the preconditioner of the linear solve of the unstructured Helmholtz filter.
+   * \return Kind of preconditioner (JACOBI or AMG).
+   */
+  unsigned short GetKind_HelmholtzLinSolver_Prec(void);
+
   bool GetOneShotConstraint(void);
 
   bool GetLineSearch(void);
@@ -605,6 +605,16 @@ inline unsigned long CConfig::GetDeform_Linear_Solver_Iter(void) { return Deform
 
 inline unsigned long CConfig::GetLinear_Solver_Restart_Frequency(void) { return Linear_Solver_Restart_Frequency; }
 
+inline bool CConfig::GetLinear_Solver_Mixed_Precision(void) { return Linear_Solver_Mixed_Precision; }
+
+inline unsigned short CConfig::GetAMG_Levels(void) { return AMG_Levels; }
+
+inline unsigned short CConfig::GetKind_AMG_Smoother(void) { return Kind_AMG_Smoother; }
+
+inline unsigned short CConfig::GetAMG_PreSmooth(void) { return AMG_PreSmooth; }
+
+inline unsigned short CConfig::GetAMG_PostSmooth(void) { return AMG_PostSmooth; }
+
 inline su2double CConfig::GetRelaxation_Factor_Flow(void) { return Relaxation_Factor_Flow; }
 
 inline su2double CConfig::GetRelaxation_Factor_AdjFlow(void) { return Relaxation_Factor_AdjFlow; }
@@ -899,6 +909,8 @@ inline string CConfig::GetMesh_Out_FileName(void) { return Mesh_Out_FileName; }
 
 inline unsigned short CConfig::GetMesh_FileFormat(void) { return Mesh_FileFormat; }
 
+inline unsigned short CConfig::GetMesh_Out_FileFormat(void) { return Mesh_Out_FileFormat; }
+
 inline unsigned short CConfig::GetOutput_FileFormat(void) { return Output_FileFormat; }
 
 inline string CConfig::GetConv_FileName(void) { return Conv_FileName; }
@@ -1005,6 +1017,10 @@ inline su2double CConfig::GetDamp_Res_Restric(void) { return Damp_Res_Restric; }
 
 inline su2double CConfig::GetDamp_Correc_Prolong(void) { return Damp_Correc_Prolong; }
 
+inline bool CConfig::GetMG_Agglomeration_Reuse(void) { return MG_Agglomeration_Reuse; }
+
+inline string CConfig::GetMG_Agglomeration_FileName(void) { return MG_Agglomeration_FileName; }
+
 inline su2double CConfig::GetPosition_Plane(void) { return Position_Plane; }
 
 inline su2double CConfig::GetWeightCd(void) { return WeightCd; }
@@ -1079,6 +1095,45 @@ inline string CConfig::GetMotion_FileName(void) { return Motion_Filename; }
 
 inline bool CConfig::GetLow_MemoryOutput(void) { return Low_MemoryOutput; }
 
+inline bool CConfig::GetWrt_Binary_Restart(void) { return Wrt_Binary_Restart; }
+
+inline bool CConfig::GetWrt_Async_Output(void) { return Wrt_Async_Output; }
+
+inline bool CConfig::GetWrt_Compressed_Restart(void) { return Wrt_Compressed_Restart; }
+
+inline bool CConfig::GetWrt_Timing_History(void) { return Wrt_Timing_History; }
+
+inline string CConfig::GetTiming_FileName(void) { return Timing_FileName; }
+
+inline void CConfig::Stop_Phase(unsigned short val_previous) { Start_Phase(val_previous); }
+
+inline passivedouble CConfig::GetPhase_Time(unsigned short val_phase) { return Phase_Time[val_phase]; }
+
+inline su2double CConfig::GetRestart_Compression_Tol(unsigned short val_field) {
+  if (nRestart_Compression_Tol == 0) return 0.0;
+  return Restart_Compression_Tol[min(val_field, (unsigned short)(nRestart_Compression_Tol-1))];
+}
+
+inline bool CConfig::GetFastOutput(void) { return ((nMarker_FastOutput != 0) || (nProbe_Coords != 0) || (nPlane_Sample != 0)); }
+
+inline unsigned long CConfig::GetFastOutput_Freq(void) { return FastOutput_Freq; }
+
+inline string CConfig::GetFastOutput_FileName(void) { return FastOutput_FileName; }
+
+inline unsigned short CConfig::GetnMarker_FastOutput(void) { return nMarker_FastOutput; }
+
+inline string CConfig::GetMarker_FastOutput(unsigned short val_marker) { return Marker_FastOutput[val_marker]; }
+
+inline unsigned short CConfig::GetnProbe(void) { return nProbe_Coords/3; }
+
+inline su2double *CConfig::GetProbe_Coord(unsigned short val_probe) { return &Probe_Coords[3*val_probe]; }
+
+inline unsigned short CConfig::GetnPlane_Sample(void) { return nPlane_Sample/6; }
+
+inline su2double *CConfig::GetPlane_Sample_Origin(unsigned short val_plane) { return &Plane_Sample[6*val_plane]; }
+
+inline su2double *CConfig::GetPlane_Sample_Normal(unsigned short val_plane) { return &Plane_Sample[6*val_plane+3]; }
+
 inline bool CConfig::GetWrt_Vol_Sol(void) { return Wrt_Vol_Sol; }
 
 inline bool CConfig::GetWrt_Srf_Sol(void) { return Wrt_Srf_Sol; }
@@ -1159,6 +1214,14 @@ inline su2double CConfig::GetFFD_Tol(void) {return FFD_Tol; }
 
 inline long CConfig::GetVisualize_CV(void) {return Visualize_CV; }
 
+inline unsigned short CConfig::GetKind_Point_Ordering(void) { return Kind_Point_Ordering; }
+
+inline bool CConfig::GetEdge_Coloring(void) { return Edge_Coloring; }
+
+inline unsigned long CConfig::GetEdge_Coloring_GroupSize(void) { return Edge_Coloring_GroupSize; }
+
+inline bool CConfig::GetEdge_Block_Numerics(void) { return Edge_Block_Numerics; }
+
 inline bool CConfig::GetFixed_CL_Mode(void) { return Fixed_CL_Mode; }
 
 inline su2double CConfig::GetTarget_CL(void) {return Target_CL; }
@@ -1311,12 +1374,15 @@ inline unsigned long CConfig::GetOneShotStop() {return OneShotStop;}
 
 inline unsigned long CConfig::GetOneShotStart() {return OneShotStart;}
 
+inline unsigned short CConfig::GetOneShotLBFGSMemory() {return OneShotLBFGSMemory;}
+
 inline unsigned long CConfig::GetSearchCounterMax() {return SearchCounterMax;}
 
 inline unsigned long CConfig::GetNx() {return NElemx;}
 inline unsigned long CConfig::GetNy()  {return NElemy;}
 inline su2double CConfig::GetEmin()  {return Emin;}
 inline su2double CConfig::GetPenal()  {return Penal;}
+inline bool CConfig::GetFEA_StiffnessCache()  {return FEA_StiffnessCache;}
 
 inline su2double CConfig::GetOneShotAlpha() {return OneShotAlpha;}
 
@@ -1328,6 +1394,14 @@ inline su2double CConfig::GetStressConstraint() {return StressConstraint;}
 
 inline su2double CConfig::GetHelmholtzFactor() {return HelmholtzFactor;}
 
+inline bool CConfig::GetHelmholtzStructured() {return HelmholtzStructured;}
+
+inline su2double CConfig::GetHelmholtzLinSolver_Error() {return HelmholtzLinSolverError;}
+
+inline unsigned long CConfig::GetHelmholtzLinSolver_Iter() {return HelmholtzLinSolverIter;}
+
+inline unsigned short CConfig::GetKind_HelmholtzLinSolver_Prec() {return Kind_HelmholtzLinSolver_Prec;}
+
 inline su2double CConfig::GetConstraintStart() {return ConstraintStart;}
 
 inline unsigned short CConfig::GetConstraintNum() {return ConstraintNum;}
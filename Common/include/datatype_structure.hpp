@@ -55,6 +55,17 @@
 
 #include "ad_structure.hpp"
 
+/*--- OpenMP is only used with the primitive datatype, the AD and complex types
+ * can not be used in reductions and their tapes are not thread safe. ---*/
+
+#if defined HAVE_OMP && (defined COMPLEX_TYPE || defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+#undef HAVE_OMP
+#endif
+
+#ifdef HAVE_OMP
+#include <omp.h>
+#endif
+
 /*--- This type can be used for (rare) compatiblity cases or for computations that are intended to be (always) passive. ---*/
 
 typedef double passivedouble;
@@ -169,6 +169,7 @@ private:
   unsigned long GlobalIndex;          /*!< \brief Global index in the parallel simulation. */
   unsigned short nNeighbor;           /*!< \brief Number of neighbors. */
   bool Flip_Orientation;              /*!< \brief Flip the orientation of the normal. */
+  bool Contiguous;                    /*!< \brief Coord and Volume point into arrays owned by the geometry. */
 
 public:
 	
@@ -309,6 +310,14 @@ public:
 	 * \param[in] val_coord - Coordinate of the point.		 
 	 */
 	void SetCoord(su2double *val_coord);
+  
+  /*!
+	 * \brief Move the coordinates and the volumes into external (contiguous) storage.
+	 * \param[in] val_coord - Storage for the nDim coordinates of the point.
+	 * \param[in] val_volume - Storage for the volumes of the point (1, or 3 for unsteady problems).
+	 * \param[in] val_nVolume - Number of volumes stored.
+	 */
+	void SetContiguous_Storage(su2double *val_coord, su2double *val_volume, unsigned short val_nVolume);
 	
 	/*! 
 	 * \brief Get the number of elements that compose the control volume.
@@ -760,6 +769,7 @@ private:
 	su2double *Coord_CG;			/*!< \brief Center-of-gravity of the element. */
 	unsigned long *Nodes;		/*!< \brief Vector to store the global nodes of an element. */
 	su2double *Normal;				/*!< \brief Normal al elemento y coordenadas de su centro de gravedad. */
+  bool Contiguous;        /*!< \brief Nodes and Normal point into arrays owned by the geometry. */
 
 public:
 		
@@ -871,6 +881,13 @@ public:
 	 * \param[in] val_face_normal - Vector to add to the normal vector.
 	 */
 	void AddNormal(su2double *val_face_normal);
+  
+  /*!
+	 * \brief Move the nodes and the normal into external (contiguous) storage.
+	 * \param[in] val_nodes - Storage for the two nodes of the edge.
+	 * \param[in] val_normal - Storage for the nDim components of the normal.
+	 */
+	void SetContiguous_Storage(unsigned long *val_nodes, su2double *val_normal);
 	
 	/*! 
 	 * \brief This function does nothing (it comes from a pure virtual function, that implies the 
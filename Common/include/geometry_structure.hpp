@@ -103,6 +103,19 @@ protected:
 	nZone,								/*!< \brief Number of zones in the problem. */
 	nMarker;				/*!< \brief Number of different markers of the mesh. */
   unsigned long Max_GlobalPoint;  /*!< \brief Greater global point in the domain local structure. */
+  su2double *Point_Coord,         /*!< \brief Coordinates of the points, nDim values per point. */
+  *Point_Volume,                  /*!< \brief Volumes of the points, nVolume_Point values per point. */
+  *Edge_Normal;                   /*!< \brief Normals of the edges, nDim values per edge. */
+  unsigned long *Edge_Node,       /*!< \brief Nodes of the edges, two values per edge. */
+  *Point_Neighbor_Ptr,            /*!< \brief Start of the neighbors of each point in Point_Neighbor (CSR format). */
+  *Point_Neighbor,                /*!< \brief Points surrounding each point (CSR format). */
+  *Point_Neighbor_Edge;           /*!< \brief Edge between a point and each of its neighbors (CSR format). */
+  unsigned short nVolume_Point;   /*!< \brief Number of volumes stored per point (1, or 3 for unsteady problems). */
+  unsigned short nEdge_Color;     /*!< \brief Number of colors of the edge groups. */
+  unsigned long Edge_Color_GroupSize, /*!< \brief Number of consecutive edges in a group. */
+  *Edge_Color_Ptr,                /*!< \brief Start of the groups of each color in Edge_Color_Group. */
+  *Edge_Color_Group;              /*!< \brief Groups of edges sorted by color. */
+  unsigned long Coord_Version;    /*!< \brief Number of updates of the coordinates (SetCoord_CG), caches built from them compare it. */
 
 public:
 	unsigned long *nElem_Bound;			/*!< \brief Number of elements of the boundary. */
@@ -201,6 +214,22 @@ public:
 	 * \return Number of edges.
 	 */
 	unsigned long GetnEdge(void);
+  
+  /*!
+   * \brief Get the number of updates of the coordinates, it changes every time the mesh moves or deforms.
+   * \return Version of the coordinates.
+   */
+  unsigned long GetCoord_Version(void);
+  
+  /*!
+   * \brief Halo points of the partition, of the points shared by two ranks only one copy is
+   *        kept (the one of the higher rank), so an element without halo points has a single owner.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] Halo - True for the halo points.
+   * \param[in] val_periodic - Treat the periodic points as the merged output does: keep those of
+   *            the original domain and remove the added ones (collective call).
+   */
+  void GetHalo_Points(CConfig *config, vector<bool> &Halo, bool val_periodic = false);
 
 	/*! 
 	 * \brief Get number of markers.
@@ -341,6 +370,12 @@ public:
 	 */
 	virtual void SetRCM_Ordering(CConfig *config);
   
+  /*!
+	 * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+	 */
+	virtual void SetHilbert_Ordering(CConfig *config);
+  
 	/*!
 	 * \brief A virtual member.
 	 */		
@@ -351,6 +386,93 @@ public:
 	 */
 	void SetEdges(void);
 
+  /*!
+	 * \brief Move the coordinates, volumes, edge nodes and edge normals into contiguous
+	 *        arrays and build the point-to-point adjacency in CSR format. The CPoint and
+	 *        CEdge accessors keep working on the new storage.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void SetContiguous_Storage(CConfig *config);
+  
+  /*!
+	 * \brief Check if the contiguous storage has been built.
+	 */
+	bool GetContiguous_Storage(void);
+  
+  /*!
+	 * \brief Get the coordinates of a point from the contiguous storage.
+	 * \param[in] val_point - Point.
+	 */
+	su2double *GetPoint_Coord(unsigned long val_point);
+  
+  /*!
+	 * \brief Get the volume of a point from the contiguous storage.
+	 * \param[in] val_point - Point.
+	 */
+	su2double GetPoint_Volume(unsigned long val_point);
+  
+  /*!
+	 * \brief Get the two nodes of an edge from the contiguous storage.
+	 * \param[in] val_edge - Edge.
+	 */
+	unsigned long *GetEdge_Nodes(unsigned long val_edge);
+  
+  /*!
+	 * \brief Get the normal of an edge from the contiguous storage.
+	 * \param[in] val_edge - Edge.
+	 */
+	su2double *GetEdge_Normal(unsigned long val_edge);
+  
+  /*!
+	 * \brief Get the position of the first neighbor of a point in the CSR adjacency,
+	 *        the neighbors of val_point are [GetPoint_Neighbor_Ptr(val_point), GetPoint_Neighbor_Ptr(val_point+1)).
+	 * \param[in] val_point - Point.
+	 */
+	unsigned long GetPoint_Neighbor_Ptr(unsigned long val_point);
+  
+  /*!
+	 * \brief Get a neighbor from the CSR adjacency.
+	 * \param[in] val_index - Position in the CSR adjacency.
+	 */
+	unsigned long GetPoint_Neighbor(unsigned long val_index);
+  
+  /*!
+	 * \brief Get the edge to a neighbor from the CSR adjacency.
+	 * \param[in] val_index - Position in the CSR adjacency.
+	 */
+	unsigned long GetPoint_Neighbor_Edge(unsigned long val_index);
+  
+  /*!
+	 * \brief Split the edges in groups of consecutive edges and color the groups,
+	 *        so that the groups of a color do not share any point.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void SetEdge_Coloring(CConfig *config);
+  
+  /*!
+	 * \brief Get the number of colors of the edge groups (0 if the edges are not colored).
+	 */
+	unsigned short GetnEdge_Color(void);
+  
+  /*!
+	 * \brief Get the position of the first group of a color, the groups of val_color
+	 *        are [GetEdge_Color_Ptr(val_color), GetEdge_Color_Ptr(val_color+1)).
+	 * \param[in] val_color - Color.
+	 */
+	unsigned long GetEdge_Color_Ptr(unsigned short val_color);
+  
+  /*!
+	 * \brief Get a group of edges, the group iGroup holds the edges
+	 *        [iGroup*GetEdge_Color_GroupSize(), min((iGroup+1)*GetEdge_Color_GroupSize(), nEdge)).
+	 * \param[in] val_index - Position in the groups sorted by color.
+	 */
+	unsigned long GetEdge_Color_Group(unsigned long val_index);
+  
+  /*!
+	 * \brief Get the number of consecutive edges in a group.
+	 */
+	unsigned long GetEdge_Color_GroupSize(void);
+
 	/*! 
 	 * \brief A virtual member.
 	 */
@@ -1015,6 +1137,17 @@ public:
    * \param[in] val_nZone - Total number of domains in the grid file.
    */
   void Read_SU2_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
+
+  /*!
+   * \brief Reads the geometry of the grid from the binary native format in parallel (for parmetis).
+   *        Every rank only reads its linear part of the points and of the elements, the elements
+   *        are then sent to the ranks owning their points.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_iZone - Domain to be read from the grid file.
+   * \param[in] val_nZone - Total number of domains in the grid file.
+   */
+  void Read_SU2_Binary_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
     
 
   /*!
@@ -1040,7 +1173,9 @@ public:
 			unsigned short &face_second_elem);
 
 	/*! 
-	 * \brief Computes the distance to the nearest no-slip wall for each grid node.
+	 * \brief Computes the distance to the nearest no-slip wall for each grid node. The distance is
+	 *        measured to the wall elements, every rank only stores its own wall elements and the
+	 *        nodes are sent to the ranks whose walls may be nearer.
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	void ComputeWall_Distance(CConfig *config);
@@ -1062,6 +1197,19 @@ public:
 	 */
 	void SetRCM_Ordering(CConfig *config);
   
+  /*!
+	 * \brief Set a renumbering of the domain points along a Hilbert space-filling curve.
+   * \param[in] config - Definition of the particular problem.
+	 */
+	void SetHilbert_Ordering(CConfig *config);
+  
+  /*!
+	 * \brief Renumber the points and update the element and boundary connectivities.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Result - Old index of each new point (the MPI points must stay at the end).
+	 */
+	void SetPoint_Ordering(CConfig *config, vector<unsigned long> &Result);
+  
 	/*!
 	 * \brief Function declaration to avoid partially overridden classes.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -1483,6 +1631,9 @@ public:
  */
 class CMultiGridGeometry : public CGeometry {
 
+  bool *Geometrical_Check;		/*!< \brief Result of the geometrical check of each fine grid point (agglomeration stage only). */
+  short *Point_Marker;		/*!< \brief Physical marker of each fine grid point, -1 if none, -2 if several (agglomeration stage only). */
+
 public:
 
 	/*! 
@@ -1509,6 +1660,50 @@ public:
 	 */	
 	bool SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, CGeometry *fine_grid, CConfig *config);
 
+	/*! 
+	 * \brief Agglomerate the control volumes of the fine grid to build the points of this level.
+	 * \param[in] fine_grid - Geometrical definition of the finer level.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void SetAgglomeration(CGeometry *fine_grid, CConfig *config);
+
+	/*! 
+	 * \brief Read the agglomeration of this level (parent/children topology) stored by a previous run.
+	 * \param[in] fine_grid - Geometrical definition of the finer level.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Level of the multigrid.
+	 * \param[in] iZone - Current zone in the mesh.
+	 * \return <code>TRUE</code> if the stored agglomeration matches the fine grid (on all the ranks) and has been loaded.
+	 */
+	bool Read_Agglomeration(CGeometry *fine_grid, CConfig *config, unsigned short iMesh, unsigned short iZone);
+
+	/*! 
+	 * \brief Physical marker of a fine grid point for the agglomeration.
+	 * \param[in] iPoint - Fine grid point.
+	 * \param[in] fine_grid - Geometrical definition of the finer level.
+	 * \param[in] config - Definition of the particular problem.
+	 * \return Index of the marker of the point, -1 if none, -2 if several (send/receive markers are not counted).
+	 */
+	short GetPoint_Marker(unsigned long iPoint, CGeometry *fine_grid, CConfig *config);
+
+	/*! 
+	 * \brief Checksum of the fine grid identifying a stored agglomeration: edge connectivity,
+	 *        marker tags and boundary conditions, and the physical marker of each point.
+	 * \param[in] fine_grid - Geometrical definition of the finer level.
+	 * \param[in] config - Definition of the particular problem.
+	 * \return Checksum of the fine grid.
+	 */
+	unsigned long GetAgglomeration_Checksum(CGeometry *fine_grid, CConfig *config);
+
+	/*! 
+	 * \brief Store the agglomeration of this level (parent/children topology) for the next runs.
+	 * \param[in] fine_grid - Geometrical definition of the finer level.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Level of the multigrid.
+	 * \param[in] iZone - Current zone in the mesh.
+	 */
+	void Write_Agglomeration(CGeometry *fine_grid, CConfig *config, unsigned short iMesh, unsigned short iZone);
+
 	/*! 
 	 * \brief Determine if a can be agglomerated using geometrical criteria.
 	 * \param[in] iPoint - Seed point.
@@ -1793,4 +1988,267 @@ public:
 
 };
 
+/*!
+ * \class CHaloExchange
+ * \brief Persistent point-to-point exchange of halo (send/receive marker) data.
+ * \version 4.2.0 "Cardinal"
+ *
+ * The send/receive markers created by SetSendReceive are flattened once
+ * into lists of points, and the packed buffers are kept between calls.
+ * The communication is split in a start (MPI_Isend/Irecv) and a finish
+ * (MPI_Waitall) call, so that work which does not depend on the halo
+ * points can be done in between. For that purpose the edges are also
+ * split into interior edges and edges touching a halo point.
+ */
+class CHaloExchange {
+  
+private:
+  
+  unsigned short nDim,           /*!< \brief Number of dimensions of the problem. */
+  nNeighbor,                     /*!< \brief Number of send/receive marker pairs. */
+  nVar_Comm;                     /*!< \brief Number of values per vertex of the current exchange. */
+  int *Send_To,                  /*!< \brief Destination rank of each marker pair. */
+  *Receive_From;                 /*!< \brief Source rank of each marker pair. */
+  unsigned long *Send_Offset,    /*!< \brief Offset of each marker pair in the send point list. */
+  *Receive_Offset,               /*!< \brief Offset of each marker pair in the receive point list. */
+  *Send_Point,                   /*!< \brief Points whose values are sent. */
+  *Receive_Point;                /*!< \brief Halo points whose values are received. */
+  unsigned short *Receive_Rotation; /*!< \brief Periodic transformation of each received point. */
+  unsigned short nRotation;      /*!< \brief Number of periodic transformations. */
+  su2double *RotMatrix;          /*!< \brief 3x3 rotation matrix of each periodic transformation. */
+  bool *Rotation_Identity;       /*!< \brief True if the periodic transformation is a pure translation. */
+  su2double *Buffer_Send,        /*!< \brief Packed send buffer, nVar_Comm values per send point. */
+  *Buffer_Receive;               /*!< \brief Packed receive buffer, nVar_Comm values per receive point. */
+  unsigned long nBuffer_Var;     /*!< \brief Number of values per vertex the buffers are allocated for. */
+  bool Comm_Pending;             /*!< \brief True between StartComms and FinishComms. */
+  int Comm_Tag;                  /*!< \brief Tag of the current exchange. */
+#ifdef HAVE_MPI
+  MPI_Request *Request;          /*!< \brief Requests of the current exchange (receives first). */
+  MPI_Status *Status;            /*!< \brief Status of the requests. */
+#endif
+  unsigned long nEdge_Interior,  /*!< \brief Number of edges without halo points. */
+  nEdge_Halo;                    /*!< \brief Number of edges with at least one halo point. */
+  unsigned long *Edge_List;      /*!< \brief Interior edges followed by the halo edges. */
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] geometry - Geometrical definition of the problem (send/receive markers already set).
+   * \param[in] config - Definition of the particular problem.
+   */
+  CHaloExchange(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CHaloExchange(void);
+  
+  /*!
+   * \brief Get the send buffer, sized for the next exchange.
+   * \param[in] val_nVar - Number of values per vertex.
+   * \return Send buffer, the values of the send point iSend go to [iSend*val_nVar, (iSend+1)*val_nVar).
+   */
+  su2double *GetBuffer_Send(unsigned short val_nVar);
+  
+  /*!
+   * \brief Get the receive buffer (same layout as the send buffer).
+   * \return Receive buffer, valid after FinishComms.
+   */
+  su2double *GetBuffer_Receive(void);
+  
+  /*!
+   * \brief Total number of points to send.
+   */
+  unsigned long GetnSend(void);
+  
+  /*!
+   * \brief Get the point of a send vertex.
+   * \param[in] val_send - Index in the send list.
+   */
+  unsigned long GetSend_Point(unsigned long val_send);
+  
+  /*!
+   * \brief Total number of halo points to receive.
+   */
+  unsigned long GetnReceive(void);
+  
+  /*!
+   * \brief Get the point of a receive vertex.
+   * \param[in] val_receive - Index in the receive list.
+   */
+  unsigned long GetReceive_Point(unsigned long val_receive);
+  
+  /*!
+   * \brief Rotate a vector received at a periodic boundary into the local frame.
+   * \param[in] val_receive - Index in the receive list.
+   * \param[in,out] val_vector - nDim components, rotated in place.
+   */
+  void Rotate(unsigned long val_receive, su2double *val_vector);
+  
+  /*!
+   * \brief Post the receives and the sends of the packed buffer.
+   * \param[in] val_tag - Tag of the exchange, different concurrent exchanges must use different tags.
+   */
+  void StartComms(int val_tag);
+  
+  /*!
+   * \brief Wait for the exchange started by StartComms to complete.
+   */
+  void FinishComms(void);
+  
+  /*!
+   * \brief Check if an exchange has been started and not finished.
+   */
+  bool GetComms_Pending(void);
+  
+  /*!
+   * \brief Get the tag of the exchange in progress.
+   */
+  int GetComms_Tag(void);
+  
+  /*!
+   * \brief Number of edges whose two points are not halo points.
+   */
+  unsigned long GetnEdge_Interior(void);
+  
+  /*!
+   * \brief Number of edges with at least one halo point.
+   */
+  unsigned long GetnEdge_Halo(void);
+  
+  /*!
+   * \brief Get an interior edge (no halo data needed).
+   * \param[in] val_edge - Index in the interior edge list.
+   */
+  unsigned long GetEdge_Interior(unsigned long val_edge);
+  
+  /*!
+   * \brief Get an edge touching a halo point.
+   * \param[in] val_edge - Index in the halo edge list.
+   */
+  unsigned long GetEdge_Halo(unsigned long val_edge);
+  
+};
+
+/*!
+ * \class CSU2BinaryMesh
+ * \brief Native binary mesh format, with the same content as the .su2 ASCII format.
+ * \version 4.2.0 "Cardinal"
+ *
+ * The file starts with the string "SU2BIN01" and a header of HEADER_SIZE
+ * unsigned longs with the sizes and the byte offsets of the sections:
+ * coordinates (nDim doubles per point), element offsets (nElem+1) and
+ * connectivity (VTK type followed by the nodes of every element), marker tags
+ * (MAX_STRING_SIZE chars each), SEND_TO values and offsets of the boundary
+ * elements of the markers (nMarker+1), boundary element offsets and
+ * connectivity (VERTEX elements store the node and the rotation type), and the
+ * periodic transformations (center, rotation and translation). All values are
+ * stored in the native byte order and unsigned longs must have 8 bytes.
+ */
+class CSU2BinaryMesh {
+public:
+  
+  /*!
+   * \brief Entries of the header of the file.
+   */
+  enum { HEADER_NDIM, HEADER_NPOINT, HEADER_NPOINTDOMAIN, HEADER_NELEM, HEADER_NMARKER,
+    HEADER_NBOUND, HEADER_NPERIODIC, HEADER_COORD, HEADER_ELEM_PTR, HEADER_ELEM_CONN,
+    HEADER_MARKER, HEADER_BOUND_PTR, HEADER_BOUND_CONN, HEADER_PERIODIC, HEADER_SIZE };
+  
+#ifdef HAVE_MPI
+  typedef MPI_File FileHandle;  /*!< \brief Files are read with MPI-IO in parallel. */
+#else
+  typedef FILE* FileHandle;     /*!< \brief Files are read with the C library in serial. */
+#endif
+  
+  unsigned short nDim;                    /*!< \brief Number of dimensions. */
+  unsigned long nPoint,                   /*!< \brief Number of points. */
+  nPointDomain;                           /*!< \brief Number of points in the domain. */
+  vector<passivedouble> Coord;            /*!< \brief Coordinates of the points. */
+  vector<unsigned long> Elem_Ptr,         /*!< \brief Offsets of the elements in Elem_Conn. */
+  Elem_Conn;                              /*!< \brief VTK type and nodes of the elements. */
+  vector<string> Marker_Tag;              /*!< \brief Tags of the markers. */
+  vector<long> Marker_SendRecv;           /*!< \brief SEND_TO value of the markers, 0 for physical boundaries. */
+  vector<unsigned long> Marker_Ptr,       /*!< \brief Offsets of the markers in the boundary elements. */
+  Bound_Ptr,                              /*!< \brief Offsets of the boundary elements in Bound_Conn. */
+  Bound_Conn;                             /*!< \brief VTK type and nodes of the boundary elements. */
+  vector<passivedouble> Periodic;         /*!< \brief Center, rotation and translation of the periodic transformations. */
+  
+  /*!
+   * \brief Constructor of the class, the mesh is empty.
+   * \param[in] val_nDim - Number of dimensions.
+   */
+  CSU2BinaryMesh(unsigned short val_nDim);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CSU2BinaryMesh(void);
+  
+  /*!
+   * \brief Add an element of the volume.
+   * \param[in] val_VTK_Type - VTK type of the element.
+   * \param[in] val_nNodes - Number of nodes of the element.
+   * \param[in] val_Nodes - Global indices of the nodes.
+   */
+  void AddElem(unsigned long val_VTK_Type, unsigned short val_nNodes, const unsigned long *val_Nodes);
+  
+  /*!
+   * \brief Start a new marker, the next boundary elements belong to it.
+   * \param[in] val_Tag - Tag of the marker.
+   * \param[in] val_SendRecv - SEND_TO value of a SEND_RECEIVE marker, 0 otherwise.
+   */
+  void AddMarker(string val_Tag, long val_SendRecv);
+  
+  /*!
+   * \brief Add a boundary element to the last marker.
+   * \param[in] val_VTK_Type - VTK type of the element.
+   * \param[in] val_nNodes - Number of nodes of the element (node and rotation type for VERTEX).
+   * \param[in] val_Nodes - Global indices of the nodes.
+   */
+  void AddBound(unsigned long val_VTK_Type, unsigned short val_nNodes, const unsigned long *val_Nodes);
+  
+  /*!
+   * \brief Write the mesh to a file (serial).
+   * \param[in] val_filename - Name of the file.
+   */
+  void Write(string val_filename);
+  
+  /*!
+   * \brief Open a binary mesh file for reading, collective in parallel.
+   * \param[in] val_filename - Name of the file.
+   * \param[out] fh - Handle of the file.
+   * \return <code>TRUE</code> if the file could be opened.
+   */
+  static bool OpenFile(string val_filename, FileHandle &fh);
+  
+  /*!
+   * \brief Read the header of a binary mesh file and check its signature.
+   * \param[in] fh - Handle of the file.
+   * \param[in] val_filename - Name of the file, for the error messages.
+   * \param[out] header - Header of the file, HEADER_SIZE values.
+   * \return <code>TRUE</code> if the file is a binary mesh file.
+   */
+  static bool ReadHeader(FileHandle fh, string val_filename, unsigned long *header);
+  
+  /*!
+   * \brief Read a byte range of a binary mesh file (independent in parallel), the
+   *        execution stops if the range can not be read completely.
+   * \param[in] fh - Handle of the file.
+   * \param[in] val_filename - Name of the file, for the error messages.
+   * \param[in] val_offset - Offset of the range in bytes.
+   * \param[out] val_buffer - Buffer for the data.
+   * \param[in] val_nBytes - Size of the range in bytes.
+   */
+  static void ReadBlock(FileHandle fh, string val_filename, unsigned long val_offset, void *val_buffer, unsigned long val_nBytes);
+  
+  /*!
+   * \brief Close a binary mesh file, collective in parallel.
+   * \param[in] fh - Handle of the file.
+   */
+  static void CloseFile(FileHandle &fh);
+  
+};
+
 #include "geometry_structure.inl"
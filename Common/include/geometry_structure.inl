@@ -109,6 +109,8 @@ inline void CGeometry::SetPoint_Connectivity(void) { }
 
 inline void CGeometry::SetRCM_Ordering(CConfig *config) { }
 
+inline void CGeometry::SetHilbert_Ordering(CConfig *config) { }
+
 inline void CGeometry::SetCoord_Smoothing (unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config) { }
 
 inline void CGeometry::SetCoord(CGeometry *geometry) { }
@@ -123,6 +125,8 @@ inline unsigned long CGeometry::GetnPointDomain(void) { return nPointDomain; }
 
 inline unsigned long CGeometry::GetnElem(void) { return nElem; }
 
+inline unsigned long CGeometry::GetCoord_Version(void) { return Coord_Version; }
+
 inline unsigned short CGeometry::GetnDim(void) { return nDim; }
 
 inline unsigned short CGeometry::GetnZone(void) { return nZone; }
@@ -153,6 +157,30 @@ inline unsigned long CGeometry::GetnVertex(unsigned short val_marker) { return n
 
 inline unsigned long CGeometry::GetnEdge(void) { return nEdge; }
 
+inline bool CGeometry::GetContiguous_Storage(void) { return (Point_Coord != NULL); }
+
+inline su2double *CGeometry::GetPoint_Coord(unsigned long val_point) { return &Point_Coord[val_point*nDim]; }
+
+inline su2double CGeometry::GetPoint_Volume(unsigned long val_point) { return Point_Volume[val_point*nVolume_Point]; }
+
+inline unsigned long *CGeometry::GetEdge_Nodes(unsigned long val_edge) { return &Edge_Node[2*val_edge]; }
+
+inline su2double *CGeometry::GetEdge_Normal(unsigned long val_edge) { return &Edge_Normal[val_edge*nDim]; }
+
+inline unsigned long CGeometry::GetPoint_Neighbor_Ptr(unsigned long val_point) { return Point_Neighbor_Ptr[val_point]; }
+
+inline unsigned long CGeometry::GetPoint_Neighbor(unsigned long val_index) { return Point_Neighbor[val_index]; }
+
+inline unsigned long CGeometry::GetPoint_Neighbor_Edge(unsigned long val_index) { return Point_Neighbor_Edge[val_index]; }
+
+inline unsigned short CGeometry::GetnEdge_Color(void) { return nEdge_Color; }
+
+inline unsigned long CGeometry::GetEdge_Color_Ptr(unsigned short val_color) { return Edge_Color_Ptr[val_color]; }
+
+inline unsigned long CGeometry::GetEdge_Color_Group(unsigned long val_index) { return Edge_Color_Group[val_index]; }
+
+inline unsigned long CGeometry::GetEdge_Color_GroupSize(void) { return Edge_Color_GroupSize; }
+
 inline bool CGeometry::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem, unsigned short &face_second_elem) {return 0;}
 
 inline void CGeometry::SetBoundVolume(void) { }
@@ -302,3 +330,25 @@ inline void CGeometry::SetSensitivity(unsigned long iPoint, unsigned short iDim,
 inline void CPhysicalGeometry::SetSensitivity(unsigned long iPoint, unsigned short iDim, su2double val){Sensitivity[iPoint*nDim+iDim] = val;}
 
 inline void CGeometry::Check_Periodicity(CConfig* config){}
+
+inline su2double *CHaloExchange::GetBuffer_Receive(void) { return Buffer_Receive; }
+
+inline unsigned long CHaloExchange::GetnSend(void) { return Send_Offset[nNeighbor]; }
+
+inline unsigned long CHaloExchange::GetSend_Point(unsigned long val_send) { return Send_Point[val_send]; }
+
+inline unsigned long CHaloExchange::GetnReceive(void) { return Receive_Offset[nNeighbor]; }
+
+inline unsigned long CHaloExchange::GetReceive_Point(unsigned long val_receive) { return Receive_Point[val_receive]; }
+
+inline bool CHaloExchange::GetComms_Pending(void) { return Comm_Pending; }
+
+inline int CHaloExchange::GetComms_Tag(void) { return Comm_Tag; }
+
+inline unsigned long CHaloExchange::GetnEdge_Interior(void) { return nEdge_Interior; }
+
+inline unsigned long CHaloExchange::GetnEdge_Halo(void) { return nEdge_Halo; }
+
+inline unsigned long CHaloExchange::GetEdge_Interior(unsigned long val_edge) { return Edge_List[val_edge]; }
+
+inline unsigned long CHaloExchange::GetEdge_Halo(unsigned long val_edge) { return Edge_List[nEdge_Interior+val_edge]; }
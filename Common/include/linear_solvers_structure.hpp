@@ -66,6 +66,10 @@ class CSysSolve {
   
 private:
   
+#ifdef HAVE_MPI
+  MPI_Request ReductionRequest; /*!< \brief request of the reduction started by StartReduction. */
+#endif
+  
   /*!
    * \brief sign transfer function
    * \param[in] x - value having sign prescribed
@@ -132,6 +136,40 @@ private:
    */
   void ModGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w);
   
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization with fused reductions
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in, out] Hsbg - the upper Hessenberg begin updated
+   * \param[in, out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   *
+   * \pre the vectors w[0:i] are orthonormal
+   * \post the vectors w[0:i+1] are orthonormal
+   *
+   * All the projections and the norm of w[i+1] are obtained with a single
+   * global reduction, and the norm of the orthogonalized vector follows from
+   * Pythagoras. A second (also fused) pass is done only when the projection
+   * removed most of the vector, which is when classical Gram-Schmidt loses
+   * orthogonality.
+   */
+  void ClassicalGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w);
+  
+  /*!
+   * \brief start the global sum of nDot local values
+   * \param[in] nDot - number of values
+   * \param[in] loc_val - local values (must not be modified until the reduction is finished)
+   * \param[out] val - global sums, available after FinishReduction
+   *
+   * With MPI-3, and when su2double is a plain double, the reduction is non-blocking
+   * so that it can be overlapped with the preconditioner and the matrix-vector product.
+   */
+  void StartReduction(unsigned short nDot, su2double *loc_val, su2double *val);
+  
+  /*!
+   * \brief wait for the global sum started by StartReduction
+   */
+  void FinishReduction(void);
+  
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -166,6 +204,24 @@ public:
   unsigned long CG_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
                                   CPreconditioner & precond, su2double tol,
                                   unsigned long m, bool monitoring);
+  
+  /*! \brief Pipelined Conjugate Gradient method (Ghysels and Vanroose)
+   * \param[in] b - the right hand size vector
+   * \param[in, out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[in] residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   *
+   * Mathematically equivalent to CG_LinSolver, but the three inner products of an
+   * iteration are summed with one global reduction, which is overlapped with the
+   * preconditioner and matrix-vector product of the same iteration.
+   */
+  unsigned long PipelinedCG_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                      CPreconditioner & precond, su2double tol,
+                                      unsigned long m, su2double *residual, bool monitoring);
 	
   /*!
    * \brief Flexible Generalized Minimal Residual method
@@ -177,10 +233,11 @@ public:
    * \param[in] m - maximum size of the search subspace
    * \param[in] residual
    * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] fused_reduction - orthogonalize with ClassicalGramSchmidt instead of ModGramSchmidt.
    */
   unsigned long FGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
                       CPreconditioner & precond, su2double tol,
-                      unsigned long m, su2double *residual, bool monitoring);
+                      unsigned long m, su2double *residual, bool monitoring, bool fused_reduction = false);
 	
 	/*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
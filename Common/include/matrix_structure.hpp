@@ -72,7 +72,45 @@ private:
 	su2double *prod_row_vector;   /*!< \brief Internal array to store the product of a matrix-by-blocks "row" with a vector. */
 	su2double *aux_vector;         /*!< \brief Auxiliary array to store intermediate results. */
   su2double *sum_vector;         /*!< \brief Auxiliary array to store intermediate results. */
+  su2double *thread_vector;      /*!< \brief Partial sums of the generic block kernels, nVar values per thread. */
 	su2double *invM;              /*!< \brief Inverse of (Jacobi) preconditioner. */
+  su2double *ILU_invDiag;       /*!< \brief Inverse of the diagonal blocks of the ILU factorization. */
+  
+  bool Matrix_Float;            /*!< \brief The matrix is stored in single precision (see LINEAR_SOLVER_MIXED_PRECISION), the accessors still use su2double. */
+  float *matrix_float;          /*!< \brief Entries of the sparse matrix, single precision storage. */
+  su2double *matrix_block;      /*!< \brief Copy of a block of the single precision matrix, returned by GetBlock. */
+  
+  bool ILU_Float;               /*!< \brief The ILU factorization is stored in single precision (see LINEAR_SOLVER_MIXED_PRECISION). */
+  float *ILU_matrix_float;      /*!< \brief Entries of the ILU sparse matrix, single precision storage. */
+  float *ILU_invDiag_float;     /*!< \brief Inverse of the diagonal blocks of the ILU factorization, single precision storage. */
+  su2double *ILU_block;         /*!< \brief Internal array with a copy of a diagonal block of the ILU matrix. */
+  
+  unsigned short AMG_nLevel;    /*!< \brief Number of levels of the algebraic multigrid, including this matrix. */
+  CSysMatrix **AMG_Matrix;      /*!< \brief Operator of each level, the first one is this matrix. */
+  unsigned long **AMG_Prolong_ptr,  /*!< \brief Row pointers of the prolongation from iLevel+1 to iLevel. */
+  **AMG_Prolong_col,            /*!< \brief Coarse column of each block of the prolongation. */
+  **AMG_Restrict_ptr,           /*!< \brief Row pointers of the restriction (transposed prolongation). */
+  **AMG_Restrict_row,           /*!< \brief Fine row of each block of the restriction. */
+  **AMG_Restrict_idx;           /*!< \brief Position in the prolongation of each block of the restriction. */
+  su2double **AMG_Prolong_val;  /*!< \brief Blocks of the prolongation. */
+  CSysVector **AMG_Rhs,         /*!< \brief Right hand side of each level. */
+  **AMG_Sol,                    /*!< \brief Correction of each level. */
+  **AMG_Res,                    /*!< \brief Residual of each level. */
+  **AMG_Aux;                    /*!< \brief Auxiliary vector of each level. */
+  su2double *AMG_CoarseLU;      /*!< \brief Dense LU factorization of the coarsest level. */
+  unsigned long *AMG_CoarsePiv, /*!< \brief Row interchanges of the dense LU factorization. */
+  AMG_nCoarseDense;             /*!< \brief Size of the dense coarsest system, 0 if it is smoothed instead. */
+  bool AMG_Transposed;          /*!< \brief The hierarchy is applied to the transposed system. */
+  unsigned short AMG_Smoother,  /*!< \brief Smoother of the levels (JACOBI or ILU). */
+  AMG_PreSmooth,                /*!< \brief Number of pre-smoothing sweeps. */
+  AMG_PostSmooth;               /*!< \brief Number of post-smoothing sweeps. */
+  
+  unsigned long nLevel_Lower,   /*!< \brief Number of levels of the forward substitution. */
+  nLevel_Upper,                 /*!< \brief Number of levels of the backward substitution. */
+  *LevelPtr_Lower,              /*!< \brief Pointer to the first row of each level of the forward substitution. */
+  *LevelRow_Lower,              /*!< \brief Rows sorted by level of the forward substitution. */
+  *LevelPtr_Upper,              /*!< \brief Pointer to the first row of each level of the backward substitution. */
+  *LevelRow_Upper;              /*!< \brief Rows sorted by level of the backward substitution. */
 
 	bool *LineletBool;                          /*!< \brief Identify if a point belong to a linelet. */
 	vector<unsigned long> *LineletPoint;        /*!< \brief Linelet structure. */
@@ -82,6 +120,140 @@ private:
   *LyVector, *FzVector;           /*!< \brief Arrays of the Linelet preconditioner methodology. */
   unsigned long max_nElem;
   
+  int nLocal_Neighbor;          /*!< \brief Number of ranks that exchange rows of a system whose unknowns are not grid points. */
+  int *Local_Neighbor;          /*!< \brief Rank of each neighbor of the local exchange. */
+  unsigned long *Local_Send_Ptr, /*!< \brief Start of the rows sent to each neighbor in Local_Send_Row. */
+  *Local_Send_Row,              /*!< \brief Domain rows sent to the neighbors. */
+  *Local_Recv_Ptr,              /*!< \brief Start of the rows received from each neighbor in Local_Recv_Row. */
+  *Local_Recv_Row;              /*!< \brief Halo rows received from the neighbors. */
+  
+  /*--- Block kernels, specialized at compile time for the usual block sizes
+   and selected in SetIndexes according to nVar (see SetBlockKernels). ---*/
+  
+  void (CSysMatrix::*MatVec_Kernel)(const CSysVector & vec, CSysVector & prod);          /*!< \brief Product of the domain rows with a vector. */
+  void (CSysMatrix::*Jacobi_Kernel)(const CSysVector & vec, CSysVector & prod);          /*!< \brief Product of the inverse diagonal with a vector. */
+  void (CSysMatrix::*ILU_Kernel)(CSysVector & vec);                                       /*!< \brief ILU forward and backward substitution. */
+  void (CSysMatrix::*BlockVector_Kernel)(su2double *c, su2double *a, su2double *b);      /*!< \brief Product of a block with a vector. */
+  void (CSysMatrix::*Gauss_Kernel)(su2double *Block, su2double *rhs, bool transposed);   /*!< \brief Solution of a block system. */
+  
+  /*!
+   * \brief Scratch vector of the calling thread (nVar values), allocated once in SetIndexes.
+   */
+  su2double *GetThread_Vector(void);
+  
+  /*!
+   * \brief Select the block kernels for the number of variables of the matrix.
+   */
+  template<unsigned short N>
+  void SetBlockKernels(void);
+  
+  /*!
+   * \brief Product of the domain rows of the matrix with a vector (no communication).
+   * \note N is the block size, N = 0 uses the runtime value nVar; the same holds for the other kernels.
+   * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
+   * \param[out] prod - Result of the product.
+   * \note ScalarType is the precision of the storage of the matrix, the products are summed in su2double.
+   */
+  template<unsigned short N, class ScalarType>
+  void MatrixVectorProduct_Kernel(const CSysVector & vec, CSysVector & prod);
+  
+  /*!
+   * \brief Get the storage of the matrix.
+   * \note The overload is chosen by the precision of the storage used in the kernel.
+   */
+  void GetMatrix_Storage(const su2double* &val) const { val = matrix; }
+  void GetMatrix_Storage(const float* &val) const { val = matrix_float; }
+  
+  /*!
+   * \brief Product of the domain rows of the Jacobi preconditioner with a vector (no communication).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product.
+   */
+  template<unsigned short N>
+  void ComputeJacobiPreconditioner_Kernel(const CSysVector & vec, CSysVector & prod);
+  
+  /*!
+   * \brief ILU forward and backward substitution, in place.
+   * \param[in,out] vec - CSysVector with the right hand side, overwritten with the solution.
+   */
+  template<unsigned short N, class ScalarType>
+  void ILU_Substitution_Kernel(CSysVector & vec);
+  
+  /*!
+   * \brief Get the storage of the ILU factorization and of its inverse diagonal blocks.
+   * \note The overload is chosen by the precision of the storage used in the ILU kernel.
+   */
+  void GetILU_Storage(const su2double* &LU, const su2double* &invDiag) const { LU = ILU_matrix; invDiag = ILU_invDiag; }
+  void GetILU_Storage(const float* &LU, const float* &invDiag) const { LU = ILU_matrix_float; invDiag = ILU_invDiag_float; }
+  
+  /*!
+   * \brief Reserve the memory of the ILU factorization, in double or single precision.
+   */
+  void InitializeILU(void);
+  
+  /*!
+   * \brief Frobenius norm of a block, used for the strength of connection of the AMG.
+   * \param[in] val_block - Block of the matrix.
+   */
+  passivedouble GetBlockNorm(const su2double *val_block);
+  
+  /*!
+   * \brief Aggregate the domain rows of level iLevel and build the smoothed prolongation and the Galerkin operator of level iLevel+1.
+   * \param[in] iLevel - Level to be coarsened.
+   * \param[in] config - Definition of the particular problem.
+   * \return <code>FALSE</code> if the level is too small or does not coarsen anymore.
+   */
+  bool AMG_Coarsen(unsigned short iLevel, CConfig *config);
+  
+  /*!
+   * \brief Dense LU factorization of the coarsest level of the AMG.
+   */
+  void AMG_CoarseFactorize(void);
+  
+  /*!
+   * \brief Solve the coarsest level of the AMG with the dense factorization.
+   */
+  void AMG_CoarseSolve(void);
+  
+  /*!
+   * \brief Residual of level iLevel, b - A*x or b - A^T*x, without communication.
+   * \param[in] iLevel - Level of the AMG.
+   */
+  void AMG_Residual(unsigned short iLevel);
+  
+  /*!
+   * \brief Smoothing sweeps (damped Jacobi or ILU0) on level iLevel.
+   * \param[in] iLevel - Level of the AMG.
+   * \param[in] nSweep - Number of sweeps.
+   */
+  void AMG_Smooth(unsigned short iLevel, unsigned short nSweep);
+  
+  /*!
+   * \brief V-cycle from level iLevel, the correction starts from zero.
+   * \param[in] iLevel - Level of the AMG.
+   */
+  void AMG_Cycle(unsigned short iLevel);
+  
+  /*!
+   * \brief Free the AMG hierarchy.
+   */
+  void DeleteAMG(void);
+  
+  /*!
+   * \brief Product of a block by a vector, c = a*b.
+   */
+  template<unsigned short N>
+  void GetMultBlockVector_Kernel(su2double *c, su2double *a, su2double *b);
+  
+  /*!
+   * \brief Gauss elimination of a block system, the block is not modified.
+   * \param[in] Block - Block of the system.
+   * \param[in,out] rhs - Right-hand-side, overwritten with the solution.
+   * \param[in] transposed - If true the transposed of the block is used.
+   */
+  template<unsigned short N>
+  void Gauss_Elimination_Kernel(su2double *Block, su2double *rhs, bool transposed);
+  
 public:
   
 	/*!
@@ -125,6 +297,7 @@ public:
 	 * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
 	 * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
 	 * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
+	 * \return Pointer to the block; with the single precision storage, to a copy of it that is only valid until the next call.
 	 */
 	su2double *GetBlock(unsigned long block_i, unsigned long block_j);
   
@@ -156,6 +329,8 @@ public:
 	 * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
 	 * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
 	 * \param[in] **val_block - Block to add to A(i, j).
+	 *
+	 * Blocks of different rows can be updated concurrently by different threads.
 	 */
 	void AddBlock(unsigned long block_i, unsigned long block_j, su2double **val_block);
 
@@ -175,15 +350,19 @@ public:
 	 * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
 	 * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
 	 * \param[in] **val_block - Block to subtract to A(i, j).
+	 *
+	 * Blocks of different rows can be updated concurrently by different threads.
 	 */
 	void SubtractBlock(unsigned long block_i, unsigned long block_j, su2double **val_block);
   
   /*!
-	 * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
+	 * \brief Copies the block (i, j) of the ILU factors into a buffer of the caller (converted
+	 *        to su2double with single precision storage), zero if the block is not in the pattern.
 	 * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
 	 * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
+	 * \param[out] val_block - Copy of the block, nVar*nEqn values.
 	 */
-	su2double *GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j);
+	void GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block);
   
   /*!
 	 * \brief Set the value of a block in the sparse matrix.
@@ -322,6 +501,21 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   void SendReceive_SolutionTransposed(CSysVector & x, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Set the exchange of the halo rows of a system whose unknowns are not grid points (e.g. elements).
+   * \param[in] val_neighbor - Rank of each neighbor.
+   * \param[in] val_send - Domain rows sent to each neighbor, in the order the neighbor receives them.
+   * \param[in] val_recv - Halo rows received from each neighbor.
+   */
+  void SetSendReceive_Local(vector<int> & val_neighbor, vector<vector<unsigned long> > & val_send,
+                            vector<vector<unsigned long> > & val_recv);
+  
+  /*!
+   * \brief Send receive the halo rows set in SetSendReceive_Local (nothing is done if it was not called).
+   * \param[in] x - Vector whose halo rows are updated.
+   */
+  void SendReceive_Local(CSysVector & x);
 
   /*!
 	 * \brief Performs the product of i-th row of a sparse matrix by a vector.
@@ -356,6 +550,13 @@ public:
    * \param[out] prod - Result of the product.
    */
   void MatrixVectorProductTransposed(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Performs the product of the transposed sparse matrix by a vector, without communication.
+   * \param[in] vec - Vector to be multiplied by the transposed sparse matrix A^T.
+   * \param[out] prod - Result of the product, the halo entries hold partial sums.
+   */
+  void MatrixVectorProductTransposed(const CSysVector & vec, CSysVector & prod);
 
 	/*!
 	 * \brief Performs the product of two block matrices.
@@ -411,6 +612,13 @@ public:
    * \param[in] config - Definition of the particular problem.
 	 */
 	void ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+
+	/*!
+	 * \brief Multiply CSysVector by the preconditioner, without communication between ranks.
+	 * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+	 * \param[out] prod - Result of the product A*vec.
+	 */
+	void ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod);
   
   /*!
    * \brief Apply Jacobi as a classical iterative smoother
@@ -427,6 +635,19 @@ public:
    */
   unsigned long Jacobi_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Group the rows of the domain in levels that only depend on the rows of previous levels,
+   *        for the lower (forward) and upper (backward) triangular substitutions.
+   * \note The rows of each level are independent, they are distributed among the OpenMP threads.
+   */
+  void BuildLevelSets(void);
+  
+  /*!
+   * \brief Apply the forward and backward substitution with the ILU factorization, in place.
+   * \param[in,out] vec - CSysVector with the right hand side, overwritten with the solution.
+   */
+  void ILU_Substitution(CSysVector & vec);
+  
   /*!
    * \brief Build the ILU0 preconditioner.
    * \param[in] transposed - Flag to use the transposed matrix to construct the preconditioner.
@@ -492,6 +713,24 @@ public:
 	 * \param[out] prod - Result of the product A*vec.
 	 */
 	void ComputeLineletPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Build the smoothed aggregation algebraic multigrid preconditioner.
+   * \note The aggregation works on the domain rows of each rank, the couplings with the halos are
+   *       left out of the hierarchy (the AMG is a block-Jacobi preconditioner between ranks).
+   * \param[in] config - Definition of the particular problem (levels and smoother of the AMG).
+   * \param[in] transposed - Flag to precondition the transposed system.
+   */
+  void BuildAMGPreconditioner(CConfig *config, bool transposed = false);
+  
+  /*!
+   * \brief Multiply CSysVector by the AMG preconditioner (one V-cycle).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem, NULL for systems that are not defined on grid points (no halo exchange).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
 
   /*!
 	 * \brief Compute the residual Ax-b
@@ -569,6 +808,37 @@ public:
   void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
+/*!
+ * \class CSysMatrixVectorProductLocal
+ * \brief specialization of matrix-vector product for systems whose unknowns are not
+ *        grid points (e.g. elements), the halo rows are exchanged with the pattern
+ *        given to CSysMatrix::SetSendReceive_Local.
+ */
+class CSysMatrixVectorProductLocal : public CMatrixVectorProduct {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the product. */
+
+public:
+
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the products
+   */
+  CSysMatrixVectorProductLocal(CSysMatrix & matrix_ref);
+
+  /*!
+   * \brief destructor of the class
+   */
+  ~CSysMatrixVectorProductLocal() {}
+
+  /*!
+   * \brief operator that defines the CSysMatrix-CSysVector product
+   * \param[in] u - CSysVector that is being multiplied by the sparse matrix
+   * \param[out] v - CSysVector that is the result of the product
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 /*!
  * \class CJacobiPreconditioner
  * \brief specialization of preconditioner that uses CSysMatrix class
@@ -602,6 +872,37 @@ public:
 	void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
+/*!
+ * \class CJacobiPreconditionerLocal
+ * \brief specialization of the Jacobi preconditioner for systems whose unknowns are not
+ *        grid points (e.g. elements), the halo rows are exchanged with the pattern
+ *        given to CSysMatrix::SetSendReceive_Local.
+ */
+class CJacobiPreconditionerLocal : public CPreconditioner {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+
+public:
+
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   */
+  CJacobiPreconditionerLocal(CSysMatrix & matrix_ref);
+
+  /*!
+   * \brief destructor of the class
+   */
+  ~CJacobiPreconditionerLocal() {}
+
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 /*!
  * \class CJacobiTransposedPreconditioner
  * \brief specialization of preconditioner that uses CSysMatrix class
@@ -734,4 +1035,37 @@ public:
 	void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief specialization of preconditioner that uses CSysMatrix class
+ */
+class CAMGPreconditioner : public CPreconditioner {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref - NULL if the system is not defined on grid points
+   * \param[in] config_ref -
+   */
+  CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CAMGPreconditioner() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 #include "matrix_structure.inl"
@@ -31,9 +31,23 @@
  
 #pragma once
 
+inline su2double *CSysMatrix::GetThread_Vector(void) {
+#ifdef HAVE_OMP
+  return &thread_vector[omp_get_thread_num()*nVar];
+#else
+  return thread_vector;
+#endif
+}
+
 inline void CSysMatrix::SetValZero(void) { 
-	for (unsigned long index = 0; index < nnz*nVar*nEqn; index++) 
-		matrix[index] = 0.0;
+  if (Matrix_Float) {
+    for (unsigned long index = 0; index < nnz*nVar*nEqn; index++)
+      matrix_float[index] = 0.0;
+  }
+  else {
+    for (unsigned long index = 0; index < nnz*nVar*nEqn; index++)
+      matrix[index] = 0.0;
+  }
 }
 
 inline CSysMatrixVectorProduct::CSysMatrixVectorProduct(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
@@ -82,6 +96,34 @@ inline void CJacobiPreconditioner::operator()(const CSysVector & u, CSysVector &
   sparse_matrix->ComputeJacobiPreconditioner(u, v, geometry, config);
 }
 
+inline CSysMatrixVectorProductLocal::CSysMatrixVectorProductLocal(CSysMatrix & matrix_ref) {
+  sparse_matrix = &matrix_ref;
+}
+
+inline void CSysMatrixVectorProductLocal::operator()(const CSysVector & u, CSysVector & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CSysMatrixVectorProductLocal::operator()(const CSysVector &, CSysVector &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->MatrixVectorProduct(u, v);
+  sparse_matrix->SendReceive_Local(v);
+}
+
+inline CJacobiPreconditionerLocal::CJacobiPreconditionerLocal(CSysMatrix & matrix_ref) {
+  sparse_matrix = &matrix_ref;
+}
+
+inline void CJacobiPreconditionerLocal::operator()(const CSysVector & u, CSysVector & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CJacobiPreconditionerLocal::operator()(const CSysVector &, CSysVector &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeJacobiPreconditioner(u, v);
+  sparse_matrix->SendReceive_Local(v);
+}
+
 inline CILUPreconditioner::CILUPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
   sparse_matrix = &matrix_ref;
   geometry = geometry_ref;
@@ -97,6 +139,21 @@ inline void CILUPreconditioner::operator()(const CSysVector & u, CSysVector & v)
   sparse_matrix->ComputeILUPreconditioner(u, v, geometry, config);
 }
 
+inline CAMGPreconditioner::CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CAMGPreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CAMGPreconditioner::operator()(const CSysVector &, CSysVector &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeAMGPreconditioner(u, v, geometry, config);
+}
+
 inline CLU_SGSPreconditioner::CLU_SGSPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
   sparse_matrix = &matrix_ref;
       geometry = geometry_ref;
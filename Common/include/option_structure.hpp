@@ -119,6 +119,7 @@ const unsigned int MAX_TERMS = 6;		         /*!< \brief Maximum number of terms
 const unsigned int MAX_ZONES = 3;            /*!< \brief Maximum number of zones. */
 const unsigned int MAX_FE_KINDS = 4;            	/*!< \brief Maximum number of Finite Elements. */
 const unsigned int NO_RK_ITER = 0;		       /*!< \brief No Runge-Kutta iteration. */
+const unsigned int EDGE_BLOCK_SIZE = 8;	     /*!< \brief Number of edges processed together by the batched numerics (SIMD lanes). */
 
 const unsigned int OVERHEAD = 4; /*!< \brief Overhead space above nMarker when allocating space for boundary elems (MPI + periodic). */
 
@@ -387,6 +388,23 @@ const int DE_TERM = 1;			/*!< \brief Position of the dielectric terms in the num
 const int FEA_ADJ = 2;     /*!< \brief Position of the finite element analysis terms in the numerics container array. */
 const int DE_ADJ = 3;			/*!< \brief Position of the dielectric adjoint terms in the numerics container array. */
 
+/*!
+ * \brief quantities of the halo points exchanged with CSolver::InitiateComms and CSolver::CompleteComms
+ * (the values are also the message tags, distinct from the tags 0 and 1 of the blocking exchanges)
+ */
+enum MPI_QUANTITIES {
+  COMM_SOLUTION = 2,            /*!< \brief Solution. */
+  COMM_SOLUTION_EDDY = 3,       /*!< \brief Solution and eddy viscosity (turbulence models). */
+  COMM_SOLUTION_OLD = 4,        /*!< \brief Solution of the previous iteration. */
+  COMM_SOLUTION_GRADIENT = 5,   /*!< \brief Gradient of the solution. */
+  COMM_SOLUTION_LIMITER = 6,    /*!< \brief Limiter of the solution. */
+  COMM_PRIMITIVE_GRADIENT = 7,  /*!< \brief Gradient of the primitive variables. */
+  COMM_PRIMITIVE_LIMITER = 8,   /*!< \brief Limiter of the primitive variables. */
+  COMM_UNDIVIDED_LAPLACIAN = 9, /*!< \brief Undivided Laplacian of the solution (centered schemes). */
+  COMM_MAX_EIGENVALUE = 10,     /*!< \brief Spectral radius and number of neighbors (centered schemes). */
+  COMM_SENSOR = 11              /*!< \brief Dissipation switch (centered schemes). */
+};
+
 /*!
  * \brief types of finite elements (in 2D or 3D)
  */
@@ -635,6 +653,19 @@ static const map<string, ENUM_LIMITER> Limiter_Map = CCreateMap<string, ENUM_LIM
 ("SHARP_EDGES", SHARP_EDGES)
 ("WALL_DISTANCE", SOLID_WALL_DISTANCE);
 
+/*!
+ * \brief types of renumbering of the points of the grid
+ */
+enum ENUM_POINT_ORDERING {
+  NO_ORDERING = 0,   /*!< \brief Keep the ordering of the partitioning. */
+  RCM_ORDERING = 1,  /*!< \brief Reverse Cuthill-McKee ordering. */
+  HILBERT_ORDERING = 2 /*!< \brief Ordering along a Hilbert space-filling curve. */
+};
+static const map<string, ENUM_POINT_ORDERING> Point_Ordering_Map = CCreateMap<string, ENUM_POINT_ORDERING>
+("NONE", NO_ORDERING)
+("RCM", RCM_ORDERING)
+("HILBERT", HILBERT_ORDERING);
+
 /*!
  * \brief types of turbulent models
  */
@@ -1074,11 +1105,13 @@ static const map<string, ENUM_ADAPT> Adapt_Map = CCreateMap<string, ENUM_ADAPT>
  */
 enum ENUM_INPUT {
   SU2 = 1,                       /*!< \brief SU2 input format. */
-  CGNS = 2                     /*!< \brief CGNS input format for the computational grid. */
+  CGNS = 2,                    /*!< \brief CGNS input format for the computational grid. */
+  SU2_BINARY = 3               /*!< \brief SU2 native binary format, read in parallel by byte ranges. */
 };
 static const map<string, ENUM_INPUT> Input_Map = CCreateMap<string, ENUM_INPUT>
 ("SU2", SU2)
-("CGNS", CGNS);
+("CGNS", CGNS)
+("SU2_BINARY", SU2_BINARY);
 
 const int CGNS_STRING_SIZE = 33;/*!< \brief Length of strings used in the CGNS format. */
 
@@ -1092,7 +1125,9 @@ enum ENUM_OUTPUT {
   FIELDVIEW_BINARY = 4,  /*!< \brief FieldView binary format for the solution output. */
   CSV = 5,			         /*!< \brief Comma-separated values format for the solution output. */
   CGNS_SOL = 6,  	     	 /*!< \brief CGNS format for the solution output. */
-  PARAVIEW = 7  		     /*!< \brief Paraview format for the solution output. */
+  PARAVIEW = 7,  		     /*!< \brief Paraview format for the solution output. */
+  PARAVIEW_BINARY = 8,  	 /*!< \brief Paraview XML binary format written in parallel (one piece per rank). */
+  XDMF = 9  	           /*!< \brief XDMF index and raw binary data written in parallel in a single file. */
 };
 static const map<string, ENUM_OUTPUT> Output_Map = CCreateMap<string, ENUM_OUTPUT>
 ("TECPLOT", TECPLOT)
@@ -1101,7 +1136,26 @@ static const map<string, ENUM_OUTPUT> Output_Map = CCreateMap<string, ENUM_OUTPU
 ("FIELDVIEW_BINARY", FIELDVIEW_BINARY)
 ("CSV", CSV)
 ("CGNS", CGNS_SOL)
-("PARAVIEW", PARAVIEW);
+("PARAVIEW", PARAVIEW)
+("PARAVIEW_BINARY", PARAVIEW_BINARY)
+("XDMF", XDMF);
+
+/*!
+ * \brief Phases of an iteration in the timing history, the wall time of nested phases is not counted twice
+ */
+enum ENUM_TIMING_PHASE {
+  PHASE_OTHER = 0,          /*!< \brief Time outside of the other phases (boundary conditions, updates, ...). */
+  PHASE_PREPROCESSING = 1,  /*!< \brief Preprocessing of the solvers (primitive variables, ...). */
+  PHASE_GRADIENT = 2,       /*!< \brief Gradients of the solution or of the primitive variables. */
+  PHASE_LIMITER = 3,        /*!< \brief Slope limiters. */
+  PHASE_CONVECTIVE = 4,     /*!< \brief Convective residual. */
+  PHASE_VISCOUS = 5,        /*!< \brief Viscous residual. */
+  PHASE_SOURCE = 6,         /*!< \brief Source terms. */
+  PHASE_LINEAR_SOLVER = 7,  /*!< \brief Linear solver. */
+  PHASE_HALO = 8,           /*!< \brief Exchange of the halo points. */
+  PHASE_OUTPUT = 9,         /*!< \brief Output files and convergence history. */
+  N_TIMING_PHASES = 10      /*!< \brief Number of phases. */
+};
 
 /*!
  * \brief type of multigrid cycle
@@ -1202,7 +1256,9 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER_LUSGS = 8,  /*!< \brief LU_SGS smoother. */
   SMOOTHER_JACOBI = 9,  /*!< \brief Jacobi smoother. */
   SMOOTHER_ILU = 10,  /*!< \brief ILU smoother. */
-  SMOOTHER_LINELET = 11  /*!< \brief Linelet smoother. */
+  SMOOTHER_LINELET = 11,  /*!< \brief Linelet smoother. */
+  PIPELINED_CG = 12,  /*!< \brief Pipelined conjugate gradient, one overlapped reduction per iteration. */
+  FGMRES_CGS = 13  /*!< \brief FGMRES with classical Gram-Schmidt, one fused reduction per iteration. */
 };
 static const map<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = CCreateMap<string, ENUM_LINEAR_SOLVER>
 ("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1212,6 +1268,8 @@ static const map<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = CCreateMap<stri
 ("BCGSTAB", BCGSTAB)
 ("FGMRES", FGMRES)
 ("RESTARTED_FGMRES", RESTARTED_FGMRES)
+("PIPELINED_CG", PIPELINED_CG)
+("FGMRES_CGS", FGMRES_CGS)
 ("SMOOTHER_LUSGS", SMOOTHER_LUSGS)
 ("SMOOTHER_JACOBI", SMOOTHER_JACOBI)
 ("SMOOTHER_LINELET", SMOOTHER_LINELET)
@@ -1248,13 +1306,15 @@ enum ENUM_LINEAR_SOLVER_PREC {
   JACOBI = 1,		/*!< \brief Jacobi preconditioner. */
   LU_SGS = 2,		/*!< \brief LU SGS preconditioner. */
   LINELET = 3,  /*!< \brief Line implicit preconditioner. */
-  ILU = 4       /*!< \brief ILU(0) preconditioner. */
+  ILU = 4,      /*!< \brief ILU(0) preconditioner. */
+  AMG = 5       /*!< \brief Smoothed aggregation algebraic multigrid preconditioner. */
 };
 static const map<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = CCreateMap<string, ENUM_LINEAR_SOLVER_PREC>
 ("JACOBI", JACOBI)
 ("LU_SGS", LU_SGS)
 ("LINELET", LINELET)
-("ILU0", ILU);
+("ILU0", ILU)
+("AMG", AMG);
 
 /*!
  * \brief types of analytic definitions for various geometries
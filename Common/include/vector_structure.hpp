@@ -339,6 +339,27 @@ public:
    */
   friend su2double dotProd(const CSysVector & u, const CSysVector & v);
   
+  /*!
+   * \brief local (this processor only) dot-products of several pairs of CSysVectors
+   * \param[in] nDot - number of dot-products to compute
+   * \param[in] u - first CSysVector of each pair
+   * \param[in] v - second CSysVector of each pair
+   * \param[out] prod - local inner products, to be summed over all processors by the caller
+   *
+   * All the pairs are evaluated in a single sweep over the domain elements, so that
+   * the global sums can later be done with one reduction instead of one per product.
+   */
+  friend void dotProdLocal(unsigned short nDot, const CSysVector * const *u, const CSysVector * const *v, su2double *prod);
+  
+  /*!
+   * \brief dot-products of several pairs of CSysVectors using a single global reduction
+   * \param[in] nDot - number of dot-products to compute
+   * \param[in] u - first CSysVector of each pair
+   * \param[in] v - second CSysVector of each pair
+   * \param[out] prod - global inner products
+   */
+  friend void dotProdFused(unsigned short nDot, const CSysVector * const *u, const CSysVector * const *v, su2double *prod);
+  
 };
 
 /*!
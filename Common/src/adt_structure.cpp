@@ -3,7 +3,7 @@
  * \brief Main subroutines for for carrying out geometrical searches using an
  *        alternating digital tree (ADT).
  * \author E. van der Weide
- * \version 4.1.3 "Cardinal"
+ * \version 4.2.0 "Cardinal"
  *
  * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
  *                      Dr. Thomas D. Economon (economon@stanford.edu).
@@ -239,97 +239,114 @@ void su2_adtBaseClass::BuildADT(unsigned short  nDim,
 su2_adtPointsOnlyClass::su2_adtPointsOnlyClass(unsigned short      nDim,
                                                unsigned long       nPoints,
                                                const su2double     *coor,
-                                               const unsigned long *pointID) {
+                                               const unsigned long *pointID,
+                                               const bool          globalTree) {
 
   /*--- Make a distinction between parallel and sequential mode. ---*/
 
 #ifdef HAVE_MPI
 
-  /*--- Parallel mode. All points are gathered on all ranks. First determine the
-        number of points per rank and store them in such a way that the info can
-        be used directly in Allgatherv. For now, we will use the regular 
-        Allgather until we add Allgatherv to the SU2_MPI wrapper. ---*/
+  if (!globalTree) {
+
+    /*--- Local tree. Only the points of this rank are stored, the ranks
+          combine the results of their searches themselves. ---*/
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    coorPoints.assign(coor, coor + nDim*nPoints);
+    localPointIDs.assign(pointID, pointID + nPoints);
+    ranksOfPoints.assign(nPoints, rank);
+  }
+  else {
+
+    /*--- Parallel mode. All points are gathered on all ranks. First determine the
+          number of points per rank and store them in such a way that the info can
+          be used directly in Allgatherv. For now, we will use the regular 
+          Allgather until we add Allgatherv to the SU2_MPI wrapper. ---*/
   
-  int rank, iProcessor, nProcessor;
-  unsigned long  iVertex, nBuffer;
-  unsigned short iDim;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
+    int rank, iProcessor, nProcessor;
+    unsigned long  iVertex, nBuffer;
+    unsigned short iDim;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
   
-  unsigned long nLocalVertex = nPoints, nGlobalVertex = 0, MaxLocalVertex = 0;
+    unsigned long nLocalVertex = nPoints, nGlobalVertex = 0, MaxLocalVertex = 0;
   
-  unsigned long *Buffer_Send_nVertex    = new unsigned long [1];
-  unsigned long *Buffer_Receive_nVertex = new unsigned long [nProcessor];
+    unsigned long *Buffer_Send_nVertex    = new unsigned long [1];
+    unsigned long *Buffer_Receive_nVertex = new unsigned long [nProcessor];
 
-  Buffer_Send_nVertex[0] = nLocalVertex;
+    Buffer_Send_nVertex[0] = nLocalVertex;
   
-  SU2_MPI::Allreduce(&nLocalVertex, &nGlobalVertex, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&nLocalVertex, &MaxLocalVertex, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&nLocalVertex, &nGlobalVertex, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&nLocalVertex, &MaxLocalVertex, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
 
-  /*--- Gather the local pointID's and the ranks of the nodes on all ranks. ---*/
+    /*--- Gather the local pointID's and the ranks of the nodes on all ranks. ---*/
   
-  unsigned long *Buffer_Send = new unsigned long[MaxLocalVertex];
-  unsigned long *Buffer_Recv = new unsigned long[nProcessor*MaxLocalVertex];
+    unsigned long *Buffer_Send = new unsigned long[MaxLocalVertex];
+    unsigned long *Buffer_Recv = new unsigned long[nProcessor*MaxLocalVertex];
   
-  for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
-    Buffer_Send[iVertex] = pointID[iVertex];
-  }
+    for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
+      Buffer_Send[iVertex] = pointID[iVertex];
+    }
   
-  SU2_MPI::Allgather(Buffer_Send, MaxLocalVertex, MPI_UNSIGNED_LONG, Buffer_Recv, MaxLocalVertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(Buffer_Send, MaxLocalVertex, MPI_UNSIGNED_LONG, Buffer_Recv, MaxLocalVertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
   
-  /*--- Unpack the buffer into the local point ID vector. ---*/
+    /*--- Unpack the buffer into the local point ID vector. ---*/
   
-  localPointIDs.resize(nGlobalVertex);
+    localPointIDs.reserve(nGlobalVertex);
   
-  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-    for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
-      localPointIDs.push_back( Buffer_Recv[iProcessor*MaxLocalVertex + iVertex] );
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
+        localPointIDs.push_back( Buffer_Recv[iProcessor*MaxLocalVertex + iVertex] );
 
-  /*--- Now gather the ranks for all points ---*/
+    /*--- Now gather the ranks for all points ---*/
   
-  for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
-    Buffer_Send[iVertex] = (unsigned long) rank;
-  }
+    for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
+      Buffer_Send[iVertex] = (unsigned long) rank;
+    }
   
-  SU2_MPI::Allgather(Buffer_Send, MaxLocalVertex, MPI_UNSIGNED_LONG, Buffer_Recv, MaxLocalVertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(Buffer_Send, MaxLocalVertex, MPI_UNSIGNED_LONG, Buffer_Recv, MaxLocalVertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
   
-  /*--- Unpack the ranks into the vector and delete buffer memory. ---*/
+    /*--- Unpack the ranks into the vector and delete buffer memory. ---*/
   
-  ranksOfPoints.resize(nGlobalVertex);
+    ranksOfPoints.reserve(nGlobalVertex);
 
-  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-    for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
-      ranksOfPoints.push_back( Buffer_Recv[iProcessor*MaxLocalVertex + iVertex] );
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
+        ranksOfPoints.push_back( Buffer_Recv[iProcessor*MaxLocalVertex + iVertex] );
   
-  delete [] Buffer_Send;  delete [] Buffer_Recv;
+    delete [] Buffer_Send;  delete [] Buffer_Recv;
   
-  /*--- Gather the coordinates of the points on all ranks. ---*/
+    /*--- Gather the coordinates of the points on all ranks. ---*/
   
-  su2double *Buffer_Send_Coord = new su2double [MaxLocalVertex*nDim];
-  su2double *Buffer_Recv_Coord = new su2double [nProcessor*MaxLocalVertex*nDim];
+    su2double *Buffer_Send_Coord = new su2double [MaxLocalVertex*nDim];
+    su2double *Buffer_Recv_Coord = new su2double [nProcessor*MaxLocalVertex*nDim];
   
-  nBuffer = MaxLocalVertex*nDim;
+    nBuffer = MaxLocalVertex*nDim;
   
-  for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
-    for (iDim = 0; iDim < nDim; iDim++)
-    Buffer_Send_Coord[iVertex*nDim + iDim] = coor[iVertex*nDim + iDim];
-  }
+    for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
+      for (iDim = 0; iDim < nDim; iDim++)
+      Buffer_Send_Coord[iVertex*nDim + iDim] = coor[iVertex*nDim + iDim];
+    }
   
-  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer, MPI_DOUBLE, Buffer_Recv_Coord, nBuffer, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer, MPI_DOUBLE, Buffer_Recv_Coord, nBuffer, MPI_DOUBLE, MPI_COMM_WORLD);
   
-  /*--- Unpack the coordinates into the vector and delete buffer memory. ---*/
+    /*--- Unpack the coordinates into the vector and delete buffer memory. ---*/
   
-  coorPoints.resize(nDim*nGlobalVertex);
+    coorPoints.reserve(nDim*nGlobalVertex);
   
-  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-    for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
-      for (iDim = 0; iDim < nDim; iDim++)
-      coorPoints.push_back( Buffer_Recv_Coord[iProcessor*MaxLocalVertex*nDim + iVertex*nDim + iDim] );
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
+        for (iDim = 0; iDim < nDim; iDim++)
+        coorPoints.push_back( Buffer_Recv_Coord[iProcessor*MaxLocalVertex*nDim + iVertex*nDim + iDim] );
   
-  delete [] Buffer_Send_Coord;   delete [] Buffer_Recv_Coord;
-  delete [] Buffer_Send_nVertex; delete [] Buffer_Receive_nVertex;
+    delete [] Buffer_Send_Coord;   delete [] Buffer_Recv_Coord;
+    delete [] Buffer_Send_nVertex; delete [] Buffer_Receive_nVertex;
   
+  }
+
 #else
 
   /*--- Sequential mode. Copy the coordinates and point IDs and
@@ -476,3 +493,285 @@ void su2_adtPointsOnlyClass::DetermineNearestNode(const su2double *coor,
   AD::SetPreaccOut(dist);
   AD::EndPreacc();
 }
+
+su2_adtElemClass::su2_adtElemClass(unsigned short               val_nDim,
+                                   const vector<su2double>      &coor,
+                                   const vector<unsigned long>  &elemConn,
+                                   const vector<unsigned short> &elemVTK) {
+
+  /*--- Copy the data of the elements. Only the local elements are stored,
+        the distribution of the searches over the ranks is the responsibility
+        of the calling function. ---*/
+  nDim         = val_nDim;
+  coorPoints   = coor;
+  elemConns    = elemConn;
+  elemVTK_Type = elemVTK;
+
+  /*--- Determine the offsets of the elements in the connectivity. ---*/
+  const unsigned long nElem = elemVTK_Type.size();
+  nDOFsPerElem.resize(nElem+1);
+  nDOFsPerElem[0] = 0;
+
+  for(unsigned long i=0; i<nElem; ++i) {
+    unsigned short nDOFs = 0;
+    switch( elemVTK_Type[i] ) {
+      case LINE:          nDOFs = 2; break;
+      case TRIANGLE:      nDOFs = 3; break;
+      case QUADRILATERAL: nDOFs = 4; break;
+      default:
+        cout << "Unsupported surface element type " << elemVTK_Type[i]
+             << " in su2_adtElemClass." << endl;
+#ifndef HAVE_MPI
+        exit(EXIT_FAILURE);
+#else
+        MPI_Abort(MPI_COMM_WORLD,1);
+        MPI_Finalize();
+#endif
+    }
+    nDOFsPerElem[i+1] = nDOFsPerElem[i] + nDOFs;
+  }
+
+  /*--- Determine the bounding boxes of the elements. The minimum and maximum
+        coordinates are stored consecutively, such that the bounding boxes
+        can be stored in an ADT of 2*nDim dimensions. ---*/
+  BBoxCoor.resize(2*nDim*nElem);
+
+  for(unsigned long i=0; i<nElem; ++i) {
+    su2double *BBox = BBoxCoor.data() + 2*nDim*i;
+
+    unsigned long ll = nDim*elemConns[nDOFsPerElem[i]];
+    for(unsigned short l=0; l<nDim; ++l)
+      BBox[l] = BBox[l+nDim] = coorPoints[ll+l];
+
+    for(unsigned long j=(nDOFsPerElem[i]+1); j<nDOFsPerElem[i+1]; ++j) {
+      ll = nDim*elemConns[j];
+      for(unsigned short l=0; l<nDim; ++l) {
+        BBox[l]      = min(BBox[l],      coorPoints[ll+l]);
+        BBox[l+nDim] = max(BBox[l+nDim], coorPoints[ll+l]);
+      }
+    }
+  }
+
+  /*--- Build the tree of the bounding boxes. ---*/
+  BuildADT(2*nDim, nElem, BBoxCoor.data());
+
+  /*--- Reserve the memory for frontLeaves and frontLeavesNew, which are
+        needed during the tree search. Every thread gets its own vectors. ---*/
+  int nThreads = 1;
+#ifdef HAVE_OMP
+  nThreads = omp_get_max_threads();
+#endif
+
+  frontLeaves.resize(nThreads);
+  frontLeavesNew.resize(nThreads);
+  for(int i=0; i<nThreads; ++i) {
+    frontLeaves[i].reserve(200);
+    frontLeavesNew[i].reserve(200);
+  }
+}
+
+void su2_adtElemClass::GetBoundingBox(su2double *xMin,
+                                      su2double *xMax) const {
+
+  /*--- The root leaf contains all bounding boxes. The minimum of the lower
+        and the maximum of the upper coordinates form the bounding box. ---*/
+  for(unsigned short l=0; l<nDim; ++l) {
+    xMin[l] = leaves[0].xMin[l];
+    xMax[l] = leaves[0].xMax[l+nDim];
+  }
+}
+
+void su2_adtElemClass::DetermineNearestElement(const su2double *coor,
+                                               su2double       &dist,
+                                               unsigned long   &elemID) {
+
+  AD::StartPreacc();
+  AD::SetPreaccIn(coor, nDim);
+
+  /*--- Select the traversal vectors of this thread. ---*/
+  int thread = 0;
+#ifdef HAVE_OMP
+  thread = omp_get_thread_num();
+#endif
+
+  vector<unsigned long> &front    = frontLeaves[thread];
+  vector<unsigned long> &frontNew = frontLeavesNew[thread];
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Initialize the nearest element to the central element of   ---*/
+  /*---         the root leaf. Note that the distance is the distance      ---*/
+  /*---         squared to avoid a sqrt.                                   ---*/
+  /*--------------------------------------------------------------------------*/
+
+  elemID = leaves[0].centralNodeID;
+  dist   = Dist2ToElement(coor, elemID);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Traverse the tree. A leaf or an element is only considered ---*/
+  /*---         if the minimum possible distance squared to its bounding   ---*/
+  /*---         box is less than the currently stored distance squared.    ---*/
+  /*--------------------------------------------------------------------------*/
+
+  front.clear();
+  front.push_back(0);
+
+  for(;;) {
+
+    frontNew.clear();
+
+    /* Loop over the leaves of the current front and their children. */
+    for(unsigned long i=0; i<front.size(); ++i) {
+      const unsigned long ll = front[i];
+      for(unsigned short mm=0; mm<2; ++mm) {
+
+        /*--- Determine the bounding box of the child, which is either the
+              bounding box of an element or of a leaf of the next level. ---*/
+        const unsigned long kk = leaves[ll].children[mm];
+        const bool terminal    = leaves[ll].childrenAreTerminal[mm];
+
+        const su2double *BBoxMin, *BBoxMax;
+        if( terminal ) {
+          BBoxMin = BBoxCoor.data() + 2*nDim*kk;
+          BBoxMax = BBoxMin + nDim;
+        }
+        else {
+          BBoxMin = leaves[kk].xMin;
+          BBoxMax = leaves[kk].xMax + nDim;
+        }
+
+        su2double posDist = 0.0;
+        for(unsigned short l=0; l<nDim; ++l) {
+          su2double ds = 0.0;
+          if(     coor[l] < BBoxMin[l]) ds = coor[l] - BBoxMin[l];
+          else if(coor[l] > BBoxMax[l]) ds = coor[l] - BBoxMax[l];
+
+          posDist += ds*ds;
+        }
+
+        if(posDist >= dist) continue;
+
+        /*--- The child may contain a nearer element. For an element the
+              distance is computed, for a leaf it is stored for the next
+              round and the distance to its central element is used to
+              update the currently stored value. ---*/
+        const unsigned long jj = terminal ? kk : leaves[kk].centralNodeID;
+        if( !terminal ) frontNew.push_back(kk);
+
+        const su2double distTarget = Dist2ToElement(coor, jj);
+        if(distTarget < dist) {
+          dist   = distTarget;
+          elemID = jj;
+        }
+      }
+    }
+
+    /* Continue with the new front, the tree has been traversed when it is empty. */
+    front.swap(frontNew);
+    if(front.size() == 0) break;
+  }
+
+  /* Take the sqrt of the distance squared to the nearest element. */
+  dist = sqrt(dist);
+
+  AD::SetPreaccOut(dist);
+  AD::EndPreacc();
+}
+
+su2double su2_adtElemClass::Dist2ToElement(const su2double *coor,
+                                           const unsigned long elemID) const {
+
+  const unsigned long *conn = elemConns.data() + nDOFsPerElem[elemID];
+  const su2double *x0 = coorPoints.data() + nDim*conn[0];
+  const su2double *x1 = coorPoints.data() + nDim*conn[1];
+
+  switch( elemVTK_Type[elemID] ) {
+    case LINE:
+      return Dist2ToSegment(coor, x0, x1);
+
+    case TRIANGLE:
+      return Dist2ToTriangle(coor, x0, x1, coorPoints.data() + nDim*conn[2]);
+
+    case QUADRILATERAL: {
+
+      /* Split the quadrilateral into two triangles. */
+      const su2double *x2 = coorPoints.data() + nDim*conn[2];
+      const su2double *x3 = coorPoints.data() + nDim*conn[3];
+      return min(Dist2ToTriangle(coor, x0, x1, x2),
+                 Dist2ToTriangle(coor, x0, x2, x3));
+    }
+  }
+
+  return 0.0;
+}
+
+su2double su2_adtElemClass::Dist2ToSegment(const su2double *coor,
+                                           const su2double *x0,
+                                           const su2double *x1) const {
+
+  /*--- Determine the parametric coordinate of the projection of the point
+        on the line through the segment and clip it to the segment. ---*/
+  su2double dot = 0.0, len2 = 0.0;
+  for(unsigned short l=0; l<nDim; ++l) {
+    const su2double ds = x1[l] - x0[l];
+    dot  += ds*(coor[l] - x0[l]);
+    len2 += ds*ds;
+  }
+
+  su2double t = 0.0;
+  if(len2 > 0.0) t = min(max(dot/len2, su2double(0.0)), su2double(1.0));
+
+  su2double dist = 0.0;
+  for(unsigned short l=0; l<nDim; ++l) {
+    const su2double ds = coor[l] - x0[l] - t*(x1[l] - x0[l]);
+    dist += ds*ds;
+  }
+
+  return dist;
+}
+
+su2double su2_adtElemClass::Dist2ToTriangle(const su2double *coor,
+                                            const su2double *x0,
+                                            const su2double *x1,
+                                            const su2double *x2) const {
+
+  /*--- Determine the region of the point with respect to the triangle in
+        terms of the barycentric coordinates of its projection. If the
+        projection is outside the triangle, the nearest point is a node or
+        is on an edge. ---*/
+  su2double d1 = 0.0, d2 = 0.0, d3 = 0.0, d4 = 0.0, d5 = 0.0, d6 = 0.0;
+  for(unsigned short l=0; l<3; ++l) {
+    const su2double a = x1[l] - x0[l], b = x2[l] - x0[l];
+    d1 += a*(coor[l] - x0[l]); d2 += b*(coor[l] - x0[l]);
+    d3 += a*(coor[l] - x1[l]); d4 += b*(coor[l] - x1[l]);
+    d5 += a*(coor[l] - x2[l]); d6 += b*(coor[l] - x2[l]);
+  }
+
+  if(d1 <= 0.0 && d2 <= 0.0) return Dist2ToSegment(coor, x0, x0);
+  if(d3 >= 0.0 && d4 <= d3)  return Dist2ToSegment(coor, x1, x1);
+  if(d6 >= 0.0 && d5 <= d6)  return Dist2ToSegment(coor, x2, x2);
+
+  const su2double vc = d1*d4 - d3*d2;
+  if(vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) return Dist2ToSegment(coor, x0, x1);
+
+  const su2double vb = d5*d2 - d1*d6;
+  if(vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) return Dist2ToSegment(coor, x0, x2);
+
+  const su2double va = d3*d6 - d5*d4;
+  if(va <= 0.0 && (d4-d3) >= 0.0 && (d5-d6) >= 0.0) return Dist2ToSegment(coor, x1, x2);
+
+  /*--- The projection is inside the triangle. A degenerate triangle
+        can only end up here through round off, use its edges. ---*/
+  const su2double denom = va + vb + vc;
+  if(denom <= 0.0)
+    return min(Dist2ToSegment(coor, x0, x1), Dist2ToSegment(coor, x1, x2));
+
+  const su2double v = vb/denom, w = vc/denom;
+
+  su2double dist = 0.0;
+  for(unsigned short l=0; l<3; ++l) {
+    const su2double ds = coor[l] - x0[l] - v*(x1[l] - x0[l]) - w*(x2[l] - x0[l]);
+    dist += ds*ds;
+  }
+
+  return dist;
+}
@@ -110,6 +110,12 @@ CConfig::CConfig(char case_filename[MAX_STRING_SIZE], CConfig *config) {
 }
 
 void CConfig::SetPointersNull(void) {
+  
+  /*--- The timing history starts with the first iteration ---*/
+  
+  for (unsigned short iPhase = 0; iPhase < N_TIMING_PHASES; iPhase++) Phase_Time[iPhase] = 0.0;
+  Phase_Start = 0.0; Current_Phase = PHASE_OTHER; Wrt_Timing_History = false;
+  
   Marker_CfgFile_Out_1D=NULL;       Marker_All_Out_1D=NULL;
   Marker_CfgFile_GeoEval=NULL;      Marker_All_GeoEval=NULL;
   Marker_CfgFile_Monitoring=NULL;   Marker_All_Monitoring=NULL;
@@ -122,6 +128,7 @@ void CConfig::SetPointersNull(void) {
   
   Marker_DV=NULL;  Marker_Moving=NULL;  Marker_Monitoring=NULL;
   Marker_Designing=NULL;  Marker_GeoEval=NULL;  Marker_Plotting=NULL;
+  Marker_FastOutput=NULL;
   Marker_CfgFile_KindBC=NULL;       Marker_All_KindBC=NULL;
   /*--- Marker Pointers ---*/
 
@@ -194,6 +201,7 @@ void CConfig::SetPointersNull(void) {
   Plunging_Omega_X = NULL;    Plunging_Omega_Y = NULL;    Plunging_Omega_Z = NULL;
   Plunging_Ampl_X = NULL;     Plunging_Ampl_Y = NULL;     Plunging_Ampl_Z = NULL;
   RefOriginMoment_X = NULL;   RefOriginMoment_Y = NULL;   RefOriginMoment_Z = NULL;
+  Probe_Coords = NULL;        Plane_Sample = NULL;        Restart_Compression_Tol = NULL;
   MoveMotion_Origin = NULL;
 
   /*--- Initialize some default arrays to NULL. ---*/
@@ -655,6 +663,16 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Store the Jacobian and the ILU preconditioner in single precision, vectors and the sums of the products remain in double precision */
+  addBoolOption("LINEAR_SOLVER_MIXED_PRECISION", Linear_Solver_Mixed_Precision, false);
+  /* DESCRIPTION: Maximum number of levels of the AMG preconditioner, including the fine level */
+  addUnsignedShortOption("AMG_LEVELS", AMG_Levels, 10);
+  /* DESCRIPTION: Smoother of the AMG preconditioner (JACOBI, ILU0) */
+  addEnumOption("AMG_SMOOTHER", Kind_AMG_Smoother, Linear_Solver_Prec_Map, JACOBI);
+  /* DESCRIPTION: Number of smoothing sweeps of the AMG preconditioner before the coarse grid correction */
+  addUnsignedShortOption("AMG_PRE_SMOOTH", AMG_PreSmooth, 1);
+  /* DESCRIPTION: Number of smoothing sweeps of the AMG preconditioner after the coarse grid correction */
+  addUnsignedShortOption("AMG_POST_SMOOTH", AMG_PostSmooth, 1);
   /* DESCRIPTION: Relaxation of the flow equations solver for the implicit formulation */
   addDoubleOption("RELAXATION_FACTOR_FLOW", Relaxation_Factor_Flow, 1.0);
   /* DESCRIPTION: Relaxation of the turb equations solver for the implicit formulation */
@@ -743,6 +761,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_AGGLOMERATION_REUSE\n DESCRIPTION: Read the agglomeration of the coarse levels from a previous run on the same grid and markers, or store it for the next runs (the agglomeration sweep itself is serial on each partition). DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_AGGLOMERATION_REUSE", MG_Agglomeration_Reuse, false);
+  /*!\brief MG_AGGLOMERATION_FILENAME\n DESCRIPTION: Agglomeration file of the coarse levels (one per partition and level). DEFAULT: mg_agglomeration.dat \ingroup Config*/
+  addStringOption("MG_AGGLOMERATION_FILENAME", MG_Agglomeration_FileName, string("mg_agglomeration.dat"));
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -879,6 +901,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Mesh output file format, SU2_BINARY converts a mesh to the binary native format \n OPTIONS: SU2, SU2_BINARY \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
 
   /*!\brief CONV_FILENAME \n DESCRIPTION: Output file convergence history (w/o extension) \n DEFAULT: history \ingroup Config*/
   addStringOption("CONV_FILENAME", Conv_FileName, string("history"));
@@ -971,6 +995,39 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief LOW_MEMORY_OUTPUT
    *  \n DESCRIPTION: Output less information for lower memory use.  \ingroup Config*/
   addBoolOption("LOW_MEMORY_OUTPUT", Low_MemoryOutput, false);
+  /*!\brief WRT_BINARY_RESTART
+   *  \n DESCRIPTION: Write the restart files in binary format, in parallel with MPI-IO  \ingroup Config*/
+  addBoolOption("WRT_BINARY_RESTART", Wrt_Binary_Restart, false);
+  /*!\brief WRT_ASYNC_OUTPUT
+   *  \n DESCRIPTION: Write the binary restart and the parallel Paraview files in the background  \ingroup Config*/
+  addBoolOption("WRT_ASYNC_OUTPUT", Wrt_Async_Output, false);
+  /*!\brief WRT_COMPRESSED_RESTART
+   *  \n DESCRIPTION: Write the restart files in the compressed binary format, in parallel with MPI-IO  \ingroup Config*/
+  addBoolOption("WRT_COMPRESSED_RESTART", Wrt_Compressed_Restart, false);
+  /*!\brief RESTART_COMPRESSION_TOL
+   *  \n DESCRIPTION: Absolute error tolerance of each field of the compressed restart (0 is lossless)  \ingroup Config*/
+  addDoubleListOption("RESTART_COMPRESSION_TOL", nRestart_Compression_Tol, Restart_Compression_Tol);
+  /*!\brief WRT_TIMING_HISTORY
+   *  \n DESCRIPTION: Write the history with the wall time of the phases of the iterations  \ingroup Config*/
+  addBoolOption("WRT_TIMING_HISTORY", Wrt_Timing_History, false);
+  /*!\brief TIMING_FILENAME
+   *  \n DESCRIPTION: Output file of the timing history (w/o extension)  \ingroup Config*/
+  addStringOption("TIMING_FILENAME", Timing_FileName, string("history_timing"));
+  /*!\brief MARKER_FAST_OUTPUT
+   *  \n DESCRIPTION: Marker(s) of the surface written by every rank in the binary stream of the fast output  \ingroup Config*/
+  addStringListOption("MARKER_FAST_OUTPUT", nMarker_FastOutput, Marker_FastOutput);
+  /*!\brief PROBE_COORDS
+   *  \n DESCRIPTION: Coordinates of the probes of the fast output (x, y, z per probe)  \ingroup Config*/
+  addDoubleListOption("PROBE_COORDS", nProbe_Coords, Probe_Coords);
+  /*!\brief PLANE_SAMPLE
+   *  \n DESCRIPTION: Sampling planes of the fast output (x, y, z of the origin and of the normal per plane)  \ingroup Config*/
+  addDoubleListOption("PLANE_SAMPLE", nPlane_Sample, Plane_Sample);
+  /*!\brief FAST_OUTPUT_FREQ
+   *  \n DESCRIPTION: Writing frequency of the fast output  \ingroup Config*/
+  addUnsignedLongOption("FAST_OUTPUT_FREQ", FastOutput_Freq, 1);
+  /*!\brief FAST_OUTPUT_FILENAME
+   *  \n DESCRIPTION: Output files of the fast output (w/o extension)  \ingroup Config*/
+  addStringOption("FAST_OUTPUT_FILENAME", FastOutput_FileName, string("fast_output"));
   /*!\brief WRT_VOL_SOL
    *  \n DESCRIPTION: Write a volume solution file  \ingroup Config*/
   addBoolOption("WRT_VOL_SOL", Wrt_Vol_Sol, true);
@@ -1428,6 +1485,18 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Node number for the CV to be visualized */
   addLongOption("VISUALIZE_CV", Visualize_CV, -1);
 
+  /*!\par CONFIG_CATEGORY: Grid ordering \ingroup Config*/
+  /*--- options related to the ordering of the points and edges ---*/
+
+  /*!\brief POINT_ORDERING \n DESCRIPTION: Renumbering of the points of the grid \n OPTIONS: see \link Point_Ordering_Map \endlink \n DEFAULT: RCM \ingroup Config*/
+  addEnumOption("POINT_ORDERING", Kind_Point_Ordering, Point_Ordering_Map, RCM_ORDERING);
+  /* DESCRIPTION: Build a coloring of the edges for conflict-free parallel edge loops */
+  addBoolOption("EDGE_COLORING", Edge_Coloring, false);
+  /* DESCRIPTION: Number of consecutive edges colored together */
+  addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", Edge_Coloring_GroupSize, 512);
+  /* DESCRIPTION: Compute the convective fluxes of blocks of edges with the batched numerics (ignored in the AD builds) */
+  addBoolOption("EDGE_BLOCK_NUMERICS", Edge_Block_Numerics, false);
+
   /*!\par CONFIG_CATEGORY: Inverse design problem \ingroup Config*/
   /*--- options related to inverse design problem ---*/
 
@@ -1524,6 +1593,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
 
   addDoubleOption("PENAL", Penal, 3.0);
   addDoubleOption("EMIN", Emin, 1E-3);
+  /* DESCRIPTION: Cache the element stiffness blocks of linear elastic problems and only rescale them with the SIMP factor */
+  addBoolOption("STIFFNESS_CACHE", FEA_StiffnessCache, false);
   addUnsignedLongOption("NELEMX", NElemx, 52);
   addUnsignedLongOption("NELEMY", NElemy, 12);
 
@@ -1533,6 +1604,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("OS_STEP_SIZE", OneShotStepSize, 1E-4);
   addBoolOption("OS_CONSTRAINT", OneShotConstraint, false);
   addUnsignedLongOption("OS_STOP", OneShotStop, 2000);
+  /* DESCRIPTION: Number of (s,y) pairs kept by the limited-memory BFGS preconditioner (0 keeps the dense BFGS matrix) */
+  addUnsignedShortOption("OS_LBFGS_MEMORY", OneShotLBFGSMemory, 0);
   addDoubleOption("STEP_TOL", StepTolerance, 1E-3);
   addDoubleOption("CONS_START", ConstraintStart, 0.0);
   addUnsignedShortOption("CONS_NUM", ConstraintNum, 1);
@@ -1542,6 +1615,14 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("TARGET_VOLUME", VolumeConstraint, 0.5);
   addDoubleOption("TARGET_STRESS", StressConstraint, 0.5);
     addDoubleOption("HELMH_FACTOR", HelmholtzFactor, 2.0);
+  /* DESCRIPTION: Use the block-tridiagonal Helmholtz filter on a structured NELEMX x NELEMY rectangle (default), NO for the unstructured PDE filter */
+  addBoolOption("HELMH_STRUCTURED", HelmholtzStructured, true);
+  /* DESCRIPTION: Residual reduction of the CG solve of the unstructured Helmholtz filter */
+  addDoubleOption("HELMH_LINEAR_SOLVER_ERROR", HelmholtzLinSolverError, 1E-10);
+  /* DESCRIPTION: Maximum number of CG iterations of the unstructured Helmholtz filter */
+  addUnsignedLongOption("HELMH_LINEAR_SOLVER_ITER", HelmholtzLinSolverIter, 500);
+  /* DESCRIPTION: Preconditioner of the CG solve of the unstructured Helmholtz filter (JACOBI, AMG) */
+  addEnumOption("HELMH_LINEAR_SOLVER_PREC", Kind_HelmholtzLinSolver_Prec, Linear_Solver_Prec_Map, JACOBI);
   addDoubleOption("FDSTEP", FDStep, 1E-5);
   addUnsignedLongOption("LINE_SEARCH_COUNTER", SearchCounterMax, 15);
   
@@ -1756,6 +1837,40 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 #endif
   
+  /*--- The parallel Paraview and XDMF writers are available in SU2_CFD for the flow, adjoint flow
+   and FEM solvers, otherwise the solution is merged and written in Paraview ASCII. ---*/
+  
+  if (((Output_FileFormat == PARAVIEW_BINARY) || (Output_FileFormat == XDMF)) &&
+      ((val_software != SU2_CFD) ||
+       ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS) &&
+        (Kind_Solver != ADJ_EULER) && (Kind_Solver != ADJ_NAVIER_STOKES) && (Kind_Solver != ADJ_RANS) &&
+        (Kind_Solver != DISC_ADJ_EULER) && (Kind_Solver != DISC_ADJ_NAVIER_STOKES) && (Kind_Solver != DISC_ADJ_RANS) &&
+        (Kind_Solver != FEM_ELASTICITY)))) {
+    Output_FileFormat = PARAVIEW;
+  }
+  
+  /*--- The probes and the sampling planes of the fast output are given in 3D ---*/
+  
+  if ((nProbe_Coords % 3 != 0) || (nPlane_Sample % 6 != 0)) {
+    cout << "PROBE_COORDS needs 3 values per probe and PLANE_SAMPLE 6 values per plane!!" << endl;
+    exit(EXIT_FAILURE);
+  }
+  if (FastOutput_Freq == 0) FastOutput_Freq = 1;
+  
+  for (unsigned short iTol = 0; iTol < nRestart_Compression_Tol; iTol++) {
+    if (Restart_Compression_Tol[iTol] < 0.0) {
+      cout << "The values of RESTART_COMPRESSION_TOL must be positive (or 0 for no loss)!!" << endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  
+  /*--- The fast output is available in SU2_CFD for the direct flow solvers ---*/
+  
+  if ((val_software != SU2_CFD) ||
+      ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS))) {
+    nMarker_FastOutput = 0; nProbe_Coords = 0; nPlane_Sample = 0;
+  }
+  
   /*--- Store the SU2 module that we are executing. ---*/
   
   Kind_SU2 = val_software;
@@ -2759,6 +2874,11 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
 
 #if defined CODI_REVERSE_TYPE
   AD_Mode = YES;
+
+  /*--- The batched flux kernels do not preaccumulate the edges as the scalar
+   numerics do, the tape would be much larger, the scalar path is used ---*/
+
+  Edge_Block_Numerics = false;
 #else
   if (AD_Mode == YES){
     cout << "AUTO_DIFF=YES requires Automatic Differentiation support." << endl;
@@ -3920,6 +4040,16 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
+            case FGMRES_CGS:
+              cout << "FGMRES with classical Gram-Schmidt is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
+            case PIPELINED_CG:
+              cout << "A pipelined Conjugate Gradient method is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
             case SMOOTHER_JACOBI:
               cout << "A Jacobi method is used for smoothing the linear system." << endl;
               break;
@@ -3958,6 +4088,16 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
+            case FGMRES_CGS:
+              cout << "FGMRES with classical Gram-Schmidt is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
+            case PIPELINED_CG:
+              cout << "A pipelined Conjugate Gradient method is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
             case CONJUGATE_GRADIENT:
               cout << "A Conjugate Gradient method is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
@@ -4132,6 +4272,10 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
   if (val_software == SU2_CFD) {
 
     if (Low_MemoryOutput) cout << "Writing output files with low memory RAM requirements."<< endl;
+    if (Wrt_Compressed_Restart) cout << "Writing compressed binary restart files."<< endl;
+    else if (Wrt_Binary_Restart) cout << "Writing binary restart files."<< endl;
+    if (Wrt_Async_Output) cout << "Writing the rank-local output files in the background."<< endl;
+    if (Wrt_Timing_History) cout << "Timing history file name: " << Timing_FileName << "." << endl;
     cout << "Writing a flow solution every " << Wrt_Sol_Freq <<" iterations."<< endl;
     cout << "Writing the convergence history every " << Wrt_Con_Freq <<" iterations."<< endl;
     if ((Unsteady_Simulation == DT_STEPPING_1ST) || (Unsteady_Simulation == DT_STEPPING_2ND)) {
@@ -4141,6 +4285,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
 
     switch (Output_FileFormat) {
       case PARAVIEW: cout << "The output file format is Paraview ASCII (.vtk)." << endl; break;
+      case PARAVIEW_BINARY: cout << "The output file format is Paraview XML binary, one piece per rank (.vtu, .pvtu)." << endl; break;
+      case XDMF: cout << "The output file format is XDMF with raw binary data (.xmf, .bin)." << endl; break;
       case TECPLOT: cout << "The output file format is Tecplot ASCII (.dat)." << endl; break;
       case TECPLOT_BINARY: cout << "The output file format is Tecplot binary (.plt)." << endl; break;
       case FIELDVIEW: cout << "The output file format is FieldView ASCII (.uns)." << endl; break;
@@ -4185,6 +4331,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
     if (Low_MemoryOutput) cout << "Writing output files with low memory RAM requirements."<< endl;
     switch (Output_FileFormat) {
       case PARAVIEW: cout << "The output file format is Paraview ASCII (.vtk)." << endl; break;
+      case PARAVIEW_BINARY: cout << "The output file format is Paraview XML binary, one piece per rank (.vtu, .pvtu)." << endl; break;
+      case XDMF: cout << "The output file format is XDMF with raw binary data (.xmf, .bin)." << endl; break;
       case TECPLOT: cout << "The output file format is Tecplot ASCII (.dat)." << endl; break;
       case TECPLOT_BINARY: cout << "The output file format is Tecplot binary (.plt)." << endl; break;
       case FIELDVIEW: cout << "The output file format is FieldView ASCII (.uns)." << endl; break;
@@ -4872,6 +5020,9 @@ CConfig::~CConfig(void) {
   
   if (RefOriginMoment   != NULL) delete [] RefOriginMoment;
   if (RefOriginMoment_X != NULL) delete [] RefOriginMoment_X;
+  if (Probe_Coords != NULL) delete [] Probe_Coords;
+  if (Plane_Sample != NULL) delete [] Plane_Sample;
+  if (Restart_Compression_Tol != NULL) delete [] Restart_Compression_Tol;
   if (RefOriginMoment_Y != NULL) delete [] RefOriginMoment_Y;
   if (RefOriginMoment_Z != NULL) delete [] RefOriginMoment_Z;
 
@@ -4916,6 +5067,7 @@ CConfig::~CConfig(void) {
   if (Marker_Designing != NULL)       delete[] Marker_Designing;
   if (Marker_GeoEval != NULL)         delete[] Marker_GeoEval;
   if (Marker_Plotting != NULL)        delete[] Marker_Plotting;
+  if (Marker_FastOutput != NULL)      delete[] Marker_FastOutput;
   if (Marker_FSIinterface != NULL)        delete[] Marker_FSIinterface;
   if (Marker_All_SendRecv != NULL)    delete[] Marker_All_SendRecv;
   if (DV_Value != NULL) {
@@ -5915,3 +6067,46 @@ su2double CConfig::GetSpline(vector<su2double>&xa, vector<su2double>&ya, vector<
 
   return y;
 }
+
+unsigned short CConfig::Start_Phase(unsigned short val_phase) {
+  
+  if (!Wrt_Timing_History) return Current_Phase;
+  
+  /*--- The halo exchange may be completed by a thread of an edge loop,
+   that time stays in the phase of the loop ---*/
+  
+#ifdef HAVE_OMP
+  if (omp_in_parallel()) return Current_Phase;
+#endif
+  
+  passivedouble Time = GetWall_Time();
+  unsigned short Previous_Phase = Current_Phase;
+  
+  Phase_Time[Current_Phase] += Time - Phase_Start;
+  Phase_Start = Time;
+  Current_Phase = val_phase;
+  
+  return Previous_Phase;
+  
+}
+
+void CConfig::Reset_Phase_Time(void) {
+  
+  Phase_Start = GetWall_Time();
+  for (unsigned short iPhase = 0; iPhase < N_TIMING_PHASES; iPhase++) Phase_Time[iPhase] = 0.0;
+  
+}
+
+passivedouble CConfig::GetWall_Time(void) {
+  
+  /*--- The CPU time of clock() would add up the threads ---*/
+  
+#if defined HAVE_OMP
+  return omp_get_wtime();
+#elif defined HAVE_MPI
+  return MPI_Wtime();
+#else
+  return passivedouble(clock())/passivedouble(CLOCKS_PER_SEC);
+#endif
+  
+}
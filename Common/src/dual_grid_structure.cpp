@@ -48,6 +48,7 @@ CPoint::CPoint(unsigned short val_nDim, unsigned long val_globalindex, CConfig *
   
   Volume = NULL;  Vertex = NULL;
 	Coord = NULL; Coord_Old = NULL; Coord_Sum = NULL;
+  Contiguous = false;
 	Coord_n = NULL; Coord_n1 = NULL;  Coord_p1 = NULL;
 	GridVel = NULL; GridVel_Grad = NULL;
 
@@ -136,6 +137,7 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, unsigned long val_g
   
   Volume = NULL;  Vertex = NULL;
 	Coord = NULL; Coord_Old = NULL; Coord_Sum = NULL;
+  Contiguous = false;
 	Coord_n = NULL; Coord_n1 = NULL;  Coord_p1 = NULL;
 	GridVel = NULL; GridVel_Grad = NULL;
 
@@ -229,6 +231,7 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
   
 	Volume = NULL;  Vertex = NULL;
 	Coord = NULL; Coord_Old = NULL; Coord_Sum = NULL;
+  Contiguous = false;
 	Coord_n = NULL; Coord_n1 = NULL;  Coord_p1 = NULL;
 	GridVel = NULL; GridVel_Grad = NULL;
   
@@ -313,9 +316,9 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
 
 CPoint::~CPoint() {
   
-	if (Volume != NULL) delete[] Volume;
+	if (Volume != NULL && !Contiguous) delete[] Volume;
 	if (Vertex != NULL && Boundary) delete[] Vertex;
-	if (Coord != NULL) delete[] Coord;
+	if (Coord != NULL && !Contiguous) delete[] Coord;
 	if (Coord_Old != NULL) delete[] Coord_Old;
 	if (Coord_Sum != NULL) delete[] Coord_Sum;
 	if (Coord_n != NULL) delete[] Coord_n;
@@ -330,6 +333,22 @@ CPoint::~CPoint() {
   
 }
 
+void CPoint::SetContiguous_Storage(su2double *val_coord, su2double *val_volume, unsigned short val_nVolume) {
+  
+  unsigned short iDim, iVolume;
+  
+  /*--- Copy the current values, the storage is owned by the geometry ---*/
+  
+  for (iDim = 0; iDim < nDim; iDim++) val_coord[iDim] = Coord[iDim];
+  for (iVolume = 0; iVolume < val_nVolume; iVolume++) val_volume[iVolume] = Volume[iVolume];
+  
+  if (!Contiguous) { delete [] Coord; delete [] Volume; }
+  
+  Coord = val_coord; Volume = val_volume;
+  Contiguous = true;
+  
+}
+
 void CPoint::SetPoint(unsigned long val_point) {
 	unsigned short iPoint;
 	bool new_point;
@@ -383,6 +402,7 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
 	Coord_CG = new su2double[nDim];
 	Nodes = new unsigned long[2];
 	Normal = new su2double [nDim];
+  Contiguous = false;
 
 	/*--- Initializate the structure ---*/
   
@@ -399,8 +419,24 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
 CEdge::~CEdge() {
   
 	if (Coord_CG != NULL) delete[] Coord_CG;
-	if (Normal != NULL) delete[] Normal;
-	if (Nodes != NULL) delete[] Nodes;
+	if (Normal != NULL && !Contiguous) delete[] Normal;
+	if (Nodes != NULL && !Contiguous) delete[] Nodes;
+  
+}
+
+void CEdge::SetContiguous_Storage(unsigned long *val_nodes, su2double *val_normal) {
+  
+  unsigned short iDim;
+  
+  /*--- Copy the current values, the storage is owned by the geometry ---*/
+  
+  val_nodes[0] = Nodes[0]; val_nodes[1] = Nodes[1];
+  for (iDim = 0; iDim < nDim; iDim++) val_normal[iDim] = Normal[iDim];
+  
+  if (!Contiguous) { delete [] Nodes; delete [] Normal; }
+  
+  Nodes = val_nodes; Normal = val_normal;
+  Contiguous = true;
   
 }
 
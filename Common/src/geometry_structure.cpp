@@ -90,6 +90,24 @@ CGeometry::CGeometry(void) {
   ending_node   = NULL;
   npoint_procs  = NULL;
   
+  /*--- Contiguous storage of the dual grid (SetContiguous_Storage) ---*/
+  
+  Point_Coord         = NULL;
+  Point_Volume        = NULL;
+  Edge_Normal         = NULL;
+  Edge_Node           = NULL;
+  Point_Neighbor_Ptr  = NULL;
+  Point_Neighbor      = NULL;
+  Point_Neighbor_Edge = NULL;
+  nVolume_Point       = 1;
+  
+  nEdge_Color          = 0;
+  Edge_Color_GroupSize = 0;
+  Edge_Color_Ptr       = NULL;
+  Edge_Color_Group     = NULL;
+  
+  Coord_Version        = 0;
+  
 }
 
 CGeometry::~CGeometry(void) {
@@ -131,6 +149,16 @@ CGeometry::~CGeometry(void) {
       if (edge[iEdge] != NULL) delete edge[iEdge];
     delete[] edge;
   }
+  
+  if (Point_Coord         != NULL) delete [] Point_Coord;
+  if (Point_Volume        != NULL) delete [] Point_Volume;
+  if (Edge_Normal         != NULL) delete [] Edge_Normal;
+  if (Edge_Node           != NULL) delete [] Edge_Node;
+  if (Point_Neighbor_Ptr  != NULL) delete [] Point_Neighbor_Ptr;
+  if (Point_Neighbor      != NULL) delete [] Point_Neighbor;
+  if (Point_Neighbor_Edge != NULL) delete [] Point_Neighbor_Edge;
+  if (Edge_Color_Ptr      != NULL) delete [] Edge_Color_Ptr;
+  if (Edge_Color_Group    != NULL) delete [] Edge_Color_Group;
 
   if (vertex != NULL) {
     for (iMarker = 0; iMarker < nMarker; iMarker++) {
@@ -250,6 +278,109 @@ void CGeometry::SetEdges(void) {
     }
 }
 
+void CGeometry::SetContiguous_Storage(CConfig *config) {
+  
+  unsigned long iPoint, iEdge, iNeigh, nNeigh;
+  
+  /*--- The storage is built once, the values are updated in place
+   through the CPoint and CEdge accessors afterwards ---*/
+  
+  if (Point_Coord != NULL) return;
+  
+  nVolume_Point = (config->GetUnsteady_Simulation() == NO) ? 1 : 3;
+  
+  /*--- Coordinates and volumes of the points ---*/
+  
+  Point_Coord  = new su2double[nPoint*nDim];
+  Point_Volume = new su2double[nPoint*nVolume_Point];
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetContiguous_Storage(&Point_Coord[iPoint*nDim], &Point_Volume[iPoint*nVolume_Point], nVolume_Point);
+  
+  /*--- Nodes and normals of the edges ---*/
+  
+  Edge_Node   = new unsigned long[2*nEdge];
+  Edge_Normal = new su2double[nEdge*nDim];
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    edge[iEdge]->SetContiguous_Storage(&Edge_Node[2*iEdge], &Edge_Normal[iEdge*nDim]);
+  
+  /*--- Point to point adjacency (and the edge between the two points) in CSR format ---*/
+  
+  Point_Neighbor_Ptr = new unsigned long[nPoint+1];
+  Point_Neighbor_Ptr[0] = 0;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    Point_Neighbor_Ptr[iPoint+1] = Point_Neighbor_Ptr[iPoint] + node[iPoint]->GetnPoint();
+  
+  nNeigh = Point_Neighbor_Ptr[nPoint];
+  Point_Neighbor      = new unsigned long[nNeigh];
+  Point_Neighbor_Edge = new unsigned long[nNeigh];
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+      Point_Neighbor[Point_Neighbor_Ptr[iPoint]+iNeigh]      = node[iPoint]->GetPoint(iNeigh);
+      Point_Neighbor_Edge[Point_Neighbor_Ptr[iPoint]+iNeigh] = node[iPoint]->GetEdge(iNeigh);
+    }
+  }
+  
+}
+
+void CGeometry::SetEdge_Coloring(CConfig *config) {
+  
+  unsigned long iEdge, iGroup, nGroup, iPoint, iNode;
+  unsigned short iColor, Color;
+  vector<vector<bool> > Point_Color;
+  vector<unsigned short> Group_Color;
+  vector<unsigned long> Group_Point, Next;
+  bool Free;
+  
+  if (Edge_Color_Ptr != NULL) return;
+  
+  Edge_Color_GroupSize = max(config->GetEdge_Coloring_GroupSize(), (unsigned long)1);
+  nGroup = (nEdge+Edge_Color_GroupSize-1)/Edge_Color_GroupSize;
+  Group_Color.resize(nGroup);
+  
+  /*--- Greedy coloring of the groups, Point_Color[iColor][iPoint] is true
+   if a group of iColor already contains iPoint ---*/
+  
+  for (iGroup = 0; iGroup < nGroup; iGroup++) {
+    
+    Group_Point.clear();
+    for (iEdge = iGroup*Edge_Color_GroupSize; iEdge < min((iGroup+1)*Edge_Color_GroupSize, nEdge); iEdge++)
+      for (iNode = 0; iNode < 2; iNode++)
+        Group_Point.push_back(edge[iEdge]->GetNode(iNode));
+    
+    Color = Point_Color.size();
+    for (iColor = 0; iColor < Point_Color.size(); iColor++) {
+      Free = true;
+      for (iPoint = 0; iPoint < Group_Point.size(); iPoint++)
+        if (Point_Color[iColor][Group_Point[iPoint]]) { Free = false; break; }
+      if (Free) { Color = iColor; break; }
+    }
+    if (Color == Point_Color.size()) Point_Color.push_back(vector<bool>(nPoint, false));
+    
+    for (iPoint = 0; iPoint < Group_Point.size(); iPoint++)
+      Point_Color[Color][Group_Point[iPoint]] = true;
+    Group_Color[iGroup] = Color;
+    
+  }
+  
+  /*--- Groups sorted by color (CSR format), in increasing order within a color ---*/
+  
+  nEdge_Color = Point_Color.size();
+  Edge_Color_Ptr = new unsigned long[nEdge_Color+1];
+  Edge_Color_Group = new unsigned long[nGroup];
+  
+  for (iColor = 0; iColor <= nEdge_Color; iColor++) Edge_Color_Ptr[iColor] = 0;
+  for (iGroup = 0; iGroup < nGroup; iGroup++) Edge_Color_Ptr[Group_Color[iGroup]+1]++;
+  for (iColor = 0; iColor < nEdge_Color; iColor++) Edge_Color_Ptr[iColor+1] += Edge_Color_Ptr[iColor];
+  
+  Next.assign(Edge_Color_Ptr, Edge_Color_Ptr+nEdge_Color);
+  for (iGroup = 0; iGroup < nGroup; iGroup++)
+    Edge_Color_Group[Next[Group_Color[iGroup]]++] = iGroup;
+  
+}
+
 void CGeometry::SetFaces(void) {
   //	unsigned long iPoint, jPoint, iFace;
   //	unsigned short jNode, iNode;
@@ -875,6 +1006,100 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
 }
 
 
+void CGeometry::GetHalo_Points(CConfig *config, vector<bool> &Halo, bool val_periodic) {
+  
+  unsigned short iMarker, Rotation_Type, kind_SU2 = config->GetKind_SU2();
+  unsigned long iPoint, iVertex, iGlobal_Index, nAddedPeriodic = 0, maxAddedPeriodic = 0;
+  int rank = MASTER_NODE, size = SINGLE_NODE, iProcessor, SendRecv, RecvFrom;
+  bool notHalo, isPeriodic, addedPeriodic;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  /*--- Global index of the added periodic points (even rotation type), which
+   are removed from the output, gathered on all the ranks as when the
+   volumetric connectivity is merged. ---*/
+  
+  vector<unsigned long> Added_Periodic;
+  
+  if (val_periodic) {
+    
+    if (kind_SU2 != SU2_DEF) {
+      for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+        if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
+          SendRecv = config->GetMarker_All_SendRecv(iMarker);
+          for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+            Rotation_Type = vertex[iMarker][iVertex]->GetRotation_Type();
+            if ((Rotation_Type > 0) && (Rotation_Type % 2 == 0) && (SendRecv < 0))
+              Added_Periodic.push_back(node[vertex[iMarker][iVertex]->GetNode()]->GetGlobalIndex());
+          }
+        }
+      }
+    }
+    
+    nAddedPeriodic = Added_Periodic.size();
+    
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(&nAddedPeriodic, &maxAddedPeriodic, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+    
+    if (maxAddedPeriodic > 0) {
+      vector<unsigned long> Buffer_Send_AddedPeriodic(maxAddedPeriodic), Buffer_Recv_AddedPeriodic(size*maxAddedPeriodic);
+      vector<unsigned long> Buffer_Recv_nAddedPeriodic(size);
+      for (iPoint = 0; iPoint < nAddedPeriodic; iPoint++)
+        Buffer_Send_AddedPeriodic[iPoint] = Added_Periodic[iPoint];
+      SU2_MPI::Allgather(&nAddedPeriodic, 1, MPI_UNSIGNED_LONG,
+                         &Buffer_Recv_nAddedPeriodic[0], 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+      SU2_MPI::Allgather(&Buffer_Send_AddedPeriodic[0], maxAddedPeriodic, MPI_UNSIGNED_LONG,
+                         &Buffer_Recv_AddedPeriodic[0], maxAddedPeriodic, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+      Added_Periodic.clear();
+      for (iProcessor = 0; iProcessor < size; iProcessor++)
+        for (iPoint = 0; iPoint < Buffer_Recv_nAddedPeriodic[iProcessor]; iPoint++)
+          Added_Periodic.push_back(Buffer_Recv_AddedPeriodic[iProcessor*maxAddedPeriodic+iPoint]);
+    }
+#else
+    maxAddedPeriodic = nAddedPeriodic;
+#endif
+    
+    sort(Added_Periodic.begin(), Added_Periodic.end());
+    
+  }
+  
+  Halo.resize(nPoint);
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    Halo[iPoint] = !node[iPoint]->GetDomain();
+  
+  /*--- Of the overlapping halo cells only one copy is kept (the one of the
+   higher rank). With val_periodic, the periodic points that were part of the
+   original domain are kept as well (all of them for SU2_DEF), and the added
+   periodic points are removed. ---*/
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
+      SendRecv = config->GetMarker_All_SendRecv(iMarker);
+      RecvFrom = abs(SendRecv)-1;
+      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+        iPoint = vertex[iMarker][iVertex]->GetNode();
+        Rotation_Type = vertex[iMarker][iVertex]->GetRotation_Type();
+        
+        notHalo = ((Rotation_Type == 0) && (SendRecv < 0) && (rank > RecvFrom));
+        
+        isPeriodic = false; addedPeriodic = false;
+        if (val_periodic) {
+          isPeriodic = ((Rotation_Type > 0) && (SendRecv < 0) &&
+                        ((kind_SU2 == SU2_DEF) || (Rotation_Type % 2 == 1)));
+          iGlobal_Index = node[iPoint]->GetGlobalIndex();
+          addedPeriodic = binary_search(Added_Periodic.begin(), Added_Periodic.end(), iGlobal_Index);
+        }
+        
+        if ((notHalo || isPeriodic) && !addedPeriodic) Halo[iPoint] = false;
+      }
+    }
+  }
+  
+}
+
 void CGeometry::RegisterCoordinates(CConfig *config){
   unsigned short iDim;
   unsigned long iPoint;
@@ -1374,6 +1599,9 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
     case CGNS:
       Read_CGNS_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      Read_SU2_Binary_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
+      break;
     default:
       if (rank == MASTER_NODE) cout << "Unrecognized mesh format specified!" << endl;
 #ifndef HAVE_MPI
@@ -5886,74 +6114,26 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   
 }
 
-void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
-  
-  /*--- Original CGNS reader implementation by Thomas D. Economon,
-   Francisco Palacios. Improvements for mixed-element meshes generated
-   by ICEM added by Martin Spel (3D) & Shlomy Shitrit (2D), April 2014.
-   Parallel version by Thomas D. Economon, February 2015. ---*/
+void CPhysicalGeometry::Read_SU2_Binary_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
   
-#ifdef HAVE_CGNS
-    
-  string text_line, Marker_Tag;
-  ifstream mesh_file;
-  unsigned short VTK_Type = 0, iMarker = 0;
   unsigned short nMarker_Max = config->GetnMarker_Max();
-  unsigned long iPoint = 0, iProcessor = 0, ielem = 0, GlobalIndex = 0;
-  unsigned long globalOffset = 0;
+  unsigned long header[CSU2BinaryMesh::HEADER_SIZE];
+  unsigned long iPoint, iElem, iNode, iMarker, iElem_Bound, nNodes, VTK_Type, GlobalIndex;
+  unsigned long elem_begin, nElem_Slice, total_pt_accounted, rem_points, local_element_count;
+  unsigned long vnodes[N_POINTS_HEXAHEDRON];
+  unsigned long i;
+  int rank = MASTER_NODE, size = SINGLE_NODE, nOwner, iOwner, Owner[N_POINTS_HEXAHEDRON];
+  bool time_spectral = config->GetUnsteady_Simulation() == TIME_SPECTRAL;
+  const unsigned long size_ul = sizeof(unsigned long);
+  CSU2BinaryMesh::FileHandle mesh_file;
   nZone = val_nZone;
   
-  /*--- Local variables needed when calling the CGNS mid-level API. ---*/
-  
-  unsigned long vnodes_cgns[8] = {0,0,0,0,0,0,0,0};
-  su2double Coord_cgns[3] = {0.0,0.0,0.0};
-  int fn, nbases = 0, nzones = 0, ngrids = 0, ncoords = 0, nsections = 0;
-  int *vertices = NULL, *cells = NULL, nMarkers = 0, *boundVerts = NULL, npe;
-  int interiorElems = 0, totalVerts = 0;
-  int cell_dim = 0, phys_dim = 0, nbndry, parent_flag, file_type;
-  char basename[CGNS_STRING_SIZE], zonename[CGNS_STRING_SIZE];
-  char coordname[CGNS_STRING_SIZE];
-  cgsize_t* cgsize; cgsize = new cgsize_t[3];
-  ZoneType_t zonetype;
-  DataType_t datatype;
-  passivedouble** coordArray = NULL;
-  passivedouble*** gridCoords = NULL;
-  ElementType_t elemType;
-  cgsize_t range_min, range_max, startE, endE;
-  range_min = 1;
-  string currentElem;
-  int** elemTypeVTK = NULL;
-  int** elemIndex = NULL;
-  int** elemBegin = NULL;
-  int** elemEnd = NULL;
-  int** nElems = NULL;
-  cgsize_t**** connElems = NULL;
-  cgsize_t* connElemCGNS = NULL;
-  cgsize_t* connElemTemp = NULL;
-  cgsize_t ElementDataSize = 0;
-  cgsize_t* parentData = NULL;
-  int** dataSize = NULL;
-  bool** isInternal = NULL;
-  char*** sectionNames = NULL;
-  
-  /*--- Initialize counters for local/global points & elements ---*/
-  
-  int rank = MASTER_NODE;
-  int size = SINGLE_NODE;
 #ifdef HAVE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
-  unsigned long Local_nElem;
-  unsigned long Local_nElemTri, Local_nElemQuad, Local_nElemTet;
-  unsigned long Local_nElemHex, Local_nElemPrism, Local_nElemPyramid;
-  MPI_Request *send_req, *recv_req;
-  MPI_Status  status;
-  int ind;
+  int iProcessor;
 #endif
-  
-  /*--- Initialize counters for local/global points & elements ---*/
-  
-  Global_nPoint  = 0; Global_nPointDomain = 0; Global_nElem = 0;
+  Global_nPoint  = 0; Global_nPointDomain   = 0; Global_nElem = 0;
   nelem_edge     = 0; Global_nelem_edge     = 0;
   nelem_triangle = 0; Global_nelem_triangle = 0;
   nelem_quad     = 0; Global_nelem_quad     = 0;
@@ -5962,43 +6142,33 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
   nelem_prism    = 0; Global_nelem_prism    = 0;
   nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
   
-  /*--- Initialize some additional counters for the parallel partitioning ---*/
-  
-  unsigned long total_pt_accounted = 0;
-  unsigned long rem_points         = 0;
-  unsigned long element_count      = 0;
-  unsigned long element_remainder  = 0;
-  unsigned long total_elems        = 0;
-  
-  /*--- Allocate memory for the linear partitioning of the mesh. These
+  /*--- Allocate memory for the linear partition of the mesh. These
    arrays are the size of the number of ranks. ---*/
   
   starting_node = new unsigned long[size];
   ending_node   = new unsigned long[size];
   npoint_procs  = new unsigned long[size];
   
-  unsigned long *nPoint_Linear = new unsigned long[size+1];
-  unsigned long *nElem_Linear  = new unsigned long[size];
-  
-  unsigned long *elemB = new unsigned long[size];
-  unsigned long *elemE = new unsigned long[size];
-  
-  unsigned long *elemGlobalID = NULL;
-  
-  unsigned short *nPoinPerElem = NULL;
-  unsigned short *elemTypes = NULL;
+  /*--- Open the grid file, all ranks read the header ---*/
   
-  bool *isMixed = NULL;
+  if (!CSU2BinaryMesh::OpenFile(val_mesh_filename, mesh_file) ||
+      !CSU2BinaryMesh::ReadHeader(mesh_file, val_mesh_filename, header)) {
+    cout << "There is no binary mesh file (CPhysicalGeometry)!! " << val_mesh_filename << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
   
-  unsigned short connSize = 10;
+  /*--- The binary format holds a single zone ---*/
   
-  /*--- Check whether the supplied file is truly a CGNS file. ---*/
-  if (cg_is_cgns(val_mesh_filename.c_str(), &file_type) != CG_OK) {
-    if (rank == MASTER_NODE) {
-    printf( "\n\n   !!! Error !!!\n" );
-    printf( " %s is not a CGNS file.\n", val_mesh_filename.c_str());
-    printf( " Now exiting...\n\n");
-    }
+  if (time_spectral) {
+    if (rank == MASTER_NODE) cout << "Reading time spectral instance " << val_iZone+1 << ":" << endl;
+  }
+  else if (val_nZone > 1) {
+    if (rank == MASTER_NODE) cout << "Multiple zones are not supported by the binary mesh format!!" << endl;
 #ifndef HAVE_MPI
     exit(EXIT_FAILURE);
 #else
@@ -6007,61 +6177,612 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
 #endif
   }
   
-  /*--- Open the CGNS file for reading. The value of fn returned
-   is the specific index number for this file and will be
-   repeatedly used in the function calls. ---*/
+  nDim = header[CSU2BinaryMesh::HEADER_NDIM];
+  if (rank == MASTER_NODE) {
+    if (nDim == 2) cout << "Two dimensional problem." << endl;
+    if (nDim == 3) cout << "Three dimensional problem." << endl;
+  }
+  
+  /*--- Number of points and possible ghost points ---*/
+  
+  nPoint              = header[CSU2BinaryMesh::HEADER_NPOINT];
+  nPointDomain        = header[CSU2BinaryMesh::HEADER_NPOINTDOMAIN];
+  Global_nPoint       = nPoint;
+  Global_nPointDomain = nPointDomain;
   
-  if (cg_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn)) cg_error_exit();
   if (rank == MASTER_NODE) {
-    cout << "Reading the CGNS file: ";
-    cout << val_mesh_filename.c_str() << "." << endl;
+    cout << Global_nPointDomain << " points and " << Global_nPoint-Global_nPointDomain;
+    if (size > SINGLE_NODE) cout << " ghost points before parallel partitioning." << endl;
+    else cout << " ghost points." << endl;
   }
   
-  /*--- Get the number of databases. This is the highest node
-   in the CGNS heirarchy. ---*/
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Performing linear partitioning of the grid nodes." << endl;
   
-  if ( cg_nbases(fn, &nbases) ) cg_error_exit();
-  if (rank == MASTER_NODE)
-    cout << "CGNS file contains " << nbases << " database(s)." << endl;
+  /*--- Compute the number of points that will be on each processor.
+   This is a linear partitioning with the addition of a simple load
+   balancing for any remainder points. ---*/
   
-  /*--- Check if there is more than one database. Throw an
-   error if there is because this reader can currently
-   only handle one database. ---*/
+  total_pt_accounted = 0;
+  for (i = 0; i < (unsigned long)size; i++) {
+    npoint_procs[i] = nPoint/size;
+    total_pt_accounted = total_pt_accounted + npoint_procs[i];
+  }
   
-  if ( nbases > 1 ) {
-    if (rank == MASTER_NODE) {
-    printf("\n\n   !!! Error !!!\n" );
-    printf("CGNS reader currently incapable of handling more than 1 database.");
-    printf("Now exiting...\n\n");
-    }
-#ifndef HAVE_MPI
-    exit(EXIT_FAILURE);
-#else
-    MPI_Abort(MPI_COMM_WORLD,1);
-    MPI_Finalize();
-#endif
+  rem_points = nPoint-total_pt_accounted;
+  for (i = 0; i<rem_points; i++) {
+    npoint_procs[i]++;
   }
   
-  /*--- Read the databases. Note that the CGNS indexing starts at 1. ---*/
+  nPoint = npoint_procs[rank];
+  starting_node[0] = 0;
+  ending_node[0]   = starting_node[0] + npoint_procs[0];
+  for (i = 1; i < (unsigned long)size; i++) {
+    starting_node[i] = ending_node[i-1];
+    ending_node[i]   = starting_node[i] + npoint_procs[i] ;
+  }
   
-  for (int i = 1; i <= nbases; i++) {
+  /*--- Read the coordinates of the points of the linear partition only ---*/
+  
+  vector<passivedouble> Coord_Slice(nDim*nPoint);
+  CSU2BinaryMesh::ReadBlock(mesh_file, val_mesh_filename, header[CSU2BinaryMesh::HEADER_COORD] + nDim*starting_node[rank]*sizeof(passivedouble),
+                            Coord_Slice.data(), nDim*nPoint*sizeof(passivedouble));
+  
+  nPointNode = nPoint;
+  node = new CPoint*[nPoint];
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    GlobalIndex = starting_node[rank] + iPoint;
+    if (nDim == 2)
+      node[iPoint] = new CPoint(Coord_Slice[2*iPoint], Coord_Slice[2*iPoint+1], GlobalIndex, config);
+    else
+      node[iPoint] = new CPoint(Coord_Slice[3*iPoint], Coord_Slice[3*iPoint+1], Coord_Slice[3*iPoint+2], GlobalIndex, config);
+  }
+  Coord_Slice.clear();
+  
+  /*--- Every rank reads a linear slice of the elements and sends each element
+   to the ranks that own at least one of its nodes. Each element is stored as
+   its global index, its number of entries, its VTK type and its nodes. ---*/
+  
+  Global_nElem = header[CSU2BinaryMesh::HEADER_NELEM];
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << Global_nElem << " interior elements before parallel partitioning." << endl;
+  
+  elem_begin  = (Global_nElem/size)*rank + min((unsigned long)rank, Global_nElem%size);
+  nElem_Slice = Global_nElem/size + (((unsigned long)rank < Global_nElem%size) ? 1 : 0);
+  
+  vector<unsigned long> Elem_Ptr(nElem_Slice+1);
+  CSU2BinaryMesh::ReadBlock(mesh_file, val_mesh_filename, header[CSU2BinaryMesh::HEADER_ELEM_PTR] + elem_begin*size_ul,
+                            Elem_Ptr.data(), (nElem_Slice+1)*size_ul);
+  
+  vector<unsigned long> Elem_Conn(Elem_Ptr[nElem_Slice]-Elem_Ptr[0]);
+  CSU2BinaryMesh::ReadBlock(mesh_file, val_mesh_filename, header[CSU2BinaryMesh::HEADER_ELEM_CONN] + Elem_Ptr[0]*size_ul,
+                            Elem_Conn.data(), Elem_Conn.size()*size_ul);
+  
+  vector<vector<unsigned long> > Elem_Send(size);
+  
+  for (iElem = 0; iElem < nElem_Slice; iElem++) {
+    const unsigned long *Conn = &Elem_Conn[Elem_Ptr[iElem]-Elem_Ptr[0]];
+    nNodes = Elem_Ptr[iElem+1]-Elem_Ptr[iElem]-1;
     
-    if (cg_base_read(fn, i, basename, &cell_dim, &phys_dim)) cg_error_exit();
+    /*--- Ranks owning the nodes, each of them gets the element once ---*/
     
-    /*--- Get the number of zones for this base. ---*/
+    for (iNode = 0; iNode < nNodes; iNode++)
+      Owner[iNode] = upper_bound(ending_node, ending_node+size, Conn[iNode+1]) - ending_node;
+    sort(Owner, Owner+nNodes);
+    nOwner = unique(Owner, Owner+nNodes) - Owner;
     
-    if ( cg_nzones(fn, i, &nzones) ) cg_error_exit();
-    if (rank == MASTER_NODE) {
-      cout << "Database " << i << ", " << basename << ": " << nzones;
-      cout << " zone(s), cell dimension of " << cell_dim << ", physical ";
-      cout << "dimension of " << phys_dim << "." << endl;
+    for (iOwner = 0; iOwner < nOwner; iOwner++) {
+      vector<unsigned long> &Buffer = Elem_Send[Owner[iOwner]];
+      Buffer.push_back(elem_begin+iElem);
+      Buffer.push_back(nNodes+1);
+      Buffer.insert(Buffer.end(), Conn, Conn+nNodes+1);
     }
-    
-    /*--- Check if there is more than one zone. Throw an
-     error if there is, because this reader can currently
-     only handle one zone. This could be extended in the future. ---*/
-    
-    if ( nzones > 1 ) {
+  }
+  Elem_Ptr.clear(); Elem_Conn.clear();
+  
+  vector<unsigned long> Elem_Recv;
+  
+#ifdef HAVE_MPI
+  
+  /*--- Exchange the elements with the ranks of their nodes ---*/
+  
+  unsigned long *nSend = new unsigned long[size], *nRecv = new unsigned long[size];
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    nSend[iProcessor] = Elem_Send[iProcessor].size();
+  
+  MPI_Alltoall(nSend, 1, MPI_UNSIGNED_LONG, nRecv, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  
+  unsigned long *Recv_Offset = new unsigned long[size+1];
+  Recv_Offset[0] = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    Recv_Offset[iProcessor+1] = Recv_Offset[iProcessor] + nRecv[iProcessor];
+  Elem_Recv.resize(Recv_Offset[size]);
+  
+  MPI_Request *Request = new MPI_Request[2*size];
+  MPI_Status *Status = new MPI_Status[2*size];
+  int nRequest = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (nRecv[iProcessor] > 0)
+      SU2_MPI::Irecv(&Elem_Recv[Recv_Offset[iProcessor]], nRecv[iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, 0, MPI_COMM_WORLD, &Request[nRequest++]);
+    if (nSend[iProcessor] > 0)
+      SU2_MPI::Isend(&Elem_Send[iProcessor][0], nSend[iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, 0, MPI_COMM_WORLD, &Request[nRequest++]);
+  }
+  SU2_MPI::Waitall(nRequest, Request, Status);
+  
+  delete [] nSend; delete [] nRecv; delete [] Recv_Offset;
+  delete [] Request; delete [] Status;
+  
+#else
+  
+  Elem_Recv.swap(Elem_Send[MASTER_NODE]);
+  
+#endif
+  
+  Elem_Send.clear();
+  
+  /*--- Store the elements in the order of their global index, as in the
+   ASCII format, and build the adjacency for ParMETIS ---*/
+  
+  vector<pair<unsigned long, unsigned long> > Elem_Order;
+  for (i = 0; i < Elem_Recv.size(); i += Elem_Recv[i+1]+2)
+    Elem_Order.push_back(make_pair(Elem_Recv[i], i));
+  sort(Elem_Order.begin(), Elem_Order.end());
+  
+  nElem = Elem_Order.size();
+  elem = new CPrimalGrid*[nElem];
+  Global_to_Local_Elem.clear();
+  
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  vector< vector<unsigned long> > adj_nodes(nPoint, vector<unsigned long>(0));
+  unsigned long j;
+  long local_index;
+#endif
+#endif
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Distributing elements across all ranks." << endl;
+  
+  local_element_count = 0;
+  for (iElem = 0; iElem < nElem; iElem++) {
+    
+    const unsigned long *Conn = &Elem_Recv[Elem_Order[iElem].second];
+    VTK_Type = Conn[2];
+    nNodes = Conn[1]-1;
+    for (iNode = 0; iNode < nNodes; iNode++) vnodes[iNode] = Conn[iNode+3];
+    
+    Global_to_Local_Elem[Conn[0]] = local_element_count;
+    
+    switch(VTK_Type) {
+      case TRIANGLE:
+        elem[local_element_count] = new CTriangle(vnodes[0], vnodes[1], vnodes[2], 2);
+        nelem_triangle++; break;
+      case QUADRILATERAL:
+        elem[local_element_count] = new CQuadrilateral(vnodes[0], vnodes[1], vnodes[2], vnodes[3], 2);
+        nelem_quad++; break;
+      case TETRAHEDRON:
+        elem[local_element_count] = new CTetrahedron(vnodes[0], vnodes[1], vnodes[2], vnodes[3]);
+        nelem_tetra++; break;
+      case HEXAHEDRON:
+        elem[local_element_count] = new CHexahedron(vnodes[0], vnodes[1], vnodes[2], vnodes[3],
+                                                    vnodes[4], vnodes[5], vnodes[6], vnodes[7]);
+        nelem_hexa++; break;
+      case PRISM:
+        elem[local_element_count] = new CPrism(vnodes[0], vnodes[1], vnodes[2], vnodes[3], vnodes[4], vnodes[5]);
+        nelem_prism++; break;
+      case PYRAMID:
+        elem[local_element_count] = new CPyramid(vnodes[0], vnodes[1], vnodes[2], vnodes[3], vnodes[4]);
+        nelem_pyramid++; break;
+    }
+    local_element_count++;
+    
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+    
+    /*--- Build adjacency assuming the VTK connectivity, as in the ASCII reader ---*/
+    
+    for (unsigned long ii = 0; ii < nNodes; ii++) {
+      local_index = vnodes[ii]-starting_node[rank];
+      if ((local_index < 0) || (local_index >= (long)nPoint)) continue;
+      switch(VTK_Type) {
+        case TRIANGLE: case TETRAHEDRON:
+          for (j = 0; j < nNodes; j++)
+            if (ii != j) adj_nodes[local_index].push_back(vnodes[j]);
+          break;
+        case QUADRILATERAL:
+          adj_nodes[local_index].push_back(vnodes[(ii+1)%4]);
+          adj_nodes[local_index].push_back(vnodes[(ii+3)%4]);
+          break;
+        case HEXAHEDRON:
+          if (ii < 4) {
+            adj_nodes[local_index].push_back(vnodes[(ii+1)%4]);
+            adj_nodes[local_index].push_back(vnodes[(ii+3)%4]);
+          } else {
+            adj_nodes[local_index].push_back(vnodes[(ii-3)%4+4]);
+            adj_nodes[local_index].push_back(vnodes[(ii-1)%4+4]);
+          }
+          adj_nodes[local_index].push_back(vnodes[(ii+4)%8]);
+          break;
+        case PRISM:
+          if (ii < 3) {
+            adj_nodes[local_index].push_back(vnodes[(ii+1)%3]);
+            adj_nodes[local_index].push_back(vnodes[(ii+2)%3]);
+          } else {
+            adj_nodes[local_index].push_back(vnodes[(ii-2)%3+3]);
+            adj_nodes[local_index].push_back(vnodes[(ii-1)%3+3]);
+          }
+          adj_nodes[local_index].push_back(vnodes[(ii+3)%6]);
+          break;
+        case PYRAMID:
+          if (ii < 4) {
+            adj_nodes[local_index].push_back(vnodes[(ii+1)%4]);
+            adj_nodes[local_index].push_back(vnodes[(ii+3)%4]);
+            adj_nodes[local_index].push_back(vnodes[4]);
+          } else {
+            adj_nodes[local_index].push_back(vnodes[0]);
+            adj_nodes[local_index].push_back(vnodes[1]);
+            adj_nodes[local_index].push_back(vnodes[2]);
+            adj_nodes[local_index].push_back(vnodes[3]);
+          }
+          break;
+      }
+    }
+    
+#endif
+#endif
+    
+  }
+  
+  Elem_Recv.clear(); Elem_Order.clear();
+  
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Building the graph adjacency structure." << endl;
+  
+  /*--- Remove the repeated neighbors of each node and copy the adjacency
+   into the single vector that is fed to ParMETIS. ---*/
+  
+  vector<unsigned long> adjac_vec, temp_adjacency;
+  vector<unsigned long>::iterator it;
+  
+  xadj = new idx_t [npoint_procs[rank]+1];
+  xadj[0] = 0;
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    temp_adjacency = adj_nodes[iPoint];
+    sort(temp_adjacency.begin(), temp_adjacency.end());
+    it = unique(temp_adjacency.begin(), temp_adjacency.end());
+    temp_adjacency.resize(it - temp_adjacency.begin());
+    xadj[iPoint+1] = xadj[iPoint] + temp_adjacency.size();
+    adjac_vec.insert(adjac_vec.end(), temp_adjacency.begin(), temp_adjacency.end());
+    adj_nodes[iPoint].clear();
+  }
+  
+  adjacency = new idx_t [xadj[npoint_procs[rank]]];
+  copy(adjac_vec.begin(), adjac_vec.end(), adjacency);
+  
+  xadj_size = npoint_procs[rank]+1;
+  adjacency_size = xadj[npoint_procs[rank]];
+  
+  adjac_vec.clear();
+  adj_nodes.clear();
+  
+#endif
+#endif
+  
+  /*--- The boundary marker information is read by the master node alone,
+   as for the ASCII format. ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    nMarker = header[CSU2BinaryMesh::HEADER_NMARKER];
+    cout << nMarker << " surface markers." << endl;
+    config->SetnMarker_All(nMarker);
+    bound = new CPrimalGrid**[nMarker];
+    nElem_Bound = new unsigned long [nMarker];
+    Tag_to_Marker = new string [nMarker_Max];
+    nelem_edge_bound = 0; nelem_triangle_bound = 0; nelem_quad_bound = 0;
+    
+    unsigned long nBound = header[CSU2BinaryMesh::HEADER_NBOUND];
+    vector<char> Tags(nMarker*MAX_STRING_SIZE+1, '\0');
+    vector<long> SendRecv(nMarker);
+    vector<unsigned long> Marker_Ptr(nMarker+1), Bound_Ptr(nBound+1);
+    
+    CSU2BinaryMesh::ReadBlock(mesh_file, val_mesh_filename, header[CSU2BinaryMesh::HEADER_MARKER], Tags.data(), nMarker*MAX_STRING_SIZE);
+    CSU2BinaryMesh::ReadBlock(mesh_file, val_mesh_filename, header[CSU2BinaryMesh::HEADER_MARKER] + nMarker*MAX_STRING_SIZE,
+                              SendRecv.data(), nMarker*size_ul);
+    CSU2BinaryMesh::ReadBlock(mesh_file, val_mesh_filename, header[CSU2BinaryMesh::HEADER_MARKER] + nMarker*(MAX_STRING_SIZE+size_ul),
+                              Marker_Ptr.data(), (nMarker+1)*size_ul);
+    CSU2BinaryMesh::ReadBlock(mesh_file, val_mesh_filename, header[CSU2BinaryMesh::HEADER_BOUND_PTR], Bound_Ptr.data(), (nBound+1)*size_ul);
+    
+    vector<unsigned long> Bound_Conn(Bound_Ptr[nBound]);
+    CSU2BinaryMesh::ReadBlock(mesh_file, val_mesh_filename, header[CSU2BinaryMesh::HEADER_BOUND_CONN], Bound_Conn.data(), Bound_Conn.size()*size_ul);
+    
+    for (iMarker = 0; iMarker < nMarker; iMarker++) {
+      
+      string Marker_Tag(&Tags[iMarker*MAX_STRING_SIZE]);
+      nElem_Bound[iMarker] = Marker_Ptr[iMarker+1]-Marker_Ptr[iMarker];
+      bound[iMarker] = new CPrimalGrid* [nElem_Bound[iMarker]];
+      
+      /*--- Physical boundaries definition ---*/
+      
+      if (Marker_Tag != "SEND_RECEIVE") {
+        
+        cout << nElem_Bound[iMarker]  << " boundary elements in index "<< iMarker <<" (Marker = " <<Marker_Tag<< ")." << endl;
+        
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+          const unsigned long *Conn = &Bound_Conn[Bound_Ptr[Marker_Ptr[iMarker]+iElem_Bound]];
+          switch(Conn[0]) {
+            case LINE:
+              if (nDim == 3) {
+                cout << "Please remove line boundary conditions from the mesh file!" << endl;
+#ifndef HAVE_MPI
+                exit(EXIT_FAILURE);
+#else
+                MPI_Abort(MPI_COMM_WORLD,1);
+                MPI_Finalize();
+#endif
+              }
+              bound[iMarker][iElem_Bound] = new CLine(Conn[1], Conn[2], 2);
+              nelem_edge_bound++; break;
+            case TRIANGLE:
+              bound[iMarker][iElem_Bound] = new CTriangle(Conn[1], Conn[2], Conn[3], 3);
+              nelem_triangle_bound++; break;
+            case QUADRILATERAL:
+              bound[iMarker][iElem_Bound] = new CQuadrilateral(Conn[1], Conn[2], Conn[3], Conn[4], 3);
+              nelem_quad_bound++; break;
+          }
+        }
+        
+        /*--- Update config information storing the boundary information in the right place ---*/
+        
+        Tag_to_Marker[config->GetMarker_CfgFile_TagBound(Marker_Tag)] = Marker_Tag;
+        config->SetMarker_All_TagBound(iMarker, Marker_Tag);
+        config->SetMarker_All_KindBC(iMarker, config->GetMarker_CfgFile_KindBC(Marker_Tag));
+        config->SetMarker_All_Monitoring(iMarker, config->GetMarker_CfgFile_Monitoring(Marker_Tag));
+        config->SetMarker_All_GeoEval(iMarker, config->GetMarker_CfgFile_GeoEval(Marker_Tag));
+        config->SetMarker_All_Designing(iMarker, config->GetMarker_CfgFile_Designing(Marker_Tag));
+        config->SetMarker_All_Plotting(iMarker, config->GetMarker_CfgFile_Plotting(Marker_Tag));
+        config->SetMarker_All_FSIinterface(iMarker, config->GetMarker_CfgFile_FSIinterface(Marker_Tag));
+        config->SetMarker_All_DV(iMarker, config->GetMarker_CfgFile_DV(Marker_Tag));
+        config->SetMarker_All_Moving(iMarker, config->GetMarker_CfgFile_Moving(Marker_Tag));
+        config->SetMarker_All_PerBound(iMarker, config->GetMarker_CfgFile_PerBound(Marker_Tag));
+        config->SetMarker_All_SendRecv(iMarker, NONE);
+        config->SetMarker_All_Out_1D(iMarker, config->GetMarker_CfgFile_Out_1D(Marker_Tag));
+        
+      }
+      
+      /*--- Send-Receive boundaries definition ---*/
+      
+      else {
+        
+        config->SetMarker_All_KindBC(iMarker, SEND_RECEIVE);
+        config->SetMarker_All_SendRecv(iMarker, SendRecv[iMarker]);
+        
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+          const unsigned long *Conn = &Bound_Conn[Bound_Ptr[Marker_Ptr[iMarker]+iElem_Bound]];
+          bound[iMarker][iElem_Bound] = new CVertexMPI(Conn[1], nDim);
+          bound[iMarker][iElem_Bound]->SetRotation_Type(Conn[2]);
+        }
+        
+      }
+    }
+    
+    /*--- Periodic transformations (center, rotation, translation), the
+     default is a single transformation with zeros ---*/
+    
+    unsigned short iPeriodic, nPeriodic = header[CSU2BinaryMesh::HEADER_NPERIODIC];
+    vector<passivedouble> Periodic(9*nPeriodic);
+    CSU2BinaryMesh::ReadBlock(mesh_file, val_mesh_filename, header[CSU2BinaryMesh::HEADER_PERIODIC], Periodic.data(), Periodic.size()*sizeof(passivedouble));
+    
+    if (nPeriodic == 0) {
+      nPeriodic = 1; Periodic.assign(9, 0.0);
+    }
+    else if (nPeriodic - 1 != 0)
+      cout << nPeriodic - 1 << " periodic transformations." << endl;
+    
+    config->SetnPeriodicIndex(nPeriodic);
+    
+    su2double center[3], rotation[3], translate[3];
+    for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+      for (unsigned short iDim = 0; iDim < 3; iDim++) {
+        center[iDim]    = Periodic[9*iPeriodic+iDim];
+        rotation[iDim]  = Periodic[9*iPeriodic+3+iDim];
+        translate[iDim] = Periodic[9*iPeriodic+6+iDim];
+      }
+      config->SetPeriodicCenter(iPeriodic, center);
+      config->SetPeriodicRotation(iPeriodic, rotation);
+      config->SetPeriodicTranslate(iPeriodic, translate);
+    }
+    
+  }
+  
+  /*--- Close the input file ---*/
+  
+  CSU2BinaryMesh::CloseFile(mesh_file);
+  
+}
+
+void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+  
+  /*--- Original CGNS reader implementation by Thomas D. Economon,
+   Francisco Palacios. Improvements for mixed-element meshes generated
+   by ICEM added by Martin Spel (3D) & Shlomy Shitrit (2D), April 2014.
+   Parallel version by Thomas D. Economon, February 2015. ---*/
+  
+#ifdef HAVE_CGNS
+    
+  string text_line, Marker_Tag;
+  ifstream mesh_file;
+  unsigned short VTK_Type = 0, iMarker = 0;
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+  unsigned long iPoint = 0, iProcessor = 0, ielem = 0, GlobalIndex = 0;
+  unsigned long globalOffset = 0;
+  nZone = val_nZone;
+  
+  /*--- Local variables needed when calling the CGNS mid-level API. ---*/
+  
+  unsigned long vnodes_cgns[8] = {0,0,0,0,0,0,0,0};
+  su2double Coord_cgns[3] = {0.0,0.0,0.0};
+  int fn, nbases = 0, nzones = 0, ngrids = 0, ncoords = 0, nsections = 0;
+  int *vertices = NULL, *cells = NULL, nMarkers = 0, *boundVerts = NULL, npe;
+  int interiorElems = 0, totalVerts = 0;
+  int cell_dim = 0, phys_dim = 0, nbndry, parent_flag, file_type;
+  char basename[CGNS_STRING_SIZE], zonename[CGNS_STRING_SIZE];
+  char coordname[CGNS_STRING_SIZE];
+  cgsize_t* cgsize; cgsize = new cgsize_t[3];
+  ZoneType_t zonetype;
+  DataType_t datatype;
+  passivedouble** coordArray = NULL;
+  passivedouble*** gridCoords = NULL;
+  ElementType_t elemType;
+  cgsize_t range_min, range_max, startE, endE;
+  range_min = 1;
+  string currentElem;
+  int** elemTypeVTK = NULL;
+  int** elemIndex = NULL;
+  int** elemBegin = NULL;
+  int** elemEnd = NULL;
+  int** nElems = NULL;
+  cgsize_t**** connElems = NULL;
+  cgsize_t* connElemCGNS = NULL;
+  cgsize_t* connElemTemp = NULL;
+  cgsize_t ElementDataSize = 0;
+  cgsize_t* parentData = NULL;
+  int** dataSize = NULL;
+  bool** isInternal = NULL;
+  char*** sectionNames = NULL;
+  
+  /*--- Initialize counters for local/global points & elements ---*/
+  
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  unsigned long Local_nElem;
+  unsigned long Local_nElemTri, Local_nElemQuad, Local_nElemTet;
+  unsigned long Local_nElemHex, Local_nElemPrism, Local_nElemPyramid;
+  MPI_Request *send_req, *recv_req;
+  MPI_Status  status;
+  int ind;
+#endif
+  
+  /*--- Initialize counters for local/global points & elements ---*/
+  
+  Global_nPoint  = 0; Global_nPointDomain = 0; Global_nElem = 0;
+  nelem_edge     = 0; Global_nelem_edge     = 0;
+  nelem_triangle = 0; Global_nelem_triangle = 0;
+  nelem_quad     = 0; Global_nelem_quad     = 0;
+  nelem_tetra    = 0; Global_nelem_tetra    = 0;
+  nelem_hexa     = 0; Global_nelem_hexa     = 0;
+  nelem_prism    = 0; Global_nelem_prism    = 0;
+  nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
+  
+  /*--- Initialize some additional counters for the parallel partitioning ---*/
+  
+  unsigned long total_pt_accounted = 0;
+  unsigned long rem_points         = 0;
+  unsigned long element_count      = 0;
+  unsigned long element_remainder  = 0;
+  unsigned long total_elems        = 0;
+  
+  /*--- Allocate memory for the linear partitioning of the mesh. These
+   arrays are the size of the number of ranks. ---*/
+  
+  starting_node = new unsigned long[size];
+  ending_node   = new unsigned long[size];
+  npoint_procs  = new unsigned long[size];
+  
+  unsigned long *nPoint_Linear = new unsigned long[size+1];
+  unsigned long *nElem_Linear  = new unsigned long[size];
+  
+  unsigned long *elemB = new unsigned long[size];
+  unsigned long *elemE = new unsigned long[size];
+  
+  unsigned long *elemGlobalID = NULL;
+  
+  unsigned short *nPoinPerElem = NULL;
+  unsigned short *elemTypes = NULL;
+  
+  bool *isMixed = NULL;
+  
+  unsigned short connSize = 10;
+  
+  /*--- Check whether the supplied file is truly a CGNS file. ---*/
+  if (cg_is_cgns(val_mesh_filename.c_str(), &file_type) != CG_OK) {
+    if (rank == MASTER_NODE) {
+    printf( "\n\n   !!! Error !!!\n" );
+    printf( " %s is not a CGNS file.\n", val_mesh_filename.c_str());
+    printf( " Now exiting...\n\n");
+    }
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  /*--- Open the CGNS file for reading. The value of fn returned
+   is the specific index number for this file and will be
+   repeatedly used in the function calls. ---*/
+  
+  if (cg_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn)) cg_error_exit();
+  if (rank == MASTER_NODE) {
+    cout << "Reading the CGNS file: ";
+    cout << val_mesh_filename.c_str() << "." << endl;
+  }
+  
+  /*--- Get the number of databases. This is the highest node
+   in the CGNS heirarchy. ---*/
+  
+  if ( cg_nbases(fn, &nbases) ) cg_error_exit();
+  if (rank == MASTER_NODE)
+    cout << "CGNS file contains " << nbases << " database(s)." << endl;
+  
+  /*--- Check if there is more than one database. Throw an
+   error if there is because this reader can currently
+   only handle one database. ---*/
+  
+  if ( nbases > 1 ) {
+    if (rank == MASTER_NODE) {
+    printf("\n\n   !!! Error !!!\n" );
+    printf("CGNS reader currently incapable of handling more than 1 database.");
+    printf("Now exiting...\n\n");
+    }
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  /*--- Read the databases. Note that the CGNS indexing starts at 1. ---*/
+  
+  for (int i = 1; i <= nbases; i++) {
+    
+    if (cg_base_read(fn, i, basename, &cell_dim, &phys_dim)) cg_error_exit();
+    
+    /*--- Get the number of zones for this base. ---*/
+    
+    if ( cg_nzones(fn, i, &nzones) ) cg_error_exit();
+    if (rank == MASTER_NODE) {
+      cout << "Database " << i << ", " << basename << ": " << nzones;
+      cout << " zone(s), cell dimension of " << cell_dim << ", physical ";
+      cout << "dimension of " << phys_dim << "." << endl;
+    }
+    
+    /*--- Check if there is more than one zone. Throw an
+     error if there is, because this reader can currently
+     only handle one zone. This could be extended in the future. ---*/
+    
+    if ( nzones > 1 ) {
       if (rank == MASTER_NODE) {
       printf("\n\n   !!! Error !!!\n" );
       printf("CGNS reader currently incapable of handling more than 1 zone.");
@@ -7921,71 +8642,220 @@ void CPhysicalGeometry::Check_BoundElem_Orientation(CConfig *config) {
 }
 
 void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
-
-  /*--- Compute the total number of nodes on no-slip boundaries ---*/
   
-  unsigned long nVertex_SolidWall = 0;
-  for(unsigned short iMarker=0; iMarker<config->GetnMarker_All(); ++iMarker) {
-    if( (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX)  ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ) {
-      nVertex_SolidWall += GetnVertex(iMarker);
-    }
+  unsigned long iPoint, iElem, elemID;
+  unsigned short iMarker, iNode, iDim;
+  su2double dist;
+  
+  /*--- Collect the surface elements of the no-slip walls of this rank, the
+   walls are not gathered, every rank only stores its own part of them ---*/
+  
+  vector<su2double>      Coord_bound;
+  vector<unsigned long>  Conn_bound;
+  vector<unsigned short> VTK_bound;
+  vector<long>           Point_bound(nPoint, -1);
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
+        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL)) {
+      for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+        VTK_bound.push_back(bound[iMarker][iElem]->GetVTK_Type());
+        for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+          iPoint = bound[iMarker][iElem]->GetNode(iNode);
+          if (Point_bound[iPoint] < 0) {
+            Point_bound[iPoint] = Coord_bound.size()/nDim;
+            for (iDim = 0; iDim < nDim; iDim++)
+              Coord_bound.push_back(node[iPoint]->GetCoord(iDim));
+          }
+          Conn_bound.push_back(Point_bound[iPoint]);
+        }
+      }
+    }
+  }
+  
+  /*--- Build the ADT of the local wall elements ---*/
+  
+  su2_adtElemClass WallADT(nDim, Coord_bound, Conn_bound, VTK_bound);
+  bool Local_Wall = !WallADT.IsEmpty(), Global_Wall = Local_Wall;
+  
+  /*--- Distance of all the nodes to the nearest local wall element ---*/
+  
+  vector<su2double> Wall_Distance(nPoint, 0.0);
+  
+  if (Local_Wall) {
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(dynamic, 256) private(dist, elemID)
+#endif
+    for (long jPoint = 0; jPoint < (long)nPoint; jPoint++) {
+      WallADT.DetermineNearestElement(node[jPoint]->GetCoord(), dist, elemID);
+      Wall_Distance[jPoint] = dist;
+    }
+  }
+  
+#ifdef HAVE_MPI
+  
+  int rank, nProcessor, iProcessor;
+  unsigned long iQuery, nQuery;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
+  
+  /*--- Gather the bounding boxes of the walls of all ranks, ranks without
+   walls send an inverted box ---*/
+  
+  su2double *BBox_Send = new su2double[2*nDim];
+  su2double *BBox_Recv = new su2double[2*nDim*nProcessor];
+  
+  if (Local_Wall) WallADT.GetBoundingBox(BBox_Send, BBox_Send+nDim);
+  else {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      BBox_Send[iDim] = 1.0; BBox_Send[iDim+nDim] = -1.0;
+    }
+  }
+  
+  SU2_MPI::Allgather(BBox_Send, 2*nDim, MPI_DOUBLE, BBox_Recv, 2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+  
+  vector<bool> Rank_Wall(nProcessor);
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    Rank_Wall[iProcessor] = (BBox_Recv[2*nDim*iProcessor] <= BBox_Recv[2*nDim*iProcessor+nDim]);
+    if (Rank_Wall[iProcessor]) Global_Wall = true;
+  }
+  
+  /*--- Route the nodes to the ranks that may own a nearer wall element. Every
+   box contains a wall element, so the distance to the farthest corner of a box
+   bounds the wall distance, and only the ranks with a box closer than the
+   smallest bound are queried. The routing only uses passive values. ---*/
+  
+  vector<vector<unsigned long> > Query_Point(nProcessor);
+  vector<passivedouble> Box_Dist2(nProcessor);
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    
+    passivedouble Max_Dist2 = -1.0;
+    if (Local_Wall) Max_Dist2 = SU2_TYPE::GetValue(Wall_Distance[iPoint])*SU2_TYPE::GetValue(Wall_Distance[iPoint]);
+    
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      if ((iProcessor == rank) || !Rank_Wall[iProcessor]) continue;
+      su2double *BBox = &BBox_Recv[2*nDim*iProcessor];
+      passivedouble Min_Box = 0.0, Max_Box = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        passivedouble Coord = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+        passivedouble Lower = Coord - SU2_TYPE::GetValue(BBox[iDim]);
+        passivedouble Upper = Coord - SU2_TYPE::GetValue(BBox[iDim+nDim]);
+        if (Lower < 0.0) Min_Box += Lower*Lower;
+        else if (Upper > 0.0) Min_Box += Upper*Upper;
+        Max_Box += max(Lower*Lower, Upper*Upper);
+      }
+      Box_Dist2[iProcessor] = Min_Box;
+      if ((Max_Dist2 < 0.0) || (Max_Box < Max_Dist2)) Max_Dist2 = Max_Box;
+    }
+    
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      if ((iProcessor == rank) || !Rank_Wall[iProcessor]) continue;
+      if (Box_Dist2[iProcessor] <= Max_Dist2) Query_Point[iProcessor].push_back(iPoint);
+    }
+  }
+  
+  delete [] BBox_Send; delete [] BBox_Recv;
+  
+  /*--- Exchange the number of queries, integers only, so the plain
+   all-to-all does not need an AD wrapper ---*/
+  
+  unsigned long *nQuery_Send = new unsigned long[nProcessor];
+  unsigned long *nQuery_Recv = new unsigned long[nProcessor];
+  unsigned long *Send_Offset = new unsigned long[nProcessor+1];
+  unsigned long *Recv_Offset = new unsigned long[nProcessor+1];
+  
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+    nQuery_Send[iProcessor] = Query_Point[iProcessor].size();
+  
+  MPI_Alltoall(nQuery_Send, 1, MPI_UNSIGNED_LONG, nQuery_Recv, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  
+  Send_Offset[0] = 0; Recv_Offset[0] = 0;
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    Send_Offset[iProcessor+1] = Send_Offset[iProcessor] + nQuery_Send[iProcessor];
+    Recv_Offset[iProcessor+1] = Recv_Offset[iProcessor] + nQuery_Recv[iProcessor];
+  }
+  
+  /*--- Send the coordinates of the queried nodes ---*/
+  
+  su2double *Buffer_Send_Coord = new su2double[nDim*Send_Offset[nProcessor]];
+  su2double *Buffer_Recv_Coord = new su2double[nDim*Recv_Offset[nProcessor]];
+  su2double *Buffer_Send_Dist  = new su2double[Recv_Offset[nProcessor]];
+  su2double *Buffer_Recv_Dist  = new su2double[Send_Offset[nProcessor]];
+  
+  MPI_Request *Request = new MPI_Request[2*nProcessor];
+  MPI_Status  *Status  = new MPI_Status[2*nProcessor];
+  int nRequest = 0;
+  
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    for (iQuery = 0; iQuery < nQuery_Send[iProcessor]; iQuery++) {
+      iPoint = Query_Point[iProcessor][iQuery];
+      for (iDim = 0; iDim < nDim; iDim++)
+        Buffer_Send_Coord[nDim*(Send_Offset[iProcessor]+iQuery)+iDim] = node[iPoint]->GetCoord(iDim);
+    }
+  }
+  
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    if (nQuery_Recv[iProcessor] > 0)
+      SU2_MPI::Irecv(&Buffer_Recv_Coord[nDim*Recv_Offset[iProcessor]], nDim*nQuery_Recv[iProcessor],
+                     MPI_DOUBLE, iProcessor, 0, MPI_COMM_WORLD, &Request[nRequest++]);
+    if (nQuery_Send[iProcessor] > 0)
+      SU2_MPI::Isend(&Buffer_Send_Coord[nDim*Send_Offset[iProcessor]], nDim*nQuery_Send[iProcessor],
+                     MPI_DOUBLE, iProcessor, 0, MPI_COMM_WORLD, &Request[nRequest++]);
+  }
+  SU2_MPI::Waitall(nRequest, Request, Status);
+  
+  /*--- Answer the queries of the other ranks with the local walls ---*/
+  
+  nQuery = Recv_Offset[nProcessor];
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(dynamic, 256) private(dist, elemID)
+#endif
+  for (long jQuery = 0; jQuery < (long)nQuery; jQuery++) {
+    WallADT.DetermineNearestElement(&Buffer_Recv_Coord[nDim*jQuery], dist, elemID);
+    Buffer_Send_Dist[jQuery] = dist;
+  }
+  
+  /*--- Return the distances and keep the minimum ---*/
+  
+  nRequest = 0;
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    if (nQuery_Send[iProcessor] > 0)
+      SU2_MPI::Irecv(&Buffer_Recv_Dist[Send_Offset[iProcessor]], nQuery_Send[iProcessor],
+                     MPI_DOUBLE, iProcessor, 1, MPI_COMM_WORLD, &Request[nRequest++]);
+    if (nQuery_Recv[iProcessor] > 0)
+      SU2_MPI::Isend(&Buffer_Send_Dist[Recv_Offset[iProcessor]], nQuery_Recv[iProcessor],
+                     MPI_DOUBLE, iProcessor, 1, MPI_COMM_WORLD, &Request[nRequest++]);
   }
+  SU2_MPI::Waitall(nRequest, Request, Status);
   
-  /*--- Allocate the vectors to hold boundary node coordinates
-        and its local ID. ---*/
-
-  vector<su2double>     Coord_bound(nDim*nVertex_SolidWall);
-  vector<unsigned long> PointIDs(nVertex_SolidWall);
-
-  /*--- Retrieve and store the coordinates of the no-slip boundary nodes
-        and their local point IDs. ---*/
-
-  unsigned long ii = 0, jj = 0;
-  for(unsigned short iMarker=0; iMarker<config->GetnMarker_All(); ++iMarker) {
-    if( (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX)  ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ) {
-      for(unsigned long iVertex=0; iVertex<GetnVertex(iMarker); ++iVertex) {
-        unsigned long iPoint = vertex[iMarker][iVertex]->GetNode();
-        PointIDs[jj++] = iPoint;
-        for(unsigned short iDim=0; iDim<nDim; ++iDim)
-          Coord_bound[ii++] = node[iPoint]->GetCoord(iDim);
+  vector<bool> Point_Found(nPoint, Local_Wall);
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    for (iQuery = 0; iQuery < nQuery_Send[iProcessor]; iQuery++) {
+      iPoint = Query_Point[iProcessor][iQuery];
+      dist = Buffer_Recv_Dist[Send_Offset[iProcessor]+iQuery];
+      if (!Point_Found[iPoint] || (dist < Wall_Distance[iPoint])) {
+        Wall_Distance[iPoint] = dist;
+        Point_Found[iPoint] = true;
       }
     }
   }
-
-  /*--- Build the ADT of the boundary nodes. ---*/
-
-  su2_adtPointsOnlyClass WallADT(nDim, nVertex_SolidWall, Coord_bound.data(), PointIDs.data());
   
-  /*--- Loop over all interior mesh nodes and compute the distances to each
-        of the no-slip boundary nodes. Store the minimum distance to the wall
-        for each interior mesh node. ---*/
-
-  if( WallADT.IsEmpty() ) {
-
-    /*--- No solid wall boundary nodes in the entire mesh.
-          Set the wall distance to zero for all nodes. ---*/
-
-    for(unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint)
-      node[iPoint]->SetWall_Distance(0.0);
-  }
-  else {
-
-    /*--- Solid wall boundary nodes are present. Compute the wall
-          distance for all nodes. ---*/
-
-    for(unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
-
-      su2double dist;
-      unsigned long pointID;
-      int rankID;
-
-      WallADT.DetermineNearestNode(node[iPoint]->GetCoord(), dist,
-                                   pointID, rankID);
-      node[iPoint]->SetWall_Distance(dist);
-    }
-  }
+  delete [] Buffer_Send_Coord; delete [] Buffer_Recv_Coord;
+  delete [] Buffer_Send_Dist;  delete [] Buffer_Recv_Dist;
+  delete [] nQuery_Send; delete [] nQuery_Recv;
+  delete [] Send_Offset; delete [] Recv_Offset;
+  delete [] Request; delete [] Status;
+  
+#endif
+  
+  /*--- Store the wall distance, it is zero everywhere when there are no
+   solid wall boundaries in the entire mesh ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetWall_Distance(Global_Wall ? Wall_Distance[iPoint] : su2double(0.0));
+  
 }
 
 void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
@@ -8111,9 +8981,9 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
 }
 
 void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
-  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iElem, iNode, jNode;
+  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iNode, jNode;
   vector<unsigned long> Queue, AuxQueue, Result;
-  unsigned short Degree, MinDegree, iDim, iMarker;
+  unsigned short Degree, MinDegree;
   bool *inQueue;
   
   inQueue = new bool [nPoint];
@@ -8201,6 +9071,91 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
   
+  /*--- Renumber the points and update the connectivities ---*/
+  
+  SetPoint_Ordering(config, Result);
+  
+}
+
+void CPhysicalGeometry::SetHilbert_Ordering(CConfig *config) {
+  
+  unsigned long iPoint, Key, X[3], Q, P, t, nCell;
+  unsigned short iDim, jDim, nBits, iBit;
+  su2double Coord_Min[3] = {0.0,0.0,0.0}, Coord_Max[3] = {0.0,0.0,0.0}, Length;
+  vector<pair<unsigned long, unsigned long> > Key_Point(nPointDomain);
+  vector<unsigned long> Result(nPoint);
+  
+  /*--- Bits per coordinate, such that the key of nDim coordinates fits in 63 bits ---*/
+  
+  nBits = (nDim == 2) ? 31 : 21;
+  nCell = (1UL << nBits) - 1;
+  
+  /*--- Bounding box of the domain points of the partition ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      if ((iPoint == 0) || (node[iPoint]->GetCoord(iDim) < Coord_Min[iDim])) Coord_Min[iDim] = node[iPoint]->GetCoord(iDim);
+      if ((iPoint == 0) || (node[iPoint]->GetCoord(iDim) > Coord_Max[iDim])) Coord_Max[iDim] = node[iPoint]->GetCoord(iDim);
+    }
+  }
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    /*--- Integer coordinates of the point in the bounding box ---*/
+    
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Length = Coord_Max[iDim] - Coord_Min[iDim];
+      if (Length > 0.0)
+        X[iDim] = (unsigned long)(SU2_TYPE::GetValue((node[iPoint]->GetCoord(iDim)-Coord_Min[iDim])/Length)*nCell);
+      else X[iDim] = 0;
+    }
+    
+    /*--- Transpose of the Hilbert index (J. Skilling, Programming the
+     Hilbert curve, AIP Conf. Proc. 707, 2004) ---*/
+    
+    for (Q = 1UL << (nBits-1); Q > 1; Q >>= 1) {
+      P = Q - 1;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        if (X[iDim] & Q) X[0] ^= P;
+        else { t = (X[0] ^ X[iDim]) & P; X[0] ^= t; X[iDim] ^= t; }
+      }
+    }
+    for (iDim = 1; iDim < nDim; iDim++) X[iDim] ^= X[iDim-1];
+    t = 0;
+    for (Q = 1UL << (nBits-1); Q > 1; Q >>= 1)
+      if (X[nDim-1] & Q) t ^= Q - 1;
+    for (iDim = 0; iDim < nDim; iDim++) X[iDim] ^= t;
+    
+    /*--- Interleave the bits of the transposed index ---*/
+    
+    Key = 0;
+    for (iBit = nBits; iBit > 0; iBit--)
+      for (jDim = 0; jDim < nDim; jDim++)
+        Key = (Key << 1) | ((X[jDim] >> (iBit-1)) & 1UL);
+    
+    Key_Point[iPoint] = make_pair(Key, iPoint);
+    
+  }
+  
+  /*--- Domain points in the order of the curve, the MPI points go at the end ---*/
+  
+  sort(Key_Point.begin(), Key_Point.end());
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Result[iPoint] = Key_Point[iPoint].second;
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    Result[iPoint] = iPoint;
+  
+  /*--- Renumber the points and update the connectivities ---*/
+  
+  SetPoint_Ordering(config, Result);
+  
+}
+
+void CPhysicalGeometry::SetPoint_Ordering(CConfig *config, vector<unsigned long> &Result) {
+  unsigned long iPoint, iElem, iNode;
+  unsigned short iDim, iMarker;
+  
   /*--- Reset old data structures ---*/
   
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -8432,6 +9387,10 @@ void CPhysicalGeometry::SetCoord_CG(void) {
   unsigned long elem_poin, edge_poin, iElem, iEdge;
   su2double **Coord;
   
+  /*--- The coordinates changed, the caches built from them are out of date ---*/
+  
+  Coord_Version++;
+  
   /*--- Compute the center of gravity for elements ---*/
   
   for (iElem = 0; iElem<nElem; iElem++) {
@@ -9583,6 +10542,59 @@ void CPhysicalGeometry::SetMeshFile (CConfig *config, string val_mesh_out_filena
   char *cstr;
   su2double *center, *angles, *transl;
   
+  /*--- Binary native format, same content as the ASCII file below ---*/
+  
+  if (config->GetMesh_Out_FileFormat() == SU2_BINARY) {
+    
+    CSU2BinaryMesh mesh(nDim);
+    unsigned long Nodes[N_POINTS_HEXAHEDRON];
+    
+    mesh.nPoint = nPoint; mesh.nPointDomain = nPointDomain;
+    mesh.Coord.resize(nPoint*nDim);
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        mesh.Coord[iPoint*nDim+iDim] = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+    
+    for (iElem = 0; iElem < nElem; iElem++) {
+      for (iNodes = 0; iNodes < elem[iElem]->GetnNodes(); iNodes++)
+        Nodes[iNodes] = elem[iElem]->GetNode(iNodes);
+      mesh.AddElem(elem[iElem]->GetVTK_Type(), elem[iElem]->GetnNodes(), Nodes);
+    }
+    
+    for (iMarker = 0; iMarker < nMarker; iMarker++) {
+      if (bound[iMarker][0]->GetVTK_Type() != VERTEX) {
+        mesh.AddMarker(config->GetMarker_All_TagBound(iMarker), 0);
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+          for (iNodes = 0; iNodes < bound[iMarker][iElem_Bound]->GetnNodes(); iNodes++)
+            Nodes[iNodes] = bound[iMarker][iElem_Bound]->GetNode(iNodes);
+          mesh.AddBound(bound[iMarker][iElem_Bound]->GetVTK_Type(), bound[iMarker][iElem_Bound]->GetnNodes(), Nodes);
+        }
+      }
+      else {
+        mesh.AddMarker("SEND_RECEIVE", config->GetMarker_All_SendRecv(iMarker));
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+          Nodes[0] = bound[iMarker][iElem_Bound]->GetNode(0);
+          Nodes[1] = bound[iMarker][iElem_Bound]->GetRotation_Type();
+          mesh.AddBound(VERTEX, 2, Nodes);
+        }
+      }
+    }
+    
+    nPeriodic = config->GetnPeriodicIndex();
+    for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+      center = config->GetPeriodicCenter(iPeriodic);
+      angles = config->GetPeriodicRotation(iPeriodic);
+      transl = config->GetPeriodicTranslate(iPeriodic);
+      for (iDim = 0; iDim < 3; iDim++) mesh.Periodic.push_back(SU2_TYPE::GetValue(center[iDim]));
+      for (iDim = 0; iDim < 3; iDim++) mesh.Periodic.push_back(SU2_TYPE::GetValue(angles[iDim]));
+      for (iDim = 0; iDim < 3; iDim++) mesh.Periodic.push_back(SU2_TYPE::GetValue(transl[iDim]));
+    }
+    
+    mesh.Write(val_mesh_out_filename);
+    return;
+    
+  }
+  
   cstr = new char [val_mesh_out_filename.size()+1];
   strcpy (cstr, val_mesh_out_filename.c_str());
   
@@ -12384,33 +13396,20 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
   
   /*--- Local variables ---*/
   
-  unsigned long iPoint, Index_CoarseCV, CVPoint, iElem, iVertex, jPoint, iteration, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector, iParent, jVertex, *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL, *Parent_Remote = NULL, *Children_Remote = NULL, *Parent_Local = NULL, *Children_Local = NULL, Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine;;
-  short marker_seed;
-  bool agglomerate_seed = true;
-  unsigned short nChildren, iNode, counter, iMarker, jMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
-  vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
-  vector<unsigned long>::iterator it;
+  unsigned long iPoint, iElem, Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine;
+  unsigned short iNode;
   int rank;
-
-  unsigned short nMarker_Max = config->GetnMarker_Max();
-
-  unsigned short *copy_marker = new unsigned short [nMarker_Max];
   
 #ifndef HAVE_MPI
   rank = MASTER_NODE;
 #else
-  int send_to, receive_from;
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Status status;
 #endif
   
-  nDim = fine_grid->GetnDim(); // Write the number of dimensions of the coarse grid.
+  Geometrical_Check = NULL;
+  Point_Marker = NULL;
   
-  /*--- Create a queue system to deo the agglomeration
-   1st) More than two markers ---> Vertices (never agglomerate)
-   2nd) Two markers ---> Edges (agglomerate if same BC, never agglomerate if different BC)
-   3rd) One marker ---> Surface (always agglomarate)
-   4th) No marker ---> Internal Volume (always agglomarate) ---*/
+  nDim = fine_grid->GetnDim(); // Write the number of dimensions of the coarse grid.
   
   /*--- Set a marker to indicate indirect agglomeration ---*/
   
@@ -12433,8 +13432,6 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
   
   /*--- Create the coarse grid structure using as baseline the fine grid ---*/
   
-  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
- 
   nPointNode = fine_grid->GetnPoint(); 
   node = new CPoint*[fine_grid->GetnPoint()];
   for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
@@ -12448,6 +13445,89 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
     node[iPoint]->SetAgglomerate_Indirect(false);
   }
   
+  /*--- Reuse the agglomeration of a previous run on the same grid, otherwise
+   agglomerate the control volumes (and store them for the next runs) ---*/
+  
+  if (!Read_Agglomeration(fine_grid, config, iMesh, iZone)) {
+    SetAgglomeration(fine_grid, config);
+    if (config->GetMG_Agglomeration_Reuse())
+      Write_Agglomeration(fine_grid, config, iMesh, iZone);
+  }
+  
+  /*--- Console output with the summary of the agglomeration ---*/
+  
+  Local_nPointCoarse = nPoint;
+  Local_nPointFine = fine_grid->GetnPoint();
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#else
+  Global_nPointCoarse = Local_nPointCoarse;
+  Global_nPointFine = Local_nPointFine;
+#endif
+  
+  su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
+  
+  if (iMesh != MESH_0) {
+    if (nDim == 2) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./2.);
+    if (nDim == 3) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./3.);
+    CFL = factor*config->GetCFL(iMesh-1)/Coeff;
+    config->SetCFL(iMesh, CFL);
+  }
+  
+  su2double ratio = su2double(Global_nPointFine)/su2double(Global_nPointCoarse);
+  
+  if (((nDim == 2) && (ratio < 2.5)) ||
+      ((nDim == 3) && (ratio < 2.5))) {
+    config->SetMGLevels(iMesh-1);
+  }
+  else {
+    if (rank == MASTER_NODE) {
+      if (iMesh == 1) cout <<"MG level: "<< iMesh-1 <<" -> CVs: " << Global_nPointFine << ". Agglomeration rate 1/1.00. CFL "<< config->GetCFL(iMesh-1) <<"." << endl;
+      cout <<"MG level: "<< iMesh <<" -> CVs: " << Global_nPointCoarse << ". Agglomeration rate 1/" << ratio <<". CFL "<< CFL <<"." << endl;
+    }
+  }
+ 
+}
+
+
+void CMultiGridGeometry::SetAgglomeration(CGeometry *fine_grid, CConfig *config) {
+  
+  unsigned long iPoint, Index_CoarseCV, CVPoint, iVertex, jPoint, iteration, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector, iParent, jVertex, *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL, *Parent_Remote = NULL, *Children_Remote = NULL, *Parent_Local = NULL, *Children_Local = NULL;
+  short marker_seed;
+  bool agglomerate_seed = true;
+  unsigned short nChildren, iNode, iMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
+  vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
+  vector<unsigned long>::iterator it;
+  
+#ifdef HAVE_MPI
+  int send_to, receive_from;
+  MPI_Status status;
+#endif
+  
+  /*--- Create a queue system to deo the agglomeration
+   1st) More than two markers ---> Vertices (never agglomerate)
+   2nd) Two markers ---> Edges (agglomerate if same BC, never agglomerate if different BC)
+   3rd) One marker ---> Surface (always agglomarate)
+   4th) No marker ---> Internal Volume (always agglomarate) ---*/
+  
+  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
+  
+  /*--- The geometrical check and the physical marker of the fine points do not
+   depend on the agglomeration, evaluate them beforehand (threaded over the points) ---*/
+  
+  Geometrical_Check = new bool [fine_grid->GetnPoint()];
+  Point_Marker = new short [fine_grid->GetnPoint()];
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (long iPoint_Fine = 0; iPoint_Fine < (long)fine_grid->GetnPoint(); iPoint_Fine++) {
+    Geometrical_Check[iPoint_Fine] = GeometricalCheck(iPoint_Fine, fine_grid, config);
+    Point_Marker[iPoint_Fine] = GetPoint_Marker(iPoint_Fine, fine_grid, config);
+  }
+  
   Index_CoarseCV = 0;
   
   /*--- The first step is the boundary agglomeration. ---*/
@@ -12462,7 +13542,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
       
       if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
           (fine_grid->node[iPoint]->GetDomain()) &&
-          (GeometricalCheck(iPoint, fine_grid, config))) {
+          (Geometrical_Check[iPoint])) {
         
         nChildren = 1;
         
@@ -12473,35 +13553,13 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
         /*--- We add the seed point (child) to the parent control volume ---*/
         
         node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
-        agglomerate_seed = true; counter = 0; marker_seed = iMarker;
-        
-        /*--- For a particular point in the fine grid we save all the markers
-         that are in that point ---*/
-        
-        for (jMarker = 0; jMarker < fine_grid->GetnMarker(); jMarker ++)
-          if (fine_grid->node[iPoint]->GetVertex(jMarker) != -1) {
-            copy_marker[counter] = jMarker;
-            counter++;
-          }
-        
-        /*--- To aglomerate a vertex it must have only one physical bc!!
-         This can be improved. If there is only a marker, it is a good
-         candidate for agglomeration ---*/
-        
-        if (counter == 1) agglomerate_seed = true;
-        
-        /*--- If there are two markers, we will aglomerate if one of the
-         marker is SEND_RECEIVE ---*/
         
-        if (counter == 2) {
-          if ((config->GetMarker_All_KindBC(copy_marker[0]) == SEND_RECEIVE) ||
-              (config->GetMarker_All_KindBC(copy_marker[1]) == SEND_RECEIVE)) agglomerate_seed = true;
-          else agglomerate_seed = false;
-        }
-        
-        /*--- If there are more than 2 markers, the aglomeration will be discarted ---*/
+        /*--- To aglomerate a vertex it must have only one physical bc, the
+         interfaces with other partitions (SEND_RECEIVE) do not count. The
+         marker of the seed is its physical marker if it has one ---*/
         
-        if (counter > 2) agglomerate_seed = false;
+        agglomerate_seed = (Point_Marker[iPoint] != -2);
+        marker_seed = (Point_Marker[iPoint] >= 0) ? Point_Marker[iPoint] : iMarker;
         
         /*--- If the seed can be agglomerated, we try to agglomerate more points ---*/
         
@@ -12625,7 +13683,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
     
     if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
         (fine_grid->node[iPoint]->GetDomain()) &&
-        (GeometricalCheck(iPoint, fine_grid, config))) {
+        (Geometrical_Check[iPoint])) {
       
       nChildren = 1;
       
@@ -12652,7 +13710,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
         
         if ((fine_grid->node[CVPoint]->GetAgglomerate() == false) &&
             (fine_grid->node[CVPoint]->GetDomain()) &&
-            (GeometricalCheck(CVPoint, fine_grid, config))) {
+            (Geometrical_Check[CVPoint])) {
           
           /*--- We set the value of the parent ---*/
           
@@ -12749,15 +13807,19 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
   unsigned long iFinePoint, iFinePoint_Neighbor, iCoarsePoint, iCoarsePoint_Complete;
   unsigned short iChildren;
   
-  /*--- Find the point surrounding a point ---*/
+  /*--- Find the point surrounding a point (threaded over the coarse points,
+   each thread only modifies the neighbors of its own points) ---*/
   
-  for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
-    for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(dynamic, 256) private(iChildren, iNode, iFinePoint, iFinePoint_Neighbor, iParent)
+#endif
+  for (long iCoarse = 0; iCoarse < (long)nPointDomain; iCoarse++) {
+    for (iChildren = 0; iChildren <  node[iCoarse]->GetnChildren_CV(); iChildren ++) {
+      iFinePoint = node[iCoarse]->GetChildren_CV(iChildren);
       for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
         iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
         iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
-        if (iParent != iCoarsePoint) node[iCoarsePoint]->SetPoint(iParent);
+        if (iParent != (unsigned long)iCoarse) node[iCoarse]->SetPoint(iParent);
       }
     }
   }
@@ -12962,116 +14024,257 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
   
   /*--- Update the number of points after the MPI agglomeration ---*/
   
-  nPoint = Index_CoarseCV;
+  nPoint = Index_CoarseCV;
+  
+  delete [] Geometrical_Check; Geometrical_Check = NULL;
+  delete [] Point_Marker;      Point_Marker = NULL;
+  
+}
+
+CMultiGridGeometry::~CMultiGridGeometry(void) {
+  
+  if (Geometrical_Check != NULL) delete [] Geometrical_Check;
+  if (Point_Marker      != NULL) delete [] Point_Marker;
+  
+}
+
+short CMultiGridGeometry::GetPoint_Marker(unsigned long iPoint, CGeometry *fine_grid, CConfig *config) {
+  
+  unsigned short iMarker;
+  short Marker = -1;
+  
+  for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++)
+    if ((fine_grid->node[iPoint]->GetVertex(iMarker) != -1) &&
+        (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE))
+      Marker = (Marker == -1) ? short(iMarker) : -2;
+  
+  return Marker;
+  
+}
+
+unsigned long CMultiGridGeometry::GetAgglomeration_Checksum(CGeometry *fine_grid, CConfig *config) {
+  
+  unsigned long iPoint, iEdge, Checksum;
+  unsigned short iMarker, iChar;
+  string Marker_Tag;
+  
+  /*--- Edge connectivity ---*/
+  
+  Checksum = fine_grid->GetnEdge();
+  for (iEdge = 0; iEdge < fine_grid->GetnEdge(); iEdge++) {
+    Checksum = 31*Checksum + fine_grid->edge[iEdge]->GetNode(0);
+    Checksum = 31*Checksum + fine_grid->edge[iEdge]->GetNode(1);
+  }
+  
+  /*--- Marker tags and boundary conditions, the agglomeration
+   never merges control volumes of different markers ---*/
+  
+  Checksum = 31*Checksum + fine_grid->GetnMarker();
+  for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
+    Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+    for (iChar = 0; iChar < Marker_Tag.size(); iChar++)
+      Checksum = 31*Checksum + (unsigned char)Marker_Tag[iChar];
+    Checksum = 31*Checksum + config->GetMarker_All_KindBC(iMarker);
+  }
+  
+  /*--- Physical marker of each point ---*/
+  
+  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint++)
+    Checksum = 31*Checksum + (unsigned long)(GetPoint_Marker(iPoint, fine_grid, config)+2);
+  
+  return Checksum;
+  
+}
+
+bool CMultiGridGeometry::Read_Agglomeration(CGeometry *fine_grid, CConfig *config, unsigned short iMesh, unsigned short iZone) {
+  
+  unsigned long iPoint, iCoarse, iChildren, nChildren, Position, Checksum, Stored_Header[8], Header[8], nData = 0, Coarse_nPoint = 0, Coarse_nPointDomain = 0;
+  int rank = MASTER_NODE, size = SINGLE_NODE, Local_Valid, Global_Valid;
+  char buffer[50];
+  vector<unsigned long> Data;
+  
+  if (!config->GetMG_Agglomeration_Reuse()) return false;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  /*--- One file per rank and multigrid level, the fine grid must be exactly the same
+   (size, partition, edge connectivity and markers) as in the run that stored the agglomeration ---*/
+  
+  string filename = config->GetMultizone_FileName(config->GetMG_Agglomeration_FileName(), iZone);
+  unsigned short lastindex = filename.find_last_of(".");
+  filename = filename.substr(0, lastindex);
+  SPRINTF (buffer, "_%d_%d.dat", rank, int(iMesh));
+  filename.append(string(buffer));
+  
+  Checksum = GetAgglomeration_Checksum(fine_grid, config);
+  
+  Header[0] = 0x53553247;               Header[1] = nDim;
+  Header[2] = iMesh;                    Header[3] = size;
+  Header[4] = fine_grid->GetnPoint();   Header[5] = fine_grid->GetnPointDomain();
+  Header[6] = fine_grid->GetnEdge();    Header[7] = Checksum;
+  
+  ifstream agglomeration_file(filename.c_str(), ios::in | ios::binary);
+  
+  Local_Valid = agglomeration_file.is_open();
+  
+  if (Local_Valid) {
+    
+    /*--- Check the header and read the rest of the file ---*/
+    
+    agglomeration_file.read((char *)Stored_Header, 8*sizeof(unsigned long));
+    for (unsigned short iHeader = 0; iHeader < 8; iHeader++)
+      if (!agglomeration_file.good() || (Stored_Header[iHeader] != Header[iHeader])) Local_Valid = false;
+    
+    if (Local_Valid) {
+      agglomeration_file.seekg(0, ios::end);
+      nData = ((unsigned long)agglomeration_file.tellg() - 8*sizeof(unsigned long))/sizeof(unsigned long);
+      agglomeration_file.seekg(8*sizeof(unsigned long), ios::beg);
+      Data.resize(nData+1);
+      agglomeration_file.read((char *)&Data[0], nData*sizeof(unsigned long));
+      if (!agglomeration_file.good() || (nData < 2+fine_grid->GetnPoint())) Local_Valid = false;
+    }
+    
+    agglomeration_file.close();
+    
+  }
+  
+  /*--- Check that the data is consistent: number of coarse points, parents
+   of the fine points and the children list of every coarse point ---*/
+  
+  if (Local_Valid) {
+    Coarse_nPointDomain = Data[0]; Coarse_nPoint = Data[1];
+    if ((Coarse_nPoint > fine_grid->GetnPoint()) || (Coarse_nPointDomain > Coarse_nPoint)) Local_Valid = false;
+    for (iPoint = 0; (iPoint < fine_grid->GetnPoint()) && Local_Valid; iPoint++)
+      if (Data[2+iPoint] >= Coarse_nPoint) Local_Valid = false;
+    Position = 2+fine_grid->GetnPoint();
+    for (iCoarse = 0; (iCoarse < Coarse_nPoint) && Local_Valid; iCoarse++) {
+      if (Position+2 > nData) { Local_Valid = false; break; }
+      nChildren = Data[Position];
+      if (Position+2+nChildren > nData) { Local_Valid = false; break; }
+      for (iChildren = 0; iChildren < nChildren; iChildren++)
+        if (Data[Position+2+iChildren] >= fine_grid->GetnPoint()) Local_Valid = false;
+      Position += 2+nChildren;
+    }
+    if (Local_Valid && (Position != nData)) Local_Valid = false;
+  }
+  
+  /*--- Either all the ranks reuse the agglomeration or all of them rebuild it,
+   the agglomeration of the halo points depends on the neighbor ranks ---*/
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&Local_Valid, &Global_Valid, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#else
+  Global_Valid = Local_Valid;
+#endif
+  
+  if (!Global_Valid) return false;
+  
+  /*--- Set the parent/children topology, the geometry of the coarse
+   level is computed later from the fine grid as usual ---*/
+  
+  nPointDomain = Coarse_nPointDomain;
+  nPoint = Coarse_nPoint;
+  
+  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint++)
+    fine_grid->node[iPoint]->SetParent_CV(Data[2+iPoint]);
+  
+  Position = 2+fine_grid->GetnPoint();
+  for (iCoarse = 0; iCoarse < nPoint; iCoarse++) {
+    nChildren = Data[Position];
+    node[iCoarse]->SetDomain((Data[Position+1] & 1) != 0);
+    node[iCoarse]->SetAgglomerate_Indirect((Data[Position+1] & 2) != 0);
+    for (iChildren = 0; iChildren < nChildren; iChildren++)
+      node[iCoarse]->SetChildren_CV(iChildren, Data[Position+2+iChildren]);
+    node[iCoarse]->SetnChildren_CV(nChildren);
+    Position += 2+nChildren;
+  }
+  
+  if (rank == MASTER_NODE)
+    cout << "MG level: " << iMesh << " -> Reusing the agglomeration stored in " << filename << "." << endl;
+  
+  return true;
   
-  /*--- Console output with the summary of the agglomeration ---*/
+}
+
+void CMultiGridGeometry::Write_Agglomeration(CGeometry *fine_grid, CConfig *config, unsigned short iMesh, unsigned short iZone) {
   
-  Local_nPointCoarse = nPoint;
-  Local_nPointFine = fine_grid->GetnPoint();
+  unsigned long iPoint, iCoarse, iChildren, Checksum, Header[8];
+  int rank = MASTER_NODE, size = SINGLE_NODE;
+  char buffer[50];
+  vector<unsigned long> Data;
   
 #ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#else
-  Global_nPointCoarse = Local_nPointCoarse;
-  Global_nPointFine = Local_nPointFine;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
 #endif
   
-  su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
+  /*--- Same file name and header as in Read_Agglomeration ---*/
   
-  if (iMesh != MESH_0) {
-    if (nDim == 2) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./2.);
-    if (nDim == 3) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./3.);
-    CFL = factor*config->GetCFL(iMesh-1)/Coeff;
-    config->SetCFL(iMesh, CFL);
-  }
+  string filename = config->GetMultizone_FileName(config->GetMG_Agglomeration_FileName(), iZone);
+  unsigned short lastindex = filename.find_last_of(".");
+  filename = filename.substr(0, lastindex);
+  SPRINTF (buffer, "_%d_%d.dat", rank, int(iMesh));
+  filename.append(string(buffer));
   
-  su2double ratio = su2double(Global_nPointFine)/su2double(Global_nPointCoarse);
+  Checksum = GetAgglomeration_Checksum(fine_grid, config);
   
-  if (((nDim == 2) && (ratio < 2.5)) ||
-      ((nDim == 3) && (ratio < 2.5))) {
-    config->SetMGLevels(iMesh-1);
+  Header[0] = 0x53553247;               Header[1] = nDim;
+  Header[2] = iMesh;                    Header[3] = size;
+  Header[4] = fine_grid->GetnPoint();   Header[5] = fine_grid->GetnPointDomain();
+  Header[6] = fine_grid->GetnEdge();    Header[7] = Checksum;
+  
+  /*--- Number of coarse points, parent of each fine point, and for each coarse point
+   the number of children, the domain and indirect agglomeration flags and the children ---*/
+  
+  Data.push_back(nPointDomain);
+  Data.push_back(nPoint);
+  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint++)
+    Data.push_back(fine_grid->node[iPoint]->GetParent_CV());
+  for (iCoarse = 0; iCoarse < nPoint; iCoarse++) {
+    Data.push_back(node[iCoarse]->GetnChildren_CV());
+    Data.push_back((node[iCoarse]->GetDomain()? 1 : 0) + (node[iCoarse]->GetAgglomerate_Indirect()? 2 : 0));
+    for (iChildren = 0; iChildren < node[iCoarse]->GetnChildren_CV(); iChildren++)
+      Data.push_back(node[iCoarse]->GetChildren_CV(iChildren));
   }
-  else {
-    if (rank == MASTER_NODE) {
-      if (iMesh == 1) cout <<"MG level: "<< iMesh-1 <<" -> CVs: " << Global_nPointFine << ". Agglomeration rate 1/1.00. CFL "<< config->GetCFL(iMesh-1) <<"." << endl;
-      cout <<"MG level: "<< iMesh <<" -> CVs: " << Global_nPointCoarse << ". Agglomeration rate 1/" << ratio <<". CFL "<< CFL <<"." << endl;
-    }
+  
+  ofstream agglomeration_file(filename.c_str(), ios::out | ios::binary);
+  
+  if (!agglomeration_file.is_open()) {
+    cout << "Unable to write the multigrid agglomeration file " << filename << "." << endl;
+    return;
   }
- 
-  delete [] copy_marker;
   
-}
-
-
-CMultiGridGeometry::~CMultiGridGeometry(void) {
+  agglomeration_file.write((char *)Header, 8*sizeof(unsigned long));
+  agglomeration_file.write((char *)&Data[0], Data.size()*sizeof(unsigned long));
+  agglomeration_file.close();
   
 }
 
 bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, CGeometry *fine_grid, CConfig *config) {
   
   bool agglomerate_CV = false;
-  unsigned short counter, jMarker;
   
-  unsigned short nMarker_Max = config->GetnMarker_Max();
-  
-  unsigned short *copy_marker = new unsigned short [nMarker_Max];
-
   /*--- Basic condition, the element has not being previously agglomerated, it belongs to the domain,
    and has passed some basic geometrical check ---*/
   
   if ((fine_grid->node[CVPoint]->GetAgglomerate() == false) &&
       (fine_grid->node[CVPoint]->GetDomain()) &&
-      (GeometricalCheck(CVPoint, fine_grid, config))) {
+      (Geometrical_Check[CVPoint])) {
     
     /*--- If the element belong to the boundary, we must be careful ---*/
     
     if (fine_grid->node[CVPoint]->GetBoundary()) {
       
-      /*--- Identify the markers of the vertex that we want to agglomerate ---*/
-      
-      counter = 0;
-      for (jMarker = 0; jMarker < fine_grid->GetnMarker(); jMarker ++)
-        if (fine_grid->node[CVPoint]->GetVertex(jMarker) != -1) {
-          copy_marker[counter] = jMarker;
-          counter++;
-        }
-      
-      /*--- The basic condition is that the aglomerated vertex must have the same physical marker,
-       but eventually a send-receive condition ---*/
-      
-      /*--- Only one marker in the vertex that is going to be aglomerated ---*/
+      /*--- The basic condition is that the aglomerated vertex must have the same physical marker
+       as the seed. The interfaces with other partitions (SEND_RECEIVE) are not taken into account,
+       a vertex on one or several interfaces and no physical marker is always agglomerated, so that
+       the coarsening does not stall at the boundaries of the partitions ---*/
       
-      if (counter == 1) {
-        
-        /*--- We agglomerate if there is only a marker and is the same marker as the seed marker ---*/
-        
-        if (copy_marker[0] == marker_seed)
-          agglomerate_CV = true;
-        
-        /*--- If there is only a marker, but the marker is the SEND_RECEIVE ---*/
-        
-        if (config->GetMarker_All_KindBC(copy_marker[0]) == SEND_RECEIVE)
-          agglomerate_CV = true;
-        
-      }
-      
-      /*--- If there are two markers in the vertex that is going to be aglomerated ---*/
-      
-      if (counter == 2) {
-        
-        /*--- First we verify that the seed is a physical boundary ---*/
-        
-        if (config->GetMarker_All_KindBC(marker_seed) != SEND_RECEIVE) {
-          
-          /*--- Then we check that one of the marker is equal to the seed marker, and the other is send/receive ---*/
-          
-          if (((copy_marker[0] == marker_seed) && (config->GetMarker_All_KindBC(copy_marker[1]) == SEND_RECEIVE)) ||
-              ((config->GetMarker_All_KindBC(copy_marker[0]) == SEND_RECEIVE) && (copy_marker[1] == marker_seed)))
-            agglomerate_CV = true;
-        }
-        
-      }
+      if ((Point_Marker[CVPoint] == -1) || (Point_Marker[CVPoint] == marker_seed))
+        agglomerate_CV = true;
       
     }
     
@@ -13081,8 +14284,6 @@ bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short mark
     
   }
   
-  delete [] copy_marker;
-
   return agglomerate_CV;
 
 }
@@ -13264,15 +14465,19 @@ void CMultiGridGeometry::SetPoint_Connectivity(CGeometry *fine_grid) {
   unsigned long iFinePoint, iFinePoint_Neighbor, iParent, iCoarsePoint;
   unsigned short iChildren, iNode;
   
-  /*--- Set the point surrounding a point ---*/
+  /*--- Set the point surrounding a point (threaded over the coarse points,
+   each thread only modifies the neighbors of its own points) ---*/
   
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
-    for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(dynamic, 256) private(iChildren, iNode, iFinePoint, iFinePoint_Neighbor, iParent)
+#endif
+  for (long iCoarse = 0; iCoarse < (long)nPoint; iCoarse++) {
+    for (iChildren = 0; iChildren <  node[iCoarse]->GetnChildren_CV(); iChildren ++) {
+      iFinePoint = node[iCoarse]->GetChildren_CV(iChildren);
       for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
         iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
         iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
-        if (iParent != iCoarsePoint) node[iCoarsePoint]->SetPoint(iParent);
+        if (iParent != (unsigned long)iCoarse) node[iCoarse]->SetPoint(iParent);
       }
     }
   }
@@ -14679,3 +15884,408 @@ void CMultiGridQueue::Update(unsigned long iPoint, CGeometry *fine_grid) {
   }
   
 }
+
+CHaloExchange::CHaloExchange(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short iMarker, MarkerS, MarkerR, iNeighbor, iRotation;
+  unsigned long iVertex, iSend, iReceive, iEdge, iPoint, jPoint;
+  su2double *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *rot;
+  
+  nDim = geometry->GetnDim();
+  nVar_Comm = 0; nBuffer_Var = 0;
+  Buffer_Send = NULL; Buffer_Receive = NULL;
+  Comm_Pending = false; Comm_Tag = 0;
+  
+  /*--- Count the send/receive marker pairs and their vertices ---*/
+  
+  nNeighbor = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) nNeighbor++;
+  
+  Send_To = new int[nNeighbor];
+  Receive_From = new int[nNeighbor];
+  Send_Offset = new unsigned long[nNeighbor+1];
+  Receive_Offset = new unsigned long[nNeighbor+1];
+  Send_Offset[0] = 0; Receive_Offset[0] = 0;
+  
+  iNeighbor = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+      Send_To[iNeighbor] = config->GetMarker_All_SendRecv(MarkerS)-1;
+      Receive_From[iNeighbor] = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+      Send_Offset[iNeighbor+1] = Send_Offset[iNeighbor] + geometry->nVertex[MarkerS];
+      Receive_Offset[iNeighbor+1] = Receive_Offset[iNeighbor] + geometry->nVertex[MarkerR];
+      iNeighbor++;
+    }
+  }
+  
+  /*--- Flatten the vertex lists of the markers ---*/
+  
+  Send_Point = new unsigned long[Send_Offset[nNeighbor]];
+  Receive_Point = new unsigned long[Receive_Offset[nNeighbor]];
+  Receive_Rotation = new unsigned short[Receive_Offset[nNeighbor]];
+  
+  iNeighbor = 0; iSend = 0; iReceive = 0; nRotation = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+      for (iVertex = 0; iVertex < geometry->nVertex[MarkerS]; iVertex++)
+        Send_Point[iSend++] = geometry->vertex[MarkerS][iVertex]->GetNode();
+      for (iVertex = 0; iVertex < geometry->nVertex[MarkerR]; iVertex++) {
+        Receive_Point[iReceive] = geometry->vertex[MarkerR][iVertex]->GetNode();
+        Receive_Rotation[iReceive] = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
+        nRotation = max(nRotation, (unsigned short)(Receive_Rotation[iReceive]+1));
+        iReceive++;
+      }
+    }
+  }
+  
+  /*--- Compute once the rotation matrix of every periodic transformation in use. Note that the
+   implicit ordering is rotation about the x-axis, y-axis, then z-axis, and that this is the
+   transpose of the matrix used during the preprocessing stage. ---*/
+  
+  RotMatrix = new su2double[nRotation*9];
+  Rotation_Identity = new bool[nRotation];
+  for (iRotation = 0; iRotation < nRotation; iRotation++) Rotation_Identity[iRotation] = true;
+  
+  for (iReceive = 0; iReceive < Receive_Offset[nNeighbor]; iReceive++) {
+    
+    iRotation = Receive_Rotation[iReceive];
+    if (!Rotation_Identity[iRotation]) continue;
+    
+    angles = config->GetPeriodicRotation(iRotation);
+    theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
+    if ((theta == 0.0) && (phi == 0.0) && (psi == 0.0)) continue;
+    
+    cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+    sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
+    
+    rot = &RotMatrix[iRotation*9];
+    rot[0] = cosPhi*cosPsi;    rot[3] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rot[6] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+    rot[1] = cosPhi*sinPsi;    rot[4] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rot[7] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+    rot[2] = -sinPhi;          rot[5] = sinTheta*cosPhi;                              rot[8] = cosTheta*cosPhi;
+    
+    Rotation_Identity[iRotation] = false;
+  }
+  
+#ifdef HAVE_MPI
+  Request = new MPI_Request[2*nNeighbor];
+  Status = new MPI_Status[2*nNeighbor];
+#endif
+  
+  /*--- Split the edges: the interior ones can be computed while the halo data is on its way ---*/
+  
+  nEdge_Interior = 0; nEdge_Halo = 0;
+  Edge_List = new unsigned long[geometry->GetnEdge()];
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    iPoint = geometry->edge[iEdge]->GetNode(0);
+    jPoint = geometry->edge[iEdge]->GetNode(1);
+    if (geometry->node[iPoint]->GetDomain() && geometry->node[jPoint]->GetDomain())
+      Edge_List[nEdge_Interior++] = iEdge;
+  }
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    iPoint = geometry->edge[iEdge]->GetNode(0);
+    jPoint = geometry->edge[iEdge]->GetNode(1);
+    if (!geometry->node[iPoint]->GetDomain() || !geometry->node[jPoint]->GetDomain())
+      Edge_List[nEdge_Interior + nEdge_Halo++] = iEdge;
+  }
+  
+}
+
+CHaloExchange::~CHaloExchange(void) {
+  
+  FinishComms();
+  
+  delete [] Send_To;
+  delete [] Receive_From;
+  delete [] Send_Offset;
+  delete [] Receive_Offset;
+  delete [] Send_Point;
+  delete [] Receive_Point;
+  delete [] Receive_Rotation;
+  delete [] RotMatrix;
+  delete [] Rotation_Identity;
+  delete [] Edge_List;
+  if (Buffer_Send != NULL) delete [] Buffer_Send;
+  if (Buffer_Receive != NULL) delete [] Buffer_Receive;
+  
+#ifdef HAVE_MPI
+  delete [] Request;
+  delete [] Status;
+#endif
+  
+}
+
+su2double *CHaloExchange::GetBuffer_Send(unsigned short val_nVar) {
+  
+  /*--- The buffers of a pending exchange are still in use ---*/
+  
+  FinishComms();
+  
+  /*--- Grow the buffers only when needed, they are kept for the next exchanges ---*/
+  
+  if (val_nVar > nBuffer_Var) {
+    if (Buffer_Send != NULL) delete [] Buffer_Send;
+    if (Buffer_Receive != NULL) delete [] Buffer_Receive;
+    nBuffer_Var = val_nVar;
+    Buffer_Send = new su2double[Send_Offset[nNeighbor]*nBuffer_Var];
+    Buffer_Receive = new su2double[Receive_Offset[nNeighbor]*nBuffer_Var];
+  }
+  
+  nVar_Comm = val_nVar;
+  
+  return Buffer_Send;
+  
+}
+
+void CHaloExchange::Rotate(unsigned long val_receive, su2double *val_vector) {
+  
+  unsigned short iRotation = Receive_Rotation[val_receive];
+  su2double *rot, vec[3] = {0.0, 0.0, 0.0};
+  
+  if (Rotation_Identity[iRotation]) return;
+  
+  rot = &RotMatrix[iRotation*9];
+  
+  if (nDim == 2) {
+    vec[0] = rot[0]*val_vector[0] + rot[1]*val_vector[1];
+    vec[1] = rot[3]*val_vector[0] + rot[4]*val_vector[1];
+    val_vector[0] = vec[0]; val_vector[1] = vec[1];
+  }
+  else {
+    vec[0] = rot[0]*val_vector[0] + rot[1]*val_vector[1] + rot[2]*val_vector[2];
+    vec[1] = rot[3]*val_vector[0] + rot[4]*val_vector[1] + rot[5]*val_vector[2];
+    vec[2] = rot[6]*val_vector[0] + rot[7]*val_vector[1] + rot[8]*val_vector[2];
+    val_vector[0] = vec[0]; val_vector[1] = vec[1]; val_vector[2] = vec[2];
+  }
+  
+}
+
+void CHaloExchange::StartComms(int val_tag) {
+  
+  Comm_Tag = val_tag;
+  
+#ifdef HAVE_MPI
+  
+  unsigned short iNeighbor;
+  int count;
+  
+  /*--- Post all the receives first, then the sends, in marker order as the blocking exchange did ---*/
+  
+  for (iNeighbor = 0; iNeighbor < nNeighbor; iNeighbor++) {
+    count = (Receive_Offset[iNeighbor+1]-Receive_Offset[iNeighbor])*nVar_Comm;
+    SU2_MPI::Irecv(&Buffer_Receive[Receive_Offset[iNeighbor]*nVar_Comm], count, MPI_DOUBLE,
+                   Receive_From[iNeighbor], Comm_Tag, MPI_COMM_WORLD, &Request[iNeighbor]);
+  }
+  
+  for (iNeighbor = 0; iNeighbor < nNeighbor; iNeighbor++) {
+    count = (Send_Offset[iNeighbor+1]-Send_Offset[iNeighbor])*nVar_Comm;
+    SU2_MPI::Isend(&Buffer_Send[Send_Offset[iNeighbor]*nVar_Comm], count, MPI_DOUBLE,
+                   Send_To[iNeighbor], Comm_Tag, MPI_COMM_WORLD, &Request[nNeighbor+iNeighbor]);
+  }
+  
+#else
+  
+  /*--- Without MPI the only send/receive markers are periodic, and each
+   receive marker matches the send marker of the same pair ---*/
+  
+  for (unsigned long iBuffer = 0; iBuffer < min(Send_Offset[nNeighbor], Receive_Offset[nNeighbor])*nVar_Comm; iBuffer++)
+    Buffer_Receive[iBuffer] = Buffer_Send[iBuffer];
+  
+#endif
+  
+  Comm_Pending = true;
+  
+}
+
+void CHaloExchange::FinishComms(void) {
+  
+  if (!Comm_Pending) return;
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Waitall(2*nNeighbor, Request, Status);
+#endif
+  
+  Comm_Pending = false;
+  
+}
+
+CSU2BinaryMesh::CSU2BinaryMesh(unsigned short val_nDim) {
+  
+  nDim = val_nDim;
+  nPoint = 0; nPointDomain = 0;
+  
+  Elem_Ptr.push_back(0);
+  Marker_Ptr.push_back(0);
+  Bound_Ptr.push_back(0);
+  
+}
+
+CSU2BinaryMesh::~CSU2BinaryMesh(void) { }
+
+void CSU2BinaryMesh::AddElem(unsigned long val_VTK_Type, unsigned short val_nNodes, const unsigned long *val_Nodes) {
+  
+  Elem_Conn.push_back(val_VTK_Type);
+  Elem_Conn.insert(Elem_Conn.end(), val_Nodes, val_Nodes+val_nNodes);
+  Elem_Ptr.push_back(Elem_Conn.size());
+  
+}
+
+void CSU2BinaryMesh::AddMarker(string val_Tag, long val_SendRecv) {
+  
+  Marker_Tag.push_back(val_Tag);
+  Marker_SendRecv.push_back(val_SendRecv);
+  Marker_Ptr.push_back(Bound_Ptr.size()-1);
+  
+}
+
+void CSU2BinaryMesh::AddBound(unsigned long val_VTK_Type, unsigned short val_nNodes, const unsigned long *val_Nodes) {
+  
+  Bound_Conn.push_back(val_VTK_Type);
+  Bound_Conn.insert(Bound_Conn.end(), val_Nodes, val_Nodes+val_nNodes);
+  Bound_Ptr.push_back(Bound_Conn.size());
+  Marker_Ptr.back() = Bound_Ptr.size()-1;
+  
+}
+
+void CSU2BinaryMesh::Write(string val_filename) {
+  
+  unsigned long header[HEADER_SIZE], iMarker;
+  unsigned long nMarker = Marker_Tag.size();
+  const unsigned long size_ul = sizeof(unsigned long), size_dbl = sizeof(passivedouble);
+  
+  /*--- Sizes and offsets of the sections, in the order they are written ---*/
+  
+  header[HEADER_NDIM]         = nDim;
+  header[HEADER_NPOINT]       = nPoint;
+  header[HEADER_NPOINTDOMAIN] = nPointDomain;
+  header[HEADER_NELEM]        = Elem_Ptr.size()-1;
+  header[HEADER_NMARKER]      = nMarker;
+  header[HEADER_NBOUND]       = Bound_Ptr.size()-1;
+  header[HEADER_NPERIODIC]    = Periodic.size()/9;
+  
+  header[HEADER_COORD]      = 8 + HEADER_SIZE*size_ul;
+  header[HEADER_ELEM_PTR]   = header[HEADER_COORD]      + Coord.size()*size_dbl;
+  header[HEADER_ELEM_CONN]  = header[HEADER_ELEM_PTR]   + Elem_Ptr.size()*size_ul;
+  header[HEADER_MARKER]     = header[HEADER_ELEM_CONN]  + Elem_Conn.size()*size_ul;
+  header[HEADER_BOUND_PTR]  = header[HEADER_MARKER]     + nMarker*(MAX_STRING_SIZE+2*size_ul) + size_ul;
+  header[HEADER_BOUND_CONN] = header[HEADER_BOUND_PTR]  + Bound_Ptr.size()*size_ul;
+  header[HEADER_PERIODIC]   = header[HEADER_BOUND_CONN] + Bound_Conn.size()*size_ul;
+  
+  /*--- Fixed length tags ---*/
+  
+  vector<char> Tags(nMarker*MAX_STRING_SIZE, '\0');
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    strncpy(&Tags[iMarker*MAX_STRING_SIZE], Marker_Tag[iMarker].c_str(), MAX_STRING_SIZE-1);
+  
+  ofstream mesh_file(val_filename.c_str(), ios::out | ios::binary);
+  
+  if (mesh_file.fail()) {
+    cout << "Unable to open the binary mesh file " << val_filename << "." << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  mesh_file.write("SU2BIN01", 8);
+  mesh_file.write((char*)header, HEADER_SIZE*size_ul);
+  mesh_file.write((char*)Coord.data(), Coord.size()*size_dbl);
+  mesh_file.write((char*)Elem_Ptr.data(), Elem_Ptr.size()*size_ul);
+  mesh_file.write((char*)Elem_Conn.data(), Elem_Conn.size()*size_ul);
+  mesh_file.write(Tags.data(), Tags.size());
+  mesh_file.write((char*)Marker_SendRecv.data(), nMarker*size_ul);
+  mesh_file.write((char*)Marker_Ptr.data(), Marker_Ptr.size()*size_ul);
+  mesh_file.write((char*)Bound_Ptr.data(), Bound_Ptr.size()*size_ul);
+  mesh_file.write((char*)Bound_Conn.data(), Bound_Conn.size()*size_ul);
+  mesh_file.write((char*)Periodic.data(), Periodic.size()*size_dbl);
+  
+  mesh_file.close();
+  
+}
+
+bool CSU2BinaryMesh::OpenFile(string val_filename, FileHandle &fh) {
+  
+#ifdef HAVE_MPI
+  char fname[MAX_STRING_SIZE];
+  strncpy(fname, val_filename.c_str(), MAX_STRING_SIZE-1); fname[MAX_STRING_SIZE-1] = '\0';
+  return (MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh) == MPI_SUCCESS);
+#else
+  fh = fopen(val_filename.c_str(), "rb");
+  return (fh != NULL);
+#endif
+  
+}
+
+bool CSU2BinaryMesh::ReadHeader(FileHandle fh, string val_filename, unsigned long *header) {
+  
+  char signature[9] = "";
+  
+  ReadBlock(fh, val_filename, 0, signature, 8);
+  if ((strcmp(signature, "SU2BIN01") != 0) || (sizeof(unsigned long) != 8)) return false;
+  
+  ReadBlock(fh, val_filename, 8, header, HEADER_SIZE*sizeof(unsigned long));
+  return true;
+  
+}
+
+void CSU2BinaryMesh::ReadBlock(FileHandle fh, string val_filename, unsigned long val_offset, void *val_buffer, unsigned long val_nBytes) {
+  
+  char *buffer = (char*)val_buffer;
+  bool complete = true;
+  
+#ifdef HAVE_MPI
+  
+  /*--- MPI counts are int, large ranges are read in pieces ---*/
+  
+  const unsigned long max_bytes = 1073741824;
+  MPI_Status status;
+  int nBytes, nBytes_Read;
+  while ((val_nBytes > 0) && complete) {
+    nBytes = (int)min(val_nBytes, max_bytes);
+    if (MPI_File_read_at(fh, (MPI_Offset)val_offset, buffer, nBytes, MPI_BYTE, &status) != MPI_SUCCESS) complete = false;
+    else {
+      MPI_Get_count(&status, MPI_BYTE, &nBytes_Read);
+      if (nBytes_Read != nBytes) complete = false;
+    }
+    val_offset += nBytes; buffer += nBytes; val_nBytes -= nBytes;
+  }
+  
+#else
+  
+  if (val_nBytes > 0) {
+    if (fseek(fh, val_offset, SEEK_SET) != 0) complete = false;
+    else if (fread(buffer, 1, val_nBytes, fh) != val_nBytes) complete = false;
+  }
+  
+#endif
+  
+  /*--- A short read means a truncated or corrupt file, its contents can not be used ---*/
+  
+  if (!complete) {
+    cout << "The binary file " << val_filename << " is truncated or can not be read." << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+}
+
+void CSU2BinaryMesh::CloseFile(FileHandle &fh) {
+  
+#ifdef HAVE_MPI
+  MPI_File_close(&fh);
+#else
+  fclose(fh);
+#endif
+  
+}
@@ -207,14 +207,24 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
      * hence we need the corresponding matrix vector product and the preconditioner.  ---*/
     if (!Derivative || ((config->GetKind_SU2() == SU2_CFD) && Derivative)){
       mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
-      precond = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
+      if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        StiffMatrix.BuildAMGPreconditioner(config);
+        precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+      }
+      else precond = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
-      /*--- Build the ILU preconditioner for the transposed system ---*/
+      /*--- Build the ILU (or AMG) preconditioner for the transposed system ---*/
 
-      StiffMatrix.BuildILUPreconditioner(true);
       mat_vec = new CSysMatrixVectorProductTransposed(StiffMatrix, geometry, config);
-      precond = new CILUPreconditioner(StiffMatrix, geometry, config);
+      if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        StiffMatrix.BuildAMGPreconditioner(config, true);
+        precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+      }
+      else {
+        StiffMatrix.BuildILUPreconditioner(true);
+        precond = new CILUPreconditioner(StiffMatrix, geometry, config);
+      }
     }
 
     CSysSolve *system  = new CSysSolve();
@@ -274,6 +284,22 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
         
         break;
         
+        /*--- Solve the linear system (FGMRES with a fused reduction per iteration) ---*/
+        
+      case FGMRES_CGS:
+        
+        Tot_Iter = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, &Residual, Screen_Output, true);
+        
+        break;
+        
+        /*--- Solve the linear system (pipelined CG, the stiffness matrix is symmetric) ---*/
+        
+      case PIPELINED_CG:
+        
+        Tot_Iter = system->PipelinedCG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, &Residual, Screen_Output);
+        
+        break;
+        
     }
     
     /*--- Deallocate memory needed by the Krylov linear solver ---*/
@@ -8186,7 +8212,9 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
   if (config->GetDeform_Linear_Solver() == BCGSTAB ||
       config->GetDeform_Linear_Solver() == FGMRES ||
       config->GetDeform_Linear_Solver() == RESTARTED_FGMRES ||
-      config->GetDeform_Linear_Solver() == CONJUGATE_GRADIENT) {
+      config->GetDeform_Linear_Solver() == CONJUGATE_GRADIENT ||
+      config->GetDeform_Linear_Solver() == PIPELINED_CG ||
+      config->GetDeform_Linear_Solver() == FGMRES_CGS) {
 
     /*--- Independently of whether we are using or not derivatives,
      *--- as the matrix is now symmetric, the matrix-vector product
@@ -8209,6 +8237,10 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
     case LU_SGS:
       precond = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
       break;
+    case AMG:
+      StiffMatrix.BuildAMGPreconditioner(config);
+      precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+      break;
     case LINELET:
       StiffMatrix.BuildJacobiPreconditioner();
       precond = new CLineletPreconditioner(StiffMatrix, geometry, config);
@@ -8229,6 +8261,12 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
     case CONJUGATE_GRADIENT:
       IterLinSol = system->CG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, Screen_Output);
       break;
+    case PIPELINED_CG:
+      IterLinSol = system->PipelinedCG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output);
+      break;
+    case FGMRES_CGS:
+      IterLinSol = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output, true);
+      break;
     case RESTARTED_FGMRES:
       IterLinSol = 0;
       while (IterLinSol < config->GetLinear_Solver_Iter()) {
@@ -194,6 +194,101 @@ void CSysSolve::ModGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<
   w[i+1] /= nrm;
 }
 
+void CSysSolve::ClassicalGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w) {
+  
+  int rank = MASTER_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Parameter for reorthonormalization, a second pass is needed when the
+   norm drops below this fraction of its value before the projection (DGKS criterion) ---*/
+  
+  static const su2double reorth = 0.7071;
+  
+  int k, iPass;
+  vector<const CSysVector*> u(i+2, &w[i+1]), v(i+2, &w[i+1]);
+  vector<su2double> prod(i+2, 0.0);
+  su2double nrm = 0.0, nrm0 = 0.0;
+  
+  for (k = 0; k < i+1; k++) {
+    v[k] = &w[k];
+    Hsbg[k][i] = 0.0;
+  }
+  
+  for (iPass = 0; iPass < 2; iPass++) {
+    
+    /*--- Projections on w[0:i] and squared norm of w[i+1], all in one reduction ---*/
+    
+    dotProdFused(i+2, &u[0], &v[0], &prod[0]);
+    nrm0 = prod[i+1];
+    
+    /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN, the value is global so
+     all the processors take the same decision ---*/
+    
+    if ((nrm0 <= 0.0) || (nrm0 != nrm0)) {
+      if (rank == MASTER_NODE)
+        cout << "\n !!! Error: SU2 has diverged. Now exiting... !!! \n" << endl;
+#ifndef HAVE_MPI
+      exit(EXIT_DIVERGENCE);
+#else
+      MPI_Abort(MPI_COMM_WORLD,1);
+#endif
+    }
+    
+    /*--- Remove the projections and get the new norm from Pythagoras ---*/
+    
+    nrm = nrm0;
+    for (k = 0; k < i+1; k++) {
+      Hsbg[k][i] += prod[k];
+      w[i+1].Plus_AX(-prod[k], w[k]);
+      nrm -= prod[k]*prod[k];
+    }
+    if (nrm < 0.0) nrm = 0.0;
+    
+    /*--- Without cancellation the vector is orthogonal enough ---*/
+    
+    if (nrm > nrm0*reorth*reorth) break;
+  }
+  
+  nrm = sqrt(nrm);
+  Hsbg[i+1][i] = nrm;
+  
+  /*--- Scale the resulting vector ---*/
+  
+  w[i+1] /= nrm;
+}
+
+void CSysSolve::StartReduction(unsigned short nDot, su2double *loc_val, su2double *val) {
+  
+#ifdef HAVE_MPI
+  
+  /*--- The non-blocking reduction needs a plain double, the AD and complex types
+   go through the (blocking) wrappers ---*/
+  
+#if (MPI_VERSION >= 3) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE) && !defined(COMPLEX_TYPE)
+  MPI_Iallreduce(loc_val, val, nDot, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD, &ReductionRequest);
+#else
+  SU2_MPI::Allreduce(loc_val, val, nDot, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  ReductionRequest = MPI_REQUEST_NULL;
+#endif
+  
+#else
+  for (unsigned short iDot = 0; iDot < nDot; iDot++)
+    val[iDot] = loc_val[iDot];
+#endif
+  
+}
+
+void CSysSolve::FinishReduction(void) {
+  
+#ifdef HAVE_MPI
+  MPI_Wait(&ReductionRequest, MPI_STATUS_IGNORE);
+#endif
+  
+}
+
 void CSysSolve::WriteHeader(const string & solver, const su2double & restol, const su2double & resinit) {
   
   cout << "\n# " << solver << " residual history" << endl;
@@ -314,8 +409,120 @@ int rank = 0;
   
 }
 
+unsigned long CSysSolve::PipelinedCG_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                                CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+  
+  int rank = 0;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Check the subspace size ---*/
+  if (m < 1) {
+    if (rank == MASTER_NODE) cerr << "CSysSolve::PipelinedCG: illegal value for subspace size, m = " << m << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  CSysVector r(b);
+  CSysVector w(b);
+  
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+  mat_vec(x, w);
+  
+  r -= w; // recall, r holds b initially
+  su2double norm_r = r.norm();
+  su2double norm0 = b.norm();
+  if ( (norm_r < tol*norm0) || (norm_r < eps) ) {
+    if (rank == MASTER_NODE) cout << "CSysSolve::PipelinedCG(): system solved by initial guess." << endl;
+    (*residual) = norm_r;
+    return 0;
+  }
+  
+  /*--- u = M r and w = A u, the other recurrences start at zero ---*/
+  CSysVector u(r);
+  precond(r, u);
+  mat_vec(u, w);
+  
+  CSysVector p(b.GetNBlk(), b.GetNBlkDomain(), b.GetNVar(), 0.0);
+  CSysVector s(p), q(p), z(p), m_vec(p), n_vec(p);
+  
+  /*--- The three inner products of each iteration: (r,u), (w,u) and (r,r) ---*/
+  const CSysVector *dot_u[3] = {&r, &w, &r};
+  const CSysVector *dot_v[3] = {&u, &u, &r};
+  su2double loc_dot[3], dot[3];
+  su2double alpha = 0.0, beta = 0.0, gamma = 0.0, gamma_old = 0.0, delta;
+  
+  /*--- Set the norm to the initial initial residual value ---*/
+  norm0 = norm_r;
+  
+  /*--- Output header information including initial residual ---*/
+  int i = 0;
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    WriteHeader("Pipelined CG", tol, norm_r);
+    WriteHistory(i, norm_r, norm0);
+  }
+  
+  /*---  Loop over all search directions ---*/
+  for (i = 0; i < (int)m; i++) {
+    
+    /*--- Start the reduction, and overlap it with m = M w and n = A m ---*/
+    dotProdLocal(3, dot_u, dot_v, loc_dot);
+    StartReduction(3, loc_dot, dot);
+    
+    precond(w, m_vec);
+    mat_vec(m_vec, n_vec);
+    
+    FinishReduction();
+    
+    /*--- Check if solution has converged, else output the relative residual if necessary ---*/
+    if (dot[2] < 0.0) dot[2] = 0.0;
+    norm_r = sqrt(dot[2]);
+    if (norm_r < tol*norm0) break;
+    if (((monitoring) && (rank == MASTER_NODE)) && (i % 5 == 0) && (i > 0)) WriteHistory(i, norm_r, norm0);
+    
+    /*--- Step-length alpha and Gram-Schmidt coefficient beta from the fused products ---*/
+    gamma = dot[0]; delta = dot[1];
+    if (i > 0) {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta*gamma/alpha);
+    }
+    else {
+      beta = 0.0;
+      alpha = gamma / delta;
+    }
+    gamma_old = gamma;
+    
+    /*--- Update the recurrences: z = n + beta z, q = m + beta q, s = w + beta s, p = u + beta p ---*/
+    z.Equals_AX_Plus_BY(beta, z, 1.0, n_vec);
+    q.Equals_AX_Plus_BY(beta, q, 1.0, m_vec);
+    s.Equals_AX_Plus_BY(beta, s, 1.0, w);
+    p.Equals_AX_Plus_BY(beta, p, 1.0, u);
+    
+    /*--- Update solution, residual, preconditioned residual and its product with A ---*/
+    x.Plus_AX(alpha, p);
+    r.Plus_AX(-alpha, s);
+    u.Plus_AX(-alpha, q);
+    w.Plus_AX(-alpha, z);
+  }
+  
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    cout << "# Pipelined Conjugate Gradient final (true) residual:" << endl;
+    cout << "# Iteration = " << i << ": |res|/|res0| = "  << norm_r/norm0 << ".\n" << endl;
+  }
+  
+  (*residual) = norm_r;
+  return (unsigned long) i;
+  
+}
+
 unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
-                               CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+                               CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring, bool fused_reduction) {
 	
 int rank = 0;
 
@@ -416,9 +623,11 @@ int rank = 0;
     
     mat_vec(z[i], w[i+1]);
     
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Modified Gram-Schmidt orthogonalization, or classical Gram-Schmidt
+     with a single reduction per iteration ---*/
     
-    ModGramSchmidt(i, H, w);
+    if (fused_reduction) ClassicalGramSchmidt(i, H, w);
+    else ModGramSchmidt(i, H, w);
     
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix
 		 then generate the new Givens rotation matrix and apply it to
@@ -610,6 +819,8 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
   unsigned long MaxIter = config->GetLinear_Solver_Iter();
   unsigned long IterLinSol = 0;
   CMatrixVectorProduct *mat_vec;
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_LINEAR_SOLVER);
 
   bool TapeActive = NO;
 
@@ -656,7 +867,9 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
   if (config->GetKind_Linear_Solver() == BCGSTAB ||
       config->GetKind_Linear_Solver() == FGMRES ||
       config->GetKind_Linear_Solver() == RESTARTED_FGMRES ||
-      config->GetKind_Linear_Solver() == CONJUGATE_GRADIENT) {
+      config->GetKind_Linear_Solver() == CONJUGATE_GRADIENT ||
+      config->GetKind_Linear_Solver() == PIPELINED_CG ||
+      config->GetKind_Linear_Solver() == FGMRES_CGS) {
     
     mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
     CPreconditioner* precond = NULL;
@@ -673,6 +886,10 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
       case LU_SGS:
         precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
         break;
+      case AMG:
+        Jacobian.BuildAMGPreconditioner(config);
+        precond = new CAMGPreconditioner(Jacobian, geometry, config);
+        break;
       case LINELET:
         Jacobian.BuildJacobiPreconditioner();
         precond = new CLineletPreconditioner(Jacobian, geometry, config);
@@ -693,6 +910,12 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
       case CONJUGATE_GRADIENT:
         IterLinSol = CG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, false);
         break;
+      case PIPELINED_CG:
+        IterLinSol = PipelinedCG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+        break;
+      case FGMRES_CGS:
+        IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false, true);
+        break;
       case RESTARTED_FGMRES:
         IterLinSol = 0;
         while (IterLinSol < config->GetLinear_Solver_Iter()) {
@@ -752,6 +975,8 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
     SetExternalSolve(Jacobian, LinSysRes, LinSysSol, geometry, config);
 
   }
+  
+  config->Stop_Phase(Previous_Phase);
 
   return IterLinSol;
   
@@ -809,6 +1034,9 @@ void CSysSolve::SetExternalSolve(CSysMatrix & Jacobian, CSysVector & LinSysRes,
     case JACOBI:
       Jacobian.BuildJacobiPreconditioner(true);
       break;
+    case AMG:
+      Jacobian.BuildAMGPreconditioner(config, true);
+      break;
     default:
       cout << "The specified preconditioner is not yet implemented for the discrete adjoint method." << endl;
       exit(EXIT_FAILURE);
@@ -86,6 +86,9 @@ void CSysSolve_b::Solve_b(AD::CheckpointHandler* data){
     case JACOBI:
       precond = new CJacobiPreconditioner(*Jacobian, geometry, config);
       break;
+    case AMG:
+      precond = new CAMGPreconditioner(*Jacobian, geometry, config);
+      break;
   }
 
   CMatrixVectorProduct* mat_vec = new CSysMatrixVectorProductTransposed(*Jacobian, geometry, config);
@@ -103,6 +106,8 @@ void CSysSolve_b::Solve_b(AD::CheckpointHandler* data){
   case CONJUGATE_GRADIENT: cout << " Conjugate Gradient "; break;
   case FGMRES: cout << " FGMRES "; break;
   case BCGSTAB: cout << " BCGSTAB "; break;
+  case PIPELINED_CG: cout << " Pipelined CG "; break;
+  case FGMRES_CGS: cout << " FGMRES (classical Gram-Schmidt) "; break;
   }
   cout << "linear solver with nVar = " << nVar << " and nPoint = " << nBlk << endl;
 
@@ -118,6 +123,12 @@ void CSysSolve_b::Solve_b(AD::CheckpointHandler* data){
     case CONJUGATE_GRADIENT:
       solver->CG_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol , MaxIter, false);
       break;
+    case PIPELINED_CG:
+      solver->PipelinedCG_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol , MaxIter, &Residual, false);
+      break;
+    case FGMRES_CGS:
+      solver->FGMRES_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol , MaxIter, &Residual, false, true);
+      break;
   }
 
 
@@ -44,10 +44,57 @@ CSysMatrix::CSysMatrix(void) {
   prod_row_vector   = NULL;
   aux_vector        = NULL;
   sum_vector        = NULL;
+  thread_vector     = NULL;
   invM              = NULL;
+  ILU_invDiag       = NULL;
+  
+  Matrix_Float      = false;
+  matrix_float      = NULL;
+  matrix_block      = NULL;
+  
+  ILU_Float         = false;
+  ILU_matrix_float  = NULL;
+  ILU_invDiag_float = NULL;
+  ILU_block         = NULL;
+  
+  /*--- Algebraic multigrid ---*/
+  
+  AMG_nLevel        = 0;
+  AMG_Matrix        = NULL;
+  AMG_Prolong_ptr   = NULL;
+  AMG_Prolong_col   = NULL;
+  AMG_Prolong_val   = NULL;
+  AMG_Restrict_ptr  = NULL;
+  AMG_Restrict_row  = NULL;
+  AMG_Restrict_idx  = NULL;
+  AMG_Rhs           = NULL;
+  AMG_Sol           = NULL;
+  AMG_Res           = NULL;
+  AMG_Aux           = NULL;
+  AMG_CoarseLU      = NULL;
+  AMG_CoarsePiv     = NULL;
+  AMG_nCoarseDense  = 0;
+  AMG_Transposed    = false;
+  AMG_Smoother      = JACOBI;
+  AMG_PreSmooth     = 1;
+  AMG_PostSmooth    = 1;
+  
   block_weight      = NULL;
   block_inverse     = NULL;
 
+  /*--- Generic block kernels until the size is known ---*/
+  
+  SetBlockKernels<0>();
+  
+  /*--- Level scheduling of the triangular substitutions ---*/
+  
+  nLevel_Lower    = 0;
+  nLevel_Upper    = 0;
+  LevelPtr_Lower  = NULL;
+  LevelRow_Lower  = NULL;
+  LevelPtr_Upper  = NULL;
+  LevelRow_Upper  = NULL;
+  
   /*--- Linelet preconditioner ---*/
   
   LineletBool     = NULL;
@@ -63,6 +110,15 @@ CSysMatrix::CSysMatrix(void) {
   FzVector        = NULL;
   max_nElem       = 0;
   
+  /*--- Halo exchange of systems whose unknowns are not grid points ---*/
+  
+  nLocal_Neighbor = 0;
+  Local_Neighbor  = NULL;
+  Local_Send_Ptr  = NULL;
+  Local_Send_Row  = NULL;
+  Local_Recv_Ptr  = NULL;
+  Local_Recv_Row  = NULL;
+  
 }
 
 CSysMatrix::~CSysMatrix(void) {
@@ -72,6 +128,8 @@ CSysMatrix::~CSysMatrix(void) {
   /*--- Memory deallocation ---*/
   
   if (matrix != NULL)             delete [] matrix;
+  if (matrix_float != NULL)       delete [] matrix_float;
+  if (matrix_block != NULL)       delete [] matrix_block;
   if (ILU_matrix != NULL)         delete [] ILU_matrix;
   if (row_ptr != NULL)            delete [] row_ptr;
   if (col_ind != NULL)            delete [] col_ind;
@@ -83,9 +141,24 @@ CSysMatrix::~CSysMatrix(void) {
   if (prod_row_vector != NULL)    delete [] prod_row_vector;
   if (aux_vector != NULL)         delete [] aux_vector;
   if (sum_vector != NULL)         delete [] sum_vector;
+  if (thread_vector != NULL)      delete [] thread_vector;
   if (invM != NULL)               delete [] invM;
+  if (ILU_invDiag != NULL)        delete [] ILU_invDiag;
+  if (ILU_matrix_float != NULL)   delete [] ILU_matrix_float;
+  if (ILU_invDiag_float != NULL)  delete [] ILU_invDiag_float;
+  if (ILU_block != NULL)          delete [] ILU_block;
+  DeleteAMG();
+  if (LevelPtr_Lower != NULL)     delete [] LevelPtr_Lower;
+  if (LevelRow_Lower != NULL)     delete [] LevelRow_Lower;
+  if (LevelPtr_Upper != NULL)     delete [] LevelPtr_Upper;
+  if (LevelRow_Upper != NULL)     delete [] LevelRow_Upper;
   if (LineletBool != NULL)        delete [] LineletBool;
   if (LineletPoint != NULL)       delete [] LineletPoint;
+  if (Local_Neighbor != NULL)     delete [] Local_Neighbor;
+  if (Local_Send_Ptr != NULL)     delete [] Local_Send_Ptr;
+  if (Local_Send_Row != NULL)     delete [] Local_Send_Row;
+  if (Local_Recv_Ptr != NULL)     delete [] Local_Recv_Ptr;
+  if (Local_Recv_Row != NULL)     delete [] Local_Recv_Row;
   
   for (iElem = 0; iElem < max_nElem; iElem++) {
     if (UBlock[iElem] != NULL)      delete [] UBlock[iElem];
@@ -210,7 +283,26 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   row_ptr      = val_row_ptr;
   col_ind      = val_col_ind;
   
-  matrix            = new su2double [nnz*nVar*nEqn];  // Reserve memory for the values of the matrix
+  /*--- The matrix and its ILU factorization are only approximations of the
+   exact Jacobian, they can be stored in single precision, halving their memory
+   and the memory traffic of the Krylov products and of the substitutions. The
+   accessors still take and return su2double, the vectors and the sums of the
+   products remain in double precision. The AD and complex types cannot go
+   through float without losing the derivatives. ---*/
+  
+#if !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE) && !defined(COMPLEX_TYPE)
+  Matrix_Float = config->GetLinear_Solver_Mixed_Precision();
+  ILU_Float    = Matrix_Float;
+#endif
+  
+  /*--- Reserve memory for the values of the matrix ---*/
+  
+  if (Matrix_Float) {
+    matrix_float    = new float [nnz*nVar*nEqn];
+    matrix_block    = new su2double [nVar*nEqn];
+  }
+  else matrix       = new su2double [nnz*nVar*nEqn];
+  
   block             = new su2double [nVar*nEqn];
   block_weight      = new su2double [nVar*nEqn];
   block_inverse     = new su2double [nVar*nEqn];
@@ -220,9 +312,17 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   aux_vector        = new su2double [nVar];
   sum_vector        = new su2double [nVar];
   
+  /*--- Partial sums of the generic (N = 0) kernels, one slice per thread ---*/
+  
+  unsigned long nThread = 1;
+#ifdef HAVE_OMP
+  nThread = omp_get_max_threads();
+#endif
+  thread_vector     = new su2double [nVar*nThread];
+  
   /*--- Memory initialization ---*/
   
-  for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++) matrix[iVar] = 0.0;
+  SetValZero();
   for (iVar = 0; iVar < nVar*nEqn; iVar++)     block[iVar] = 0.0;
   for (iVar = 0; iVar < nVar*nEqn; iVar++)     block_weight[iVar] = 0.0;
   for (iVar = 0; iVar < nVar*nEqn; iVar++)     block_inverse[iVar] = 0.0;
@@ -232,6 +332,22 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   for (iVar = 0; iVar < nVar; iVar++)          aux_vector[iVar] = 0.0;
   for (iVar = 0; iVar < nVar; iVar++)          sum_vector[iVar] = 0.0;
   
+  /*--- Select the block kernels specialized for this block size, once ---*/
+  
+  if (nVar != nEqn) SetBlockKernels<0>();
+  else {
+    switch (nVar) {
+      case 1:  SetBlockKernels<1>(); break;
+      case 2:  SetBlockKernels<2>(); break;
+      case 3:  SetBlockKernels<3>(); break;
+      case 4:  SetBlockKernels<4>(); break;
+      case 5:  SetBlockKernels<5>(); break;
+      case 6:  SetBlockKernels<6>(); break;
+      case 7:  SetBlockKernels<7>(); break;
+      default: SetBlockKernels<0>(); break;
+    }
+  }
+  
   /*--- Set specific preconditioner matrices (ILU) ---*/
   
   if ((config->GetKind_Linear_Solver_Prec() == ILU) ||
@@ -240,8 +356,7 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
     
     /*--- Reserve memory for the ILU matrix. ---*/
     
-    ILU_matrix = new su2double [nnz*nVar*nEqn];
-    for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+    InitializeILU();
   }
   
   /*--- Set specific preconditioner matrices (Jacobi and Linelet) ---*/
@@ -260,13 +375,259 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
 
 }
 
+void CSysMatrix::InitializeILU(void) {
+  
+  unsigned long iVar;
+  
+  if (ILU_Float) {
+    ILU_matrix_float = new float [nnz*nVar*nEqn];
+    for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++) ILU_matrix_float[iVar] = 0.0;
+    
+    ILU_invDiag_float = new float [nPointDomain*nVar*nEqn];
+    for (iVar = 0; iVar < nPointDomain*nVar*nEqn; iVar++) ILU_invDiag_float[iVar] = 0.0;
+  }
+  else {
+    ILU_matrix = new su2double [nnz*nVar*nEqn];
+    for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+    
+    ILU_invDiag = new su2double [nPointDomain*nVar*nEqn];
+    for (iVar = 0; iVar < nPointDomain*nVar*nEqn; iVar++) ILU_invDiag[iVar] = 0.0;
+  }
+  
+  ILU_block = new su2double [nVar*nEqn];
+  for (iVar = 0; iVar < nVar*nEqn; iVar++) ILU_block[iVar] = 0.0;
+  
+}
+
+template<unsigned short N>
+void CSysMatrix::SetBlockKernels(void) {
+  
+  if (Matrix_Float) MatVec_Kernel = &CSysMatrix::MatrixVectorProduct_Kernel<N, float>;
+  else              MatVec_Kernel = &CSysMatrix::MatrixVectorProduct_Kernel<N, su2double>;
+  Jacobi_Kernel      = &CSysMatrix::ComputeJacobiPreconditioner_Kernel<N>;
+  if (ILU_Float) ILU_Kernel = &CSysMatrix::ILU_Substitution_Kernel<N, float>;
+  else           ILU_Kernel = &CSysMatrix::ILU_Substitution_Kernel<N, su2double>;
+  BlockVector_Kernel = &CSysMatrix::GetMultBlockVector_Kernel<N>;
+  Gauss_Kernel       = &CSysMatrix::Gauss_Elimination_Kernel<N>;
+  
+}
+
+/*--- In the kernels below the block size n is a compile time constant for
+ N > 0, so that the block loops are unrolled, the blocks and the partial
+ sums are kept in registers and the compiler can vectorize them. N = 0 is
+ the generic version for any nVar. ---*/
+
+template<unsigned short N, class ScalarType>
+void CSysMatrix::MatrixVectorProduct_Kernel(const CSysVector & vec, CSysVector & prod) {
+  
+  const unsigned long n = (N > 0) ? N : nVar;
+  const su2double *x = &vec[0];
+  su2double *y = &prod[0];
+  const ScalarType *Values;
+  
+  GetMatrix_Storage(Values);
+  
+  /*--- Rows are independent, each thread owns a contiguous range of them ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (long row_i = 0; row_i < (long)nPointDomain; row_i++) {
+    unsigned long index, iVar, jVar;
+    su2double sum_local[N > 0 ? N : 1], *sum = (N > 0) ? sum_local : GetThread_Vector();
+    const ScalarType *Block;
+    const su2double *x_j;
+    for (iVar = 0; iVar < n; iVar++) sum[iVar] = 0.0;
+    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+      Block = &Values[index*n*n];
+      x_j = &x[col_ind[index]*n];
+      for (iVar = 0; iVar < n; iVar++)
+        for (jVar = 0; jVar < n; jVar++)
+          sum[iVar] += Block[iVar*n+jVar]*x_j[jVar];
+    }
+    for (iVar = 0; iVar < n; iVar++) y[row_i*n+iVar] = sum[iVar];
+  }
+  
+}
+
+template<unsigned short N>
+void CSysMatrix::ComputeJacobiPreconditioner_Kernel(const CSysVector & vec, CSysVector & prod) {
+  
+  const unsigned long n = (N > 0) ? N : nVar;
+  const su2double *x = &vec[0];
+  su2double *y = &prod[0];
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (long iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
+    unsigned long iVar, jVar;
+    const su2double *invBlock = &invM[iPoint*n*n], *x_i = &x[iPoint*n];
+    for (iVar = 0; iVar < n; iVar++) {
+      y[iPoint*n+iVar] = 0.0;
+      for (jVar = 0; jVar < n; jVar++)
+        y[iPoint*n+iVar] += invBlock[iVar*n+jVar]*x_i[jVar];
+    }
+  }
+  
+}
+
+template<unsigned short N, class ScalarType>
+void CSysMatrix::ILU_Substitution_Kernel(CSysVector & vec) {
+  
+  const unsigned long n = (N > 0) ? N : nVar;
+  su2double *x = &vec[0];
+  const ScalarType *LU, *invDiag;
+  
+  GetILU_Storage(LU, invDiag);
+  
+  /*--- The rows of a level only read rows of previous levels, so they are
+   shared among the threads; the implicit barrier of each "omp for" keeps
+   the levels in order. The result is identical to the sequential sweep. ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel
+#endif
+  {
+    unsigned long iLevel, index, iVar, jVar, iPoint, jPoint;
+    su2double sum_local[N > 0 ? N : 1], *sum = (N > 0) ? sum_local : GetThread_Vector();
+    const ScalarType *Block_ij, *invBlock;
+    const su2double *x_j;
+    
+    /*--- Forward substitution with the lower factor Aij*inv(Ajj) ---*/
+    
+    for (iLevel = 0; iLevel < nLevel_Lower; iLevel++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (long iRow = LevelPtr_Lower[iLevel]; iRow < (long)LevelPtr_Lower[iLevel+1]; iRow++) {
+        iPoint = LevelRow_Lower[iRow];
+        for (iVar = 0; iVar < n; iVar++) sum[iVar] = x[iPoint*n+iVar];
+        for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+          jPoint = col_ind[index];
+          if (jPoint < iPoint) {
+            Block_ij = &LU[index*n*n];
+            x_j = &x[jPoint*n];
+            for (iVar = 0; iVar < n; iVar++)
+              for (jVar = 0; jVar < n; jVar++)
+                sum[iVar] -= Block_ij[iVar*n+jVar]*x_j[jVar];
+          }
+        }
+        for (iVar = 0; iVar < n; iVar++) x[iPoint*n+iVar] = sum[iVar];
+      }
+    }
+    
+    /*--- Backward substitution with the upper factor and the stored inverse diagonal ---*/
+    
+    for (iLevel = 0; iLevel < nLevel_Upper; iLevel++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (long iRow = LevelPtr_Upper[iLevel]; iRow < (long)LevelPtr_Upper[iLevel+1]; iRow++) {
+        iPoint = LevelRow_Upper[iRow];
+        for (iVar = 0; iVar < n; iVar++) sum[iVar] = x[iPoint*n+iVar];
+        for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+          jPoint = col_ind[index];
+          if ((jPoint > iPoint) && (jPoint < nPointDomain)) {
+            Block_ij = &LU[index*n*n];
+            x_j = &x[jPoint*n];
+            for (iVar = 0; iVar < n; iVar++)
+              for (jVar = 0; jVar < n; jVar++)
+                sum[iVar] -= Block_ij[iVar*n+jVar]*x_j[jVar];
+          }
+        }
+        invBlock = &invDiag[iPoint*n*n];
+        for (iVar = 0; iVar < n; iVar++) {
+          x[iPoint*n+iVar] = 0.0;
+          for (jVar = 0; jVar < n; jVar++)
+            x[iPoint*n+iVar] += invBlock[iVar*n+jVar]*sum[jVar];
+        }
+      }
+    }
+  }
+  
+}
+
+template<unsigned short N>
+void CSysMatrix::GetMultBlockVector_Kernel(su2double *c, su2double *a, su2double *b) {
+  
+  const unsigned long n = (N > 0) ? N : nVar;
+  unsigned long iVar, jVar;
+  
+  for (iVar = 0; iVar < n; iVar++) {
+    c[iVar] = 0.0;
+    for (jVar = 0; jVar < n; jVar++)
+      c[iVar] += a[iVar*n+jVar] * b[jVar];
+  }
+  
+}
+
+template<unsigned short N>
+void CSysMatrix::Gauss_Elimination_Kernel(su2double *Block, su2double *rhs, bool transposed) {
+  
+  const short n = (N > 0) ? N : nVar;
+  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
+  su2double weight, aux;
+  
+  /*--- Copy block matrix, note that the original matrix
+   is modified by the algorithm. The fixed size copy lives on the stack. ---*/
+  
+  su2double block_local[N > 0 ? N*N : 1], *A = (N > 0) ? block_local : block;
+  
+  if (!transposed) {
+    for (iVar = 0; iVar < n; iVar++)
+      for (jVar = 0; jVar < n; jVar++)
+        A[iVar*n+jVar] = Block[iVar*n+jVar];
+  } else {
+    for (iVar = 0; iVar < n; iVar++)
+      for (jVar = 0; jVar < n; jVar++)
+        A[iVar*n+jVar] = Block[jVar*n+iVar];
+  }
+  
+  /*--- Gauss elimination ---*/
+  
+  if (n == 1) {
+    rhs[0] /= A[0];
+  }
+  else {
+    
+    /*--- Transform system in Upper Matrix ---*/
+    
+    for (iVar = 1; iVar < n; iVar++) {
+      for (jVar = 0; jVar < iVar; jVar++) {
+        weight = A[iVar*n+jVar] / A[jVar*n+jVar];
+        for (kVar = jVar; kVar < n; kVar++)
+          A[iVar*n+kVar] -= weight*A[jVar*n+kVar];
+        rhs[iVar] -= weight*rhs[jVar];
+      }
+    }
+    
+    /*--- Backwards substitution ---*/
+    
+    rhs[n-1] = rhs[n-1] / A[n*n-1];
+    for (iVar = n-2; iVar >= 0; iVar--) {
+      aux = 0.0;
+      for (jVar = iVar+1; jVar < n; jVar++)
+        aux += A[iVar*n+jVar]*rhs[jVar];
+      rhs[iVar] = (rhs[iVar]-aux) / A[iVar*n+iVar];
+      if (iVar == 0) break;
+    }
+  }
+  
+}
+
 su2double *CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j) {
   
-  unsigned long step = 0, index;
+  unsigned long step = 0, index, iVar;
   
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
-    if (col_ind[index] == block_j) { return &(matrix[(row_ptr[block_i]+step-1)*nVar*nEqn]); }
+    if (col_ind[index] == block_j) {
+      if (!Matrix_Float) return &(matrix[(row_ptr[block_i]+step-1)*nVar*nEqn]);
+      for (iVar = 0; iVar < nVar*nEqn; iVar++)
+        matrix_block[iVar] = matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar];
+      return matrix_block;
+    }
   }
   return NULL;
   
@@ -278,7 +639,10 @@ su2double CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j, uns
 
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
-    if (col_ind[index] == block_j) { return matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar]; }
+    if (col_ind[index] == block_j) {
+      if (Matrix_Float) return matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar];
+      return matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar];
+    }
   }
   return 0;
   
@@ -293,7 +657,8 @@ void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2doubl
     if (col_ind[index] == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar][jVar]); //val_block[iVar][jVar];//
+          if (Matrix_Float) matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar][jVar]);
+          else matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar][jVar]);
       break;
     }
   }
@@ -309,7 +674,8 @@ void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2doubl
     if (col_ind[index] == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar*nVar+jVar]);//val_block[iVar*nVar+jVar];//
+          if (Matrix_Float) matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar*nVar+jVar]);
+          else matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar*nVar+jVar]);
       break;
     }
   }
@@ -325,7 +691,8 @@ void CSysMatrix::AddBlock(unsigned long block_i, unsigned long block_j, su2doubl
     if (col_ind[index] == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] += SU2_TYPE::GetValue(val_block[iVar][jVar]); //val_block[iVar][jVar];//
+          if (Matrix_Float) matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] += SU2_TYPE::GetValue(val_block[iVar][jVar]);
+          else matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] += SU2_TYPE::GetValue(val_block[iVar][jVar]);
       break;
     }
   }
@@ -339,7 +706,8 @@ void CSysMatrix::SetEntry(unsigned long block_i, unsigned long block_j, unsigned
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
     if (col_ind[index] == block_j) {
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_entry); //val_entry;//
+      if (Matrix_Float) matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_entry);
+      else matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_entry);
       break;
     }
   }
@@ -353,7 +721,8 @@ su2double CSysMatrix::GetEntry(unsigned long block_i, unsigned long block_j, uns
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
     if (col_ind[index] == block_j) {
-         return matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar];
+      if (Matrix_Float) return matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar];
+      return matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar];
     }
   }
 
@@ -368,22 +737,28 @@ void CSysMatrix::SubtractBlock(unsigned long block_i, unsigned long block_j, su2
     if (col_ind[index] == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar][jVar]); //val_block[iVar][jVar];//
+          if (Matrix_Float) matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar][jVar]);
+          else matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar][jVar]);
       break;
     }
   }
   
 }
 
-su2double *CSysMatrix::GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j) {
+void CSysMatrix::GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block) {
   
-  unsigned long step = 0, index;
+  unsigned long step = 0, index, iVar;
   
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
-    if (col_ind[index] == block_j) { return &(ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn]); }
+    if (col_ind[index] == block_j) {
+      for (iVar = 0; iVar < nVar*nEqn; iVar++)
+        if (ILU_Float) val_block[iVar] = ILU_matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar];
+        else val_block[iVar] = ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar];
+      return;
+    }
   }
-  return NULL;
+  for (iVar = 0; iVar < nVar*nEqn; iVar++) val_block[iVar] = 0.0;
   
 }
 
@@ -396,7 +771,8 @@ void CSysMatrix::SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j
     if (col_ind[index] == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];
+          if (ILU_Float) ILU_matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar*nVar+jVar]);
+          else ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];
       break;
     }
   }
@@ -412,7 +788,8 @@ void CSysMatrix::SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned lo
     if (col_ind[index] == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[jVar*nVar+iVar];
+          if (ILU_Float) ILU_matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[jVar*nVar+iVar]);
+          else ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[jVar*nVar+iVar];
       break;
     }
   }
@@ -428,7 +805,8 @@ void CSysMatrix::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long bl
     if (col_ind[index] == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar*nVar+jVar];
+          if (ILU_Float) ILU_matrix_float[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar*nVar+jVar]);
+          else ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar*nVar+jVar];
       break;
     }
   }
@@ -437,14 +815,7 @@ void CSysMatrix::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long bl
 
 void CSysMatrix::MatrixVectorProduct(su2double *matrix, su2double *vector, su2double *product) {
   
-  unsigned short iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    product[iVar] = 0.0;
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar] += matrix[iVar*nVar+jVar] * vector[jVar];
-    }
-  }
+  (this->*BlockVector_Kernel)(product, matrix, vector);
   
 }
 
@@ -471,7 +842,8 @@ void CSysMatrix::AddVal2Diag(unsigned long block_i, su2double val_matrix) {
     step++;
     if (col_ind[index] == block_i) {	// Only elements on the diagonal
       for (iVar = 0; iVar < nVar; iVar++)
-        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] += SU2_TYPE::GetValue(val_matrix); //val_matrix;//
+        if (Matrix_Float) matrix_float[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] += SU2_TYPE::GetValue(val_matrix);
+        else matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] += SU2_TYPE::GetValue(val_matrix);
       break;
     }
   }
@@ -488,10 +860,12 @@ void CSysMatrix::SetVal2Diag(unsigned long block_i, su2double val_matrix) {
       
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nVar; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+jVar] = 0.0;
+          if (Matrix_Float) matrix_float[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+jVar] = 0.0;
+          else matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+jVar] = 0.0;
       
       for (iVar = 0; iVar < nVar; iVar++)
-        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] = SU2_TYPE::GetValue(val_matrix); //val_matrix;//
+        if (Matrix_Float) matrix_float[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] = SU2_TYPE::GetValue(val_matrix);
+        else matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] = SU2_TYPE::GetValue(val_matrix);
       
       break;
     }
@@ -506,145 +880,34 @@ void CSysMatrix::DeleteValsRowi(unsigned long i) {
   unsigned long index, iVar;
   
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    for (iVar = 0; iVar < nVar; iVar++)
-      matrix[index*nVar*nVar+row*nVar+iVar] = 0.0; // Delete row values in the block
-    if (col_ind[index] == block_i)
-      matrix[index*nVar*nVar+row*nVar+row] = 1.0; // Set 1 to the diagonal element
+    for (iVar = 0; iVar < nVar; iVar++) {
+      if (Matrix_Float) matrix_float[index*nVar*nVar+row*nVar+iVar] = 0.0; // Delete row values in the block
+      else matrix[index*nVar*nVar+row*nVar+iVar] = 0.0;
+    }
+    if (col_ind[index] == block_i) {
+      if (Matrix_Float) matrix_float[index*nVar*nVar+row*nVar+row] = 1.0; // Set 1 to the diagonal element
+      else matrix[index*nVar*nVar+row*nVar+row] = 1.0;
+    }
   }
   
 }
 
 void CSysMatrix::Gauss_Elimination(unsigned long block_i, su2double* rhs, bool transposed) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
-  su2double *Block = GetBlock(block_i, block_i);
-  
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
-  
-  if (!transposed){
-    for (iVar = 0; iVar < (short)nVar; iVar++)
-      for (jVar = 0; jVar < (short)nVar; jVar++)
-        block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
-  } else {
-    for (iVar = 0; iVar < (short)nVar; iVar++)
-      for (jVar = 0; jVar < (short)nVar; jVar++)
-        block[iVar*nVar+jVar] = Block[jVar*nVar+iVar];
-  }
-  /*--- Gauss elimination ---*/
-  
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  (this->*Gauss_Kernel)(GetBlock(block_i, block_i), rhs, transposed);
   
 }
 
 void CSysMatrix::Gauss_Elimination_ILUMatrix(unsigned long block_i, su2double* rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
-  su2double *Block = GetBlock_ILUMatrix(block_i, block_i);
-  
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
-  
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
-      block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
-  
-  /*--- Gauss elimination ---*/
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  GetBlock_ILUMatrix(block_i, block_i, ILU_block);
+  (this->*Gauss_Kernel)(ILU_block, rhs, false);
   
 }
 
 void CSysMatrix::Gauss_Elimination(su2double* Block, su2double* rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
-  
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
-      block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
-  
-  
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    /*--- Transform system in Upper Matrix ---*/
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  (this->*Gauss_Kernel)(Block, rhs, false);
   
 }
 
@@ -802,6 +1065,81 @@ void CSysMatrix::SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConf
   
 }
 
+void CSysMatrix::SetSendReceive_Local(vector<int> & val_neighbor, vector<vector<unsigned long> > & val_send,
+                                      vector<vector<unsigned long> > & val_recv) {
+  
+  int iNeighbor;
+  unsigned long iRow;
+  
+  if (Local_Neighbor != NULL) delete [] Local_Neighbor;
+  if (Local_Send_Ptr != NULL) delete [] Local_Send_Ptr;
+  if (Local_Send_Row != NULL) delete [] Local_Send_Row;
+  if (Local_Recv_Ptr != NULL) delete [] Local_Recv_Ptr;
+  if (Local_Recv_Row != NULL) delete [] Local_Recv_Row;
+  
+  /*--- Flatten the rows of each neighbor (CSR format) ---*/
+  
+  nLocal_Neighbor = val_neighbor.size();
+  Local_Neighbor  = new int [nLocal_Neighbor];
+  Local_Send_Ptr  = new unsigned long [nLocal_Neighbor+1];
+  Local_Recv_Ptr  = new unsigned long [nLocal_Neighbor+1];
+  
+  Local_Send_Ptr[0] = 0; Local_Recv_Ptr[0] = 0;
+  for (iNeighbor = 0; iNeighbor < nLocal_Neighbor; iNeighbor++) {
+    Local_Neighbor[iNeighbor] = val_neighbor[iNeighbor];
+    Local_Send_Ptr[iNeighbor+1] = Local_Send_Ptr[iNeighbor] + val_send[iNeighbor].size();
+    Local_Recv_Ptr[iNeighbor+1] = Local_Recv_Ptr[iNeighbor] + val_recv[iNeighbor].size();
+  }
+  
+  Local_Send_Row = new unsigned long [Local_Send_Ptr[nLocal_Neighbor]];
+  Local_Recv_Row = new unsigned long [Local_Recv_Ptr[nLocal_Neighbor]];
+  for (iNeighbor = 0; iNeighbor < nLocal_Neighbor; iNeighbor++) {
+    for (iRow = 0; iRow < val_send[iNeighbor].size(); iRow++)
+      Local_Send_Row[Local_Send_Ptr[iNeighbor]+iRow] = val_send[iNeighbor][iRow];
+    for (iRow = 0; iRow < val_recv[iNeighbor].size(); iRow++)
+      Local_Recv_Row[Local_Recv_Ptr[iNeighbor]+iRow] = val_recv[iNeighbor][iRow];
+  }
+  
+}
+
+void CSysMatrix::SendReceive_Local(CSysVector & x) {
+  
+#ifdef HAVE_MPI
+  
+  if (nLocal_Neighbor == 0) return;
+  
+  int iNeighbor, nRequest = 0;
+  unsigned long iRow, iVar, nSend = Local_Send_Ptr[nLocal_Neighbor], nRecv = Local_Recv_Ptr[nLocal_Neighbor];
+  su2double *Buffer_Send = new su2double [nSend*nVar];
+  su2double *Buffer_Receive = new su2double [nRecv*nVar];
+  MPI_Request *Request = new MPI_Request [2*nLocal_Neighbor];
+  MPI_Status *Status = new MPI_Status [2*nLocal_Neighbor];
+  
+  for (iRow = 0; iRow < nSend; iRow++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer_Send[iRow*nVar+iVar] = x[Local_Send_Row[iRow]*nVar+iVar];
+  
+  for (iNeighbor = 0; iNeighbor < nLocal_Neighbor; iNeighbor++) {
+    if (Local_Recv_Ptr[iNeighbor+1] > Local_Recv_Ptr[iNeighbor])
+      SU2_MPI::Irecv(&Buffer_Receive[Local_Recv_Ptr[iNeighbor]*nVar], (Local_Recv_Ptr[iNeighbor+1]-Local_Recv_Ptr[iNeighbor])*nVar,
+                     MPI_DOUBLE, Local_Neighbor[iNeighbor], 0, MPI_COMM_WORLD, &Request[nRequest++]);
+    if (Local_Send_Ptr[iNeighbor+1] > Local_Send_Ptr[iNeighbor])
+      SU2_MPI::Isend(&Buffer_Send[Local_Send_Ptr[iNeighbor]*nVar], (Local_Send_Ptr[iNeighbor+1]-Local_Send_Ptr[iNeighbor])*nVar,
+                     MPI_DOUBLE, Local_Neighbor[iNeighbor], 0, MPI_COMM_WORLD, &Request[nRequest++]);
+  }
+  SU2_MPI::Waitall(nRequest, Request, Status);
+  
+  for (iRow = 0; iRow < nRecv; iRow++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      x[Local_Recv_Row[iRow]*nVar+iVar] = Buffer_Receive[iRow*nVar+iVar];
+  
+  delete [] Buffer_Send; delete [] Buffer_Receive;
+  delete [] Request; delete [] Status;
+  
+#endif
+  
+}
+
 void CSysMatrix::SendReceive_SolutionTransposed(CSysVector & x, CGeometry *geometry, CConfig *config) {
 
   unsigned short iVar, iMarker, MarkerS, MarkerR;
@@ -907,20 +1245,12 @@ void CSysMatrix::RowProduct(const CSysVector & vec, unsigned long row_i) {
 
 void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod) {
   
-  unsigned long iPoint, iVar;
-  
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    RowProduct(vec, iPoint);
-    for (iVar = 0; iVar < nVar; iVar++)
-      prod[iPoint*nVar+iVar] = prod_row_vector[iVar];
-  }
+  (this->*MatVec_Kernel)(vec, prod);
   
 }
 
 void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar, row_i;
-  
   /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
     cerr << "CSysMatrix::MatrixVectorProduct(const CSysVector&, CSysVector): "
@@ -933,19 +1263,12 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod,
     throw(-1);
   }
   
-  prod = su2double(0.0); // set all entries of prod to zero
-  for (row_i = 0; row_i < nPointDomain; row_i++) {
-    prod_begin = row_i*nVar; // offset to beginning of block row_i
-    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-      vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
-      mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[row_i][col_ind[indx]]
-      for (iVar = 0; iVar < nVar; iVar++) {
-        for (jVar = 0; jVar < nVar; jVar++) {
-          prod[(unsigned long)(prod_begin+iVar)] += matrix[(unsigned long)(mat_begin+iVar*nVar+jVar)]*vec[(unsigned long)(vec_begin+jVar)];
-        }
-      }
-    }
-  }
+  (this->*MatVec_Kernel)(vec, prod);
+  
+  /*--- The halo entries are received below ---*/
+  
+  for (unsigned long i = nPointDomain*nVar; i < nPoint*nVar; i++)
+    prod[i] = 0.0;
   
   /*--- MPI Parallelization ---*/
   SendReceive_Solution(prod, geometry, config);
@@ -954,8 +1277,6 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod,
 
 void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
 
-  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar , row_i;
-
   /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
     cerr << "CSysMatrix::MatrixVectorProductTransposed(const CSysVector&, CSysVector): "
@@ -968,6 +1289,17 @@ void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVecto
     throw(-1);
   }
 
+  MatrixVectorProductTransposed(vec, prod);
+
+  /*--- MPI Parallelization ---*/
+  SendReceive_SolutionTransposed(prod, geometry, config);
+
+}
+
+void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVector & prod) {
+
+  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar , row_i;
+
   prod = su2double(0.0); // set all entries of prod to zero
   for (row_i = 0; row_i < nPointDomain; row_i++) {
     vec_begin = row_i*nVar; // offset to beginning of block col_ind[index]
@@ -976,15 +1308,13 @@ void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVecto
       mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[row_i][col_ind[indx]]
       for (iVar = 0; iVar < nVar; iVar++) {
         for (jVar = 0; jVar < nVar; jVar++) {
-            prod[(unsigned long)(prod_begin+jVar)] += matrix[(unsigned long)(mat_begin+iVar*nVar+jVar)]*vec[(unsigned long)(vec_begin+iVar)];
+          if (Matrix_Float) prod[(unsigned long)(prod_begin+jVar)] += matrix_float[(unsigned long)(mat_begin+iVar*nVar+jVar)]*vec[(unsigned long)(vec_begin+iVar)];
+          else prod[(unsigned long)(prod_begin+jVar)] += matrix[(unsigned long)(mat_begin+iVar*nVar+jVar)]*vec[(unsigned long)(vec_begin+iVar)];
         }
       }
     }
   }
 
-  /*--- MPI Parallelization ---*/
-  SendReceive_SolutionTransposed(prod, geometry, config);
-
 }
 
 void CSysMatrix::GetMultBlockBlock(su2double *c, su2double *a, su2double *b) {
@@ -1002,13 +1332,7 @@ void CSysMatrix::GetMultBlockBlock(su2double *c, su2double *a, su2double *b) {
 
 void CSysMatrix::GetMultBlockVector(su2double *c, su2double *a, su2double *b) {
   
-  unsigned long iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    c[iVar] =  0.0;
-    for (jVar = 0; jVar < nVar; jVar++)
-      c[iVar] += a[iVar*nVar+jVar] * b[jVar];
-  }
+  (this->*BlockVector_Kernel)(c, a, b);
   
 }
 
@@ -1072,6 +1396,10 @@ void CSysMatrix::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2double
   
   unsigned long iVar, jVar;
   
+  /*--- The diagonal block is copied once for all the columns ---*/
+  
+  GetBlock_ILUMatrix(block_i, block_i, ILU_block);
+  
   for (iVar = 0; iVar < nVar; iVar++) {
     for (jVar = 0; jVar < nVar; jVar++)
       aux_vector[jVar] = 0.0;
@@ -1079,7 +1407,7 @@ void CSysMatrix::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2double
     
     /*--- Compute the i-th column of the inverse matrix ---*/
     
-    Gauss_Elimination_ILUMatrix(block_i, aux_vector);
+    (this->*Gauss_Kernel)(ILU_block, aux_vector, false);
     for (jVar = 0; jVar < nVar; jVar++)
       invBlock[jVar*nVar+iVar] = aux_vector[jVar];
   }
@@ -1090,6 +1418,10 @@ void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
 
   unsigned long iPoint, iVar, jVar;
 
+  /*--- The inverse is only reserved in SetIndexes when the config asks for
+   Jacobi, other systems (e.g. filters) allocate it on first use. ---*/
+  if (invM == NULL) invM = new su2double [nPoint*nVar*nVar];
+
   /*--- Compute Jacobi Preconditioner ---*/
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
 
@@ -1107,16 +1439,7 @@ void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
 
 void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long iPoint, iVar, jVar;
-  
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      prod[(unsigned long)(iPoint*nVar+iVar)] = 0.0;
-      for (jVar = 0; jVar < nVar; jVar++)
-        prod[(unsigned long)(iPoint*nVar+iVar)] +=
-        invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(unsigned long)(iPoint*nVar+jVar)];
-    }
-  }
+  (this->*Jacobi_Kernel)(vec, prod);
   
   /*--- MPI Parallelization ---*/
   
@@ -1124,6 +1447,12 @@ void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector
   
 }
 
+void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod) {
+  
+  (this->*Jacobi_Kernel)(vec, prod);
+  
+}
+
 unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
   
   unsigned long iPoint, iVar, jVar;
@@ -1226,9 +1555,14 @@ unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x,
 void CSysMatrix::BuildILUPreconditioner(bool transposed) {
   
   unsigned long index, index_;
-  su2double *Block_ij, *Block_jk;
+  su2double *Block_ij;
   long iPoint, jPoint, kPoint;
   
+  /*--- The ILU is only reserved in SetIndexes when the config asks for it,
+   other users (e.g. the AMG smoother) allocate it on first use. ---*/
+  
+  if ((ILU_matrix == NULL) && (ILU_matrix_float == NULL)) InitializeILU();
+  
   /*--- Copy block matrix, note that the original matrix
    is modified by the algorithm, so that we have the factorization stored
    in the ILUMatrix at the end of this preprocessing. ---*/
@@ -1246,7 +1580,10 @@ void CSysMatrix::BuildILUPreconditioner(bool transposed) {
     }
   }
   
-  /*--- Transform system in Upper Matrix ---*/
+  /*--- Transform system in Upper Matrix, the blocks of the factors are copied
+   (converted from single precision if needed) into separate buffers ---*/
+  
+  su2double *ILU_ij = new su2double [nVar*nEqn], *ILU_jk = new su2double [nVar*nEqn];
   
   for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
     
@@ -1267,9 +1604,9 @@ void CSysMatrix::BuildILUPreconditioner(bool transposed) {
         /*--- If we're in the lower triangle, get the pointer to this block,
          invert it, and then right multiply against the original block ---*/
         
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
         InverseDiagonalBlock_ILUMatrix(jPoint, block_inverse);
-        MatrixMatrixProduct(Block_ij, block_inverse, block_weight);
+        GetBlock_ILUMatrix(iPoint, jPoint, ILU_ij);
+        MatrixMatrixProduct(ILU_ij, block_inverse, block_weight);
         
         /*--- block_weight holds Aij*inv(Ajj). Jump to the row for jPoint ---*/
         
@@ -1284,13 +1621,13 @@ void CSysMatrix::BuildILUPreconditioner(bool transposed) {
            Here, Aik' = Aik - Aij*inv(Ajj)*Ajk. ---*/
           
           if (kPoint < (long)nPointDomain) {
-            Block_jk = GetBlock_ILUMatrix(jPoint, kPoint);
+            GetBlock_ILUMatrix(jPoint, kPoint, ILU_jk);
             if (kPoint >= jPoint) {
               
               // WARNING: here we have a left multiply by Block_jk, should it
               // be a right multiply to give Aik' = Aik - Aij*inv(Ajj)*Ajk?
               
-              MatrixMatrixProduct(Block_jk, block_weight, block);
+              MatrixMatrixProduct(ILU_jk, block_weight, block);
               SubtractBlock_ILUMatrix(iPoint, kPoint, block);
               
             }
@@ -1306,66 +1643,111 @@ void CSysMatrix::BuildILUPreconditioner(bool transposed) {
     }
   }
   
-}
-
-void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
-  
-  unsigned long index;
-  su2double *Block_ij;
-  long iPoint, jPoint;
-  unsigned short iVar;
+  delete [] ILU_ij; delete [] ILU_jk;
   
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
+  /*--- Store the inverse of the diagonal blocks for the backward substitution,
+   so that it is not recomputed in every application of the preconditioner. ---*/
   
   for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
+    if (ILU_Float) {
+      InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
+      for (index = 0; index < nVar*nVar; index++)
+        ILU_invDiag_float[iPoint*nVar*nVar+index] = SU2_TYPE::GetValue(block_inverse[index]);
     }
+    else InverseDiagonalBlock_ILUMatrix(iPoint, &ILU_invDiag[iPoint*nVar*nVar]);
   }
   
-  /*--- Transform system in Upper Matrix ---*/
+  /*--- The levels only depend on the sparse pattern ---*/
   
-  for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
+  if (LevelRow_Lower == NULL) BuildLevelSets();
+  
+}
+
+void CSysMatrix::BuildLevelSets(void) {
+  
+  unsigned long iPoint, jPoint, index, iLevel, *Level;
+  
+  Level = new unsigned long [nPointDomain];
+  
+  /*--- Forward substitution: a row can be processed once all its lower
+   neighbors (columns < row) are done. ---*/
+  
+  nLevel_Lower = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Level[iPoint] = 0;
     for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
       jPoint = col_ind[index];
-      if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
-        for (iVar = 0; iVar < nVar; iVar++)
-          prod[iPoint*nVar+iVar] -= aux_vector[iVar];
-        
-      }
+      if ((jPoint < iPoint) && (Level[jPoint]+1 > Level[iPoint])) Level[iPoint] = Level[jPoint]+1;
     }
+    nLevel_Lower = max(nLevel_Lower, Level[iPoint]+1);
   }
   
-  /*--- Backwards substitution ---*/
+  LevelPtr_Lower = new unsigned long [nLevel_Lower+1];
+  LevelRow_Lower = new unsigned long [nPointDomain];
   
-  InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-  MatrixVectorProduct(block_inverse, &prod[(nPointDomain-1)*nVar], aux_vector);
+  for (iLevel = 0; iLevel <= nLevel_Lower; iLevel++) LevelPtr_Lower[iLevel] = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) LevelPtr_Lower[Level[iPoint]+1]++;
+  for (iLevel = 0; iLevel < nLevel_Lower; iLevel++) LevelPtr_Lower[iLevel+1] += LevelPtr_Lower[iLevel];
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    LevelRow_Lower[LevelPtr_Lower[Level[iPoint]]] = iPoint;
+    LevelPtr_Lower[Level[iPoint]]++;
+  }
+  for (iLevel = nLevel_Lower; iLevel > 0; iLevel--) LevelPtr_Lower[iLevel] = LevelPtr_Lower[iLevel-1];
+  LevelPtr_Lower[0] = 0;
   
-  for (iVar = 0; iVar < nVar; iVar++)
-    prod[ (nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
+  /*--- Backward substitution: a row depends on its upper neighbors in the domain. ---*/
   
-  for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
-    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
+  nLevel_Upper = 0;
+  for (iPoint = nPointDomain; iPoint-- > 0; ) {
+    Level[iPoint] = 0;
     for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
       jPoint = col_ind[index];
-      if (jPoint < (long)nPointDomain) {
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
-          MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
-        }
-      }
+      if ((jPoint > iPoint) && (jPoint < nPointDomain) && (Level[jPoint]+1 > Level[iPoint])) Level[iPoint] = Level[jPoint]+1;
+    }
+    nLevel_Upper = max(nLevel_Upper, Level[iPoint]+1);
+  }
+  
+  LevelPtr_Upper = new unsigned long [nLevel_Upper+1];
+  LevelRow_Upper = new unsigned long [nPointDomain];
+  
+  for (iLevel = 0; iLevel <= nLevel_Upper; iLevel++) LevelPtr_Upper[iLevel] = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) LevelPtr_Upper[Level[iPoint]+1]++;
+  for (iLevel = 0; iLevel < nLevel_Upper; iLevel++) LevelPtr_Upper[iLevel+1] += LevelPtr_Upper[iLevel];
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    LevelRow_Upper[LevelPtr_Upper[Level[iPoint]]] = iPoint;
+    LevelPtr_Upper[Level[iPoint]]++;
+  }
+  for (iLevel = nLevel_Upper; iLevel > 0; iLevel--) LevelPtr_Upper[iLevel] = LevelPtr_Upper[iLevel-1];
+  LevelPtr_Upper[0] = 0;
+  
+  delete [] Level;
+  
+}
+
+void CSysMatrix::ILU_Substitution(CSysVector & vec) {
+  
+  (this->*ILU_Kernel)(vec);
+  
+}
+
+void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  /*--- Copy block matrix, note that the original matrix
+   is modified by the algorithm---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (long iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
     }
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = (prod[iPoint*nVar+iVar]-sum_vector[iVar]);
-    InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-    MatrixVectorProduct(block_inverse, &prod[iPoint*nVar], aux_vector);
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = aux_vector[iVar];
-    if (iPoint == 0) break;
   }
   
+  /*--- Forward and backward substitution ---*/
+  
+  ILU_Substitution(prod);
+  
   /*--- MPI Parallelization ---*/
   
   SendReceive_Solution(prod, geometry, config);
@@ -1374,10 +1756,7 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
 
 unsigned long CSysMatrix::ILU0_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
   
-  unsigned long index;
-  su2double *Block_ij, omega = 1.0;
-  long iPoint, jPoint;
-  unsigned short iVar;
+  su2double omega = 1.0;
   int rank = MASTER_NODE;
   
 #ifdef HAVE_MPI
@@ -1433,64 +1812,11 @@ unsigned long CSysMatrix::ILU0_Smoother(const CSysVector & b, CSysVector & x, CM
   
   for (i = 0; i < (int)m; i++) {
     
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU0 preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+    /*--- Forward and backward solve the system using the lower and upper
+     factors that were computed and stored during the ILU0 preprocessing.
+     Note that we are overwriting the residual vector as we go. ---*/
     
-    for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
-      
-      /*--- For each row (unknown), loop over all entries in A on this row
-       row_ptr[iPoint+1] will have the index for the first entry on the next
-       row. ---*/
-      
-      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-        
-        /*--- jPoint here is the column for each entry on this row ---*/
-        
-        jPoint = col_ind[index];
-        
-        /*--- Check that this column is in the lower triangular portion ---*/
-        
-        if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-          
-          /*--- Lastly, get Aij*inv(Ajj) from the lower triangular part, which
-           was calculated in the preprocessing, and apply to r. ---*/
-          
-          Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-          MatrixVectorProduct(Block_ij, &r[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++)
-            r[iPoint*nVar+iVar] -= aux_vector[iVar];
-          
-        }
-      }
-    }
-    
-    /*--- Backwards substitution (starts at the last row) ---*/
-    
-    InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-    MatrixVectorProduct(block_inverse, &r[(nPointDomain-1)*nVar], aux_vector);
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      r[(nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
-    
-    for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
-      for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
-      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-        jPoint = col_ind[index];
-        if (jPoint < (long)nPointDomain) {
-          Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-          if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
-            MatrixVectorProduct(Block_ij, &r[jPoint*nVar], aux_vector);
-            for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
-          }
-        }
-      }
-      for (iVar = 0; iVar < nVar; iVar++) r[iPoint*nVar+iVar] = (r[iPoint*nVar+iVar]-sum_vector[iVar]);
-      InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-      MatrixVectorProduct(block_inverse, &r[iPoint*nVar], aux_vector);
-      for (iVar = 0; iVar < nVar; iVar++) r[iPoint*nVar+iVar] = aux_vector[iVar];
-      if (iPoint == 0) break;
-    }
+    ILU_Substitution(r);
     
     /*--- Update solution (x^k+1 = x^k + w*M^-1*r^k) using the residual vector,
      which holds the update after applying the ILU0 smoother, i.e., M^-1*r^k.
@@ -2002,6 +2328,625 @@ void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector
   
 }
 
+passivedouble CSysMatrix::GetBlockNorm(const su2double *val_block) {
+  
+  unsigned long iVar;
+  passivedouble norm = 0.0;
+  
+  for (iVar = 0; iVar < nVar*nVar; iVar++)
+    norm += SU2_TYPE::GetValue(val_block[iVar])*SU2_TYPE::GetValue(val_block[iVar]);
+  
+  return sqrt(norm);
+  
+}
+
+void CSysMatrix::BuildAMGPreconditioner(CConfig *config, bool transposed) {
+  
+  unsigned short iLevel, nLevel_Max = max(config->GetAMG_Levels(), (unsigned short)1);
+  unsigned long nBlk;
+  
+  if (nVar != nEqn) {
+    cerr << "CSysMatrix::BuildAMGPreconditioner: the AMG needs square blocks (nVar = nEqn)." << endl;
+    throw(-1);
+  }
+  
+  /*--- The hierarchy follows the values of the matrix, it is built again every time ---*/
+  
+  DeleteAMG();
+  
+  AMG_Transposed = transposed;
+  AMG_Smoother   = config->GetKind_AMG_Smoother();
+  AMG_PreSmooth  = config->GetAMG_PreSmooth();
+  AMG_PostSmooth = config->GetAMG_PostSmooth();
+  if ((AMG_Smoother != JACOBI) && (AMG_Smoother != ILU)) AMG_Smoother = JACOBI;
+  
+  AMG_Matrix       = new CSysMatrix* [nLevel_Max];
+  AMG_Prolong_ptr  = new unsigned long* [nLevel_Max];
+  AMG_Prolong_col  = new unsigned long* [nLevel_Max];
+  AMG_Prolong_val  = new su2double* [nLevel_Max];
+  AMG_Restrict_ptr = new unsigned long* [nLevel_Max];
+  AMG_Restrict_row = new unsigned long* [nLevel_Max];
+  AMG_Restrict_idx = new unsigned long* [nLevel_Max];
+  
+  for (iLevel = 0; iLevel < nLevel_Max; iLevel++) {
+    AMG_Matrix[iLevel]       = NULL;
+    AMG_Prolong_ptr[iLevel]  = NULL; AMG_Prolong_col[iLevel]  = NULL; AMG_Prolong_val[iLevel]  = NULL;
+    AMG_Restrict_ptr[iLevel] = NULL; AMG_Restrict_row[iLevel] = NULL; AMG_Restrict_idx[iLevel] = NULL;
+  }
+  
+  /*--- Coarsen until the level is small, stops coarsening, or the maximum number of levels ---*/
+  
+  AMG_Matrix[0] = this;
+  AMG_nLevel = 1;
+  while ((AMG_nLevel < nLevel_Max) && AMG_Coarsen(AMG_nLevel-1, config)) AMG_nLevel++;
+  
+  /*--- Vectors of the cycle, the fine level keeps the halo entries (set to zero) of the
+   matrix-vector product. ---*/
+  
+  AMG_Rhs = new CSysVector* [AMG_nLevel];
+  AMG_Sol = new CSysVector* [AMG_nLevel];
+  AMG_Res = new CSysVector* [AMG_nLevel];
+  AMG_Aux = new CSysVector* [AMG_nLevel];
+  
+  for (iLevel = 0; iLevel < AMG_nLevel; iLevel++) {
+    nBlk = AMG_Matrix[iLevel]->nPoint;
+    AMG_Rhs[iLevel] = new CSysVector(nBlk, AMG_Matrix[iLevel]->nPointDomain, nVar, 0.0);
+    AMG_Sol[iLevel] = new CSysVector(nBlk, AMG_Matrix[iLevel]->nPointDomain, nVar, 0.0);
+    AMG_Res[iLevel] = new CSysVector(nBlk, AMG_Matrix[iLevel]->nPointDomain, nVar, 0.0);
+    AMG_Aux[iLevel] = new CSysVector(nBlk, AMG_Matrix[iLevel]->nPointDomain, nVar, 0.0);
+  }
+  
+  /*--- The coarsest level is solved exactly when it is small enough, otherwise smoothed ---*/
+  
+  AMG_CoarseFactorize();
+  
+  /*--- Smoothers of the (transposed) operators ---*/
+  
+  for (iLevel = 0; iLevel < AMG_nLevel; iLevel++) {
+    if ((iLevel == AMG_nLevel-1) && (AMG_nCoarseDense > 0)) break;
+    if (AMG_Smoother == ILU) AMG_Matrix[iLevel]->BuildILUPreconditioner(transposed);
+    else AMG_Matrix[iLevel]->BuildJacobiPreconditioner(transposed);
+  }
+  
+}
+
+bool CSysMatrix::AMG_Coarsen(unsigned short iLevel, CConfig *config) {
+  
+  /*--- Strength threshold of the aggregation, levels with fewer rows are not
+   coarsened and the prolongation smoother uses the usual 4/3 over the spectral radius ---*/
+  
+  const passivedouble Strength = 0.08;
+  const unsigned long nCoarsest = 64;
+  
+  CSysMatrix *Fine = AMG_Matrix[iLevel], *Coarse;
+  const unsigned long nBlk = nVar*nVar, nFine = Fine->nPointDomain;
+  const unsigned long *ptr = Fine->row_ptr, *col = Fine->col_ind;
+  const su2double *A = Fine->matrix;
+  vector<su2double> A_Copy;
+  
+  unsigned long iPoint, jPoint, index, kIndex, iAgg, jAgg, iVar, jVar, nAgg = 0, nnzP, nnzC, rowStart, pos;
+  long *Aggregate, *Aggregate_Old, *Marker;
+  passivedouble *DiagNorm, norm, maxNorm, rho = 0.0, rowSum, *Weight;
+  su2double omega, *InvDiag, *Block_T, *Block_AP;
+  bool Free;
+  
+  if (nFine <= nCoarsest) return false;
+  
+  /*--- The coarsening works on su2double blocks, the single precision storage is converted once ---*/
+  
+  if (Fine->Matrix_Float) {
+    A_Copy.resize(Fine->nnz*nBlk);
+    for (index = 0; index < Fine->nnz*nBlk; index++) A_Copy[index] = Fine->matrix_float[index];
+    A = &A_Copy[0];
+  }
+  
+  /*--- Strength of connection, |A_ij| > Strength*sqrt(|A_ii|*|A_jj|) with the Frobenius norm ---*/
+  
+  DiagNorm = new passivedouble [nFine];
+  Weight   = new passivedouble [ptr[nFine]];
+  for (iPoint = 0; iPoint < nFine; iPoint++) {
+    DiagNorm[iPoint] = 0.0;
+    for (index = ptr[iPoint]; index < ptr[iPoint+1]; index++)
+      if (col[index] == iPoint) DiagNorm[iPoint] = GetBlockNorm(&A[index*nBlk]);
+  }
+  for (iPoint = 0; iPoint < nFine; iPoint++) {
+    for (index = ptr[iPoint]; index < ptr[iPoint+1]; index++) {
+      jPoint = col[index];
+      Weight[index] = 0.0;
+      if ((jPoint != iPoint) && (jPoint < nFine)) {
+        norm = GetBlockNorm(&A[index*nBlk]);
+        if (norm > Strength*sqrt(DiagNorm[iPoint]*DiagNorm[jPoint])) Weight[index] = norm;
+      }
+    }
+  }
+  
+  /*--- Aggregation. Isolated points (no strong neighbors, e.g. Dirichlet rows) are
+   left out (-2) and only treated by the smoother. ---*/
+  
+  Aggregate     = new long [nFine];
+  Aggregate_Old = new long [nFine];
+  for (iPoint = 0; iPoint < nFine; iPoint++) {
+    Aggregate[iPoint] = -2;
+    for (index = ptr[iPoint]; index < ptr[iPoint+1]; index++)
+      if (Weight[index] > 0.0) { Aggregate[iPoint] = -1; break; }
+  }
+  
+  /*--- First pass, points whose strong neighborhood is still free form an aggregate ---*/
+  
+  for (iPoint = 0; iPoint < nFine; iPoint++) {
+    if (Aggregate[iPoint] != -1) continue;
+    Free = true;
+    for (index = ptr[iPoint]; index < ptr[iPoint+1]; index++)
+      if ((Weight[index] > 0.0) && (Aggregate[col[index]] >= 0)) { Free = false; break; }
+    if (!Free) continue;
+    Aggregate[iPoint] = nAgg;
+    for (index = ptr[iPoint]; index < ptr[iPoint+1]; index++)
+      if (Weight[index] > 0.0) Aggregate[col[index]] = nAgg;
+    nAgg++;
+  }
+  
+  /*--- Second pass, the remaining points join the aggregate of the strongest neighbor of the first pass ---*/
+  
+  for (iPoint = 0; iPoint < nFine; iPoint++) Aggregate_Old[iPoint] = Aggregate[iPoint];
+  for (iPoint = 0; iPoint < nFine; iPoint++) {
+    if (Aggregate_Old[iPoint] != -1) continue;
+    maxNorm = 0.0;
+    for (index = ptr[iPoint]; index < ptr[iPoint+1]; index++) {
+      if ((Weight[index] > maxNorm) && (Aggregate_Old[col[index]] >= 0)) {
+        maxNorm = Weight[index];
+        Aggregate[iPoint] = Aggregate_Old[col[index]];
+      }
+    }
+  }
+  
+  /*--- Third pass, what is left forms new aggregates with its free strong neighbors ---*/
+  
+  for (iPoint = 0; iPoint < nFine; iPoint++) {
+    if (Aggregate[iPoint] != -1) continue;
+    Aggregate[iPoint] = nAgg;
+    for (index = ptr[iPoint]; index < ptr[iPoint+1]; index++)
+      if ((Weight[index] > 0.0) && (Aggregate[col[index]] == -1)) Aggregate[col[index]] = nAgg;
+    nAgg++;
+  }
+  
+  delete [] DiagNorm;
+  delete [] Weight;
+  delete [] Aggregate_Old;
+  
+  /*--- Stop if the level does not coarsen anymore ---*/
+  
+  if ((nAgg == 0) || (10*nAgg > 9*nFine)) {
+    delete [] Aggregate;
+    return false;
+  }
+  
+  /*--- Inverse diagonal blocks and Gershgorin bound of the spectral radius of inv(D)*A ---*/
+  
+  InvDiag  = new su2double [nFine*nBlk];
+  Block_T  = new su2double [nBlk];
+  Block_AP = new su2double [nBlk];
+  
+  for (iPoint = 0; iPoint < nFine; iPoint++) {
+    Fine->InverseDiagonalBlock(iPoint, &InvDiag[iPoint*nBlk], false);
+    rowSum = 0.0;
+    for (index = ptr[iPoint]; index < ptr[iPoint+1]; index++) {
+      if (col[index] >= nFine) continue;
+      GetMultBlockBlock(Block_T, &InvDiag[iPoint*nBlk], (su2double*)&A[index*nBlk]);
+      maxNorm = 0.0;
+      for (iVar = 0; iVar < nVar; iVar++) {
+        norm = 0.0;
+        for (jVar = 0; jVar < nVar; jVar++) norm += fabs(SU2_TYPE::GetValue(Block_T[iVar*nVar+jVar]));
+        maxNorm = max(maxNorm, norm);
+      }
+      rowSum += maxNorm;
+    }
+    rho = max(rho, rowSum);
+  }
+  omega = 4.0/(3.0*rho);
+  
+  /*--- Smoothed prolongation P = (I - omega*inv(D)*A)*P0, where P0 injects each
+   aggregate into its points with identity blocks ---*/
+  
+  Marker = new long [nAgg];
+  for (iAgg = 0; iAgg < nAgg; iAgg++) Marker[iAgg] = -1;
+  
+  vector<unsigned long> P_ptr(nFine+1, 0), P_col;
+  vector<su2double> P_val;
+  
+  for (iPoint = 0; iPoint < nFine; iPoint++) {
+    rowStart = P_col.size();
+    for (index = ptr[iPoint]; index < ptr[iPoint+1]; index++) {
+      jPoint = col[index];
+      if ((jPoint >= nFine) || (Aggregate[jPoint] < 0)) continue;
+      jAgg = Aggregate[jPoint];
+      if (Marker[jAgg] < (long)rowStart) {
+        Marker[jAgg] = P_col.size();
+        P_col.push_back(jAgg);
+        P_val.resize(P_val.size()+nBlk, 0.0);
+      }
+      pos = Marker[jAgg]*nBlk;
+      GetMultBlockBlock(Block_T, &InvDiag[iPoint*nBlk], (su2double*)&A[index*nBlk]);
+      for (iVar = 0; iVar < nBlk; iVar++) P_val[pos+iVar] -= omega*Block_T[iVar];
+      if (jPoint == iPoint)
+        for (iVar = 0; iVar < nVar; iVar++) P_val[pos+iVar*nVar+iVar] += 1.0;
+    }
+    P_ptr[iPoint+1] = P_col.size();
+  }
+  nnzP = P_col.size();
+  
+  AMG_Prolong_ptr[iLevel] = new unsigned long [nFine+1];
+  AMG_Prolong_col[iLevel] = new unsigned long [nnzP];
+  AMG_Prolong_val[iLevel] = new su2double [nnzP*nBlk];
+  for (iPoint = 0; iPoint <= nFine; iPoint++) AMG_Prolong_ptr[iLevel][iPoint] = P_ptr[iPoint];
+  for (index = 0; index < nnzP; index++) AMG_Prolong_col[iLevel][index] = P_col[index];
+  for (index = 0; index < nnzP*nBlk; index++) AMG_Prolong_val[iLevel][index] = P_val[index];
+  
+  /*--- Restriction, the pattern of the transposed prolongation ---*/
+  
+  AMG_Restrict_ptr[iLevel] = new unsigned long [nAgg+1];
+  AMG_Restrict_row[iLevel] = new unsigned long [nnzP];
+  AMG_Restrict_idx[iLevel] = new unsigned long [nnzP];
+  
+  for (iAgg = 0; iAgg <= nAgg; iAgg++) AMG_Restrict_ptr[iLevel][iAgg] = 0;
+  for (index = 0; index < nnzP; index++) AMG_Restrict_ptr[iLevel][P_col[index]+1]++;
+  for (iAgg = 0; iAgg < nAgg; iAgg++) AMG_Restrict_ptr[iLevel][iAgg+1] += AMG_Restrict_ptr[iLevel][iAgg];
+  for (iPoint = 0; iPoint < nFine; iPoint++) {
+    for (index = P_ptr[iPoint]; index < P_ptr[iPoint+1]; index++) {
+      pos = AMG_Restrict_ptr[iLevel][P_col[index]]++;
+      AMG_Restrict_row[iLevel][pos] = iPoint;
+      AMG_Restrict_idx[iLevel][pos] = index;
+    }
+  }
+  for (iAgg = nAgg; iAgg > 0; iAgg--) AMG_Restrict_ptr[iLevel][iAgg] = AMG_Restrict_ptr[iLevel][iAgg-1];
+  AMG_Restrict_ptr[iLevel][0] = 0;
+  
+  /*--- A*P, row by row ---*/
+  
+  vector<unsigned long> AP_ptr(nFine+1, 0), AP_col;
+  vector<su2double> AP_val;
+  
+  for (iAgg = 0; iAgg < nAgg; iAgg++) Marker[iAgg] = -1;
+  for (iPoint = 0; iPoint < nFine; iPoint++) {
+    rowStart = AP_col.size();
+    for (index = ptr[iPoint]; index < ptr[iPoint+1]; index++) {
+      jPoint = col[index];
+      if (jPoint >= nFine) continue;
+      for (kIndex = P_ptr[jPoint]; kIndex < P_ptr[jPoint+1]; kIndex++) {
+        jAgg = P_col[kIndex];
+        if (Marker[jAgg] < (long)rowStart) {
+          Marker[jAgg] = AP_col.size();
+          AP_col.push_back(jAgg);
+          AP_val.resize(AP_val.size()+nBlk, 0.0);
+        }
+        pos = Marker[jAgg]*nBlk;
+        GetMultBlockBlock(Block_AP, (su2double*)&A[index*nBlk], &P_val[kIndex*nBlk]);
+        for (iVar = 0; iVar < nBlk; iVar++) AP_val[pos+iVar] += Block_AP[iVar];
+      }
+    }
+    AP_ptr[iPoint+1] = AP_col.size();
+  }
+  
+  /*--- Galerkin operator P^T*(A*P), row by row of the restriction ---*/
+  
+  vector<unsigned long> C_ptr(nAgg+1, 0), C_col;
+  vector<su2double> C_val;
+  
+  for (iAgg = 0; iAgg < nAgg; iAgg++) Marker[iAgg] = -1;
+  for (iAgg = 0; iAgg < nAgg; iAgg++) {
+    rowStart = C_col.size();
+    for (kIndex = AMG_Restrict_ptr[iLevel][iAgg]; kIndex < AMG_Restrict_ptr[iLevel][iAgg+1]; kIndex++) {
+      iPoint = AMG_Restrict_row[iLevel][kIndex];
+      pos = AMG_Restrict_idx[iLevel][kIndex]*nBlk;
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          Block_T[iVar*nVar+jVar] = P_val[pos+jVar*nVar+iVar];
+      for (index = AP_ptr[iPoint]; index < AP_ptr[iPoint+1]; index++) {
+        jAgg = AP_col[index];
+        if (Marker[jAgg] < (long)rowStart) {
+          Marker[jAgg] = C_col.size();
+          C_col.push_back(jAgg);
+          C_val.resize(C_val.size()+nBlk, 0.0);
+        }
+        GetMultBlockBlock(Block_AP, Block_T, &AP_val[index*nBlk]);
+        for (iVar = 0; iVar < nBlk; iVar++) C_val[Marker[jAgg]*nBlk+iVar] += Block_AP[iVar];
+      }
+    }
+    C_ptr[iAgg+1] = C_col.size();
+  }
+  nnzC = C_col.size();
+  
+  /*--- The coarse operator is a matrix of its own, with its kernels and smoothers ---*/
+  
+  unsigned long *Coarse_row_ptr = new unsigned long [nAgg+1];
+  unsigned long *Coarse_col_ind = new unsigned long [nnzC];
+  for (iAgg = 0; iAgg <= nAgg; iAgg++) Coarse_row_ptr[iAgg] = C_ptr[iAgg];
+  for (index = 0; index < nnzC; index++) Coarse_col_ind[index] = C_col[index];
+  
+  Coarse = new CSysMatrix();
+  Coarse->SetIndexes(nAgg, nAgg, nVar, nVar, Coarse_row_ptr, Coarse_col_ind, nnzC, config);
+  for (index = 0; index < nnzC*nBlk; index++) {
+    if (Coarse->Matrix_Float) Coarse->matrix_float[index] = SU2_TYPE::GetValue(C_val[index]);
+    else Coarse->matrix[index] = C_val[index];
+  }
+  AMG_Matrix[iLevel+1] = Coarse;
+  
+  delete [] Aggregate;
+  delete [] Marker;
+  delete [] InvDiag;
+  delete [] Block_T;
+  delete [] Block_AP;
+  
+  return true;
+  
+}
+
+void CSysMatrix::AMG_CoarseFactorize(void) {
+  
+  /*--- Largest dense system solved directly on the coarsest level ---*/
+  
+  const unsigned long nDense_Max = 1000;
+  
+  CSysMatrix *Coarse = AMG_Matrix[AMG_nLevel-1];
+  unsigned long iPoint, index, iVar, jVar, iRow, jRow, kRow, N = Coarse->nPointDomain*nVar;
+  su2double *LU, pivot, weight, aux;
+  
+  AMG_nCoarseDense = 0;
+  if (N > nDense_Max) return;
+  
+  AMG_nCoarseDense = N;
+  AMG_CoarseLU  = LU = new su2double [N*N];
+  AMG_CoarsePiv = new unsigned long [N];
+  
+  for (index = 0; index < N*N; index++) LU[index] = 0.0;
+  for (iPoint = 0; iPoint < Coarse->nPointDomain; iPoint++)
+    for (index = Coarse->row_ptr[iPoint]; index < Coarse->row_ptr[iPoint+1]; index++)
+      if (Coarse->col_ind[index] < Coarse->nPointDomain) {
+        for (iVar = 0; iVar < nVar; iVar++)
+          for (jVar = 0; jVar < nVar; jVar++)
+            if (Coarse->Matrix_Float) LU[(iPoint*nVar+iVar)*N+Coarse->col_ind[index]*nVar+jVar] = Coarse->matrix_float[index*nVar*nVar+iVar*nVar+jVar];
+            else LU[(iPoint*nVar+iVar)*N+Coarse->col_ind[index]*nVar+jVar] = Coarse->matrix[index*nVar*nVar+iVar*nVar+jVar];
+      }
+  
+  /*--- LU with partial pivoting, the interchanges are stored as in LAPACK ---*/
+  
+  for (kRow = 0; kRow < N; kRow++) {
+    AMG_CoarsePiv[kRow] = kRow;
+    pivot = fabs(LU[kRow*N+kRow]);
+    for (iRow = kRow+1; iRow < N; iRow++)
+      if (fabs(LU[iRow*N+kRow]) > pivot) { pivot = fabs(LU[iRow*N+kRow]); AMG_CoarsePiv[kRow] = iRow; }
+    if (AMG_CoarsePiv[kRow] != kRow)
+      for (jRow = 0; jRow < N; jRow++) {
+        aux = LU[kRow*N+jRow];
+        LU[kRow*N+jRow] = LU[AMG_CoarsePiv[kRow]*N+jRow];
+        LU[AMG_CoarsePiv[kRow]*N+jRow] = aux;
+      }
+    if (LU[kRow*N+kRow] == 0.0) LU[kRow*N+kRow] = 1.0;
+    for (iRow = kRow+1; iRow < N; iRow++) {
+      weight = LU[iRow*N+kRow]/LU[kRow*N+kRow];
+      LU[iRow*N+kRow] = weight;
+      for (jRow = kRow+1; jRow < N; jRow++) LU[iRow*N+jRow] -= weight*LU[kRow*N+jRow];
+    }
+  }
+  
+}
+
+void CSysMatrix::AMG_CoarseSolve(void) {
+  
+  const unsigned long N = AMG_nCoarseDense;
+  const su2double *LU = AMG_CoarseLU;
+  CSysVector & b = *AMG_Rhs[AMG_nLevel-1];
+  CSysVector & x = *AMG_Sol[AMG_nLevel-1];
+  unsigned long iRow, jRow;
+  su2double aux;
+  
+  for (iRow = 0; iRow < N; iRow++) x[iRow] = b[iRow];
+  
+  if (!AMG_Transposed) {
+    
+    /*--- P*A = L*U, solve L*U*x = P*b ---*/
+    
+    for (iRow = 0; iRow < N; iRow++) {
+      aux = x[iRow]; x[iRow] = x[AMG_CoarsePiv[iRow]]; x[AMG_CoarsePiv[iRow]] = aux;
+    }
+    for (iRow = 0; iRow < N; iRow++)
+      for (jRow = 0; jRow < iRow; jRow++) x[iRow] -= LU[iRow*N+jRow]*x[jRow];
+    for (iRow = N; iRow-- > 0; ) {
+      for (jRow = iRow+1; jRow < N; jRow++) x[iRow] -= LU[iRow*N+jRow]*x[jRow];
+      x[iRow] /= LU[iRow*N+iRow];
+    }
+  }
+  else {
+    
+    /*--- A^T = U^T*L^T*P, solve U^T*L^T*y = b and x = P^T*y ---*/
+    
+    for (iRow = 0; iRow < N; iRow++) {
+      for (jRow = 0; jRow < iRow; jRow++) x[iRow] -= LU[jRow*N+iRow]*x[jRow];
+      x[iRow] /= LU[iRow*N+iRow];
+    }
+    for (iRow = N; iRow-- > 0; )
+      for (jRow = iRow+1; jRow < N; jRow++) x[iRow] -= LU[jRow*N+iRow]*x[jRow];
+    for (iRow = N; iRow-- > 0; ) {
+      aux = x[iRow]; x[iRow] = x[AMG_CoarsePiv[iRow]]; x[AMG_CoarsePiv[iRow]] = aux;
+    }
+  }
+  
+}
+
+void CSysMatrix::AMG_Residual(unsigned short iLevel) {
+  
+  CSysMatrix *Level = AMG_Matrix[iLevel];
+  CSysVector & b = *AMG_Rhs[iLevel];
+  CSysVector & x = *AMG_Sol[iLevel];
+  CSysVector & r = *AMG_Res[iLevel];
+  CSysVector & Ax = *AMG_Aux[iLevel];
+  
+  if (AMG_Transposed) Level->MatrixVectorProductTransposed(x, Ax);
+  else Level->MatrixVectorProduct(x, Ax);
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (long i = 0; i < (long)(Level->nPointDomain*nVar); i++)
+    r[i] = b[i] - Ax[i];
+  
+}
+
+void CSysMatrix::AMG_Smooth(unsigned short iLevel, unsigned short nSweep) {
+  
+  /*--- Damping of the Jacobi smoother ---*/
+  
+  const su2double omega = 2.0/3.0;
+  
+  CSysMatrix *Level = AMG_Matrix[iLevel];
+  CSysVector & x = *AMG_Sol[iLevel];
+  CSysVector & r = *AMG_Res[iLevel];
+  CSysVector & z = *AMG_Aux[iLevel];
+  unsigned short iSweep;
+  
+  for (iSweep = 0; iSweep < nSweep; iSweep++) {
+    AMG_Residual(iLevel);
+    if (AMG_Smoother == ILU) {
+      Level->ILU_Substitution(r);
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (long i = 0; i < (long)(Level->nPointDomain*nVar); i++) x[i] += r[i];
+    }
+    else {
+      Level->ComputeJacobiPreconditioner(r, z);
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (long i = 0; i < (long)(Level->nPointDomain*nVar); i++) x[i] += omega*z[i];
+    }
+  }
+  
+}
+
+void CSysMatrix::AMG_Cycle(unsigned short iLevel) {
+  
+  CSysVector & x = *AMG_Sol[iLevel];
+  
+  x = su2double(0.0);
+  
+  /*--- Coarsest level ---*/
+  
+  if (iLevel == AMG_nLevel-1) {
+    if (AMG_nCoarseDense > 0) AMG_CoarseSolve();
+    else AMG_Smooth(iLevel, max(2*(AMG_PreSmooth+AMG_PostSmooth), 4));
+    return;
+  }
+  
+  const unsigned long nBlk = nVar*nVar, nCoarse = AMG_Matrix[iLevel+1]->nPointDomain;
+  const unsigned long *R_ptr = AMG_Restrict_ptr[iLevel], *R_row = AMG_Restrict_row[iLevel], *R_idx = AMG_Restrict_idx[iLevel];
+  const unsigned long *P_ptr = AMG_Prolong_ptr[iLevel], *P_col = AMG_Prolong_col[iLevel];
+  const su2double *P_val = AMG_Prolong_val[iLevel];
+  CSysVector & r = *AMG_Res[iLevel];
+  CSysVector & b_c = *AMG_Rhs[iLevel+1];
+  CSysVector & x_c = *AMG_Sol[iLevel+1];
+  
+  AMG_Smooth(iLevel, AMG_PreSmooth);
+  
+  /*--- Restriction of the residual, b_c = P^T*r ---*/
+  
+  AMG_Residual(iLevel);
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (long iAgg = 0; iAgg < (long)nCoarse; iAgg++) {
+    unsigned long index, iVar, jVar;
+    for (iVar = 0; iVar < nVar; iVar++) b_c[iAgg*nVar+iVar] = 0.0;
+    for (index = R_ptr[iAgg]; index < R_ptr[iAgg+1]; index++)
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          b_c[iAgg*nVar+iVar] += P_val[R_idx[index]*nBlk+jVar*nVar+iVar]*r[R_row[index]*nVar+jVar];
+  }
+  
+  AMG_Cycle(iLevel+1);
+  
+  /*--- Prolongation of the correction, x += P*x_c ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (long iPoint = 0; iPoint < (long)AMG_Matrix[iLevel]->nPointDomain; iPoint++) {
+    unsigned long index, iVar, jVar;
+    for (index = P_ptr[iPoint]; index < P_ptr[iPoint+1]; index++)
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          x[iPoint*nVar+iVar] += P_val[index*nBlk+iVar*nVar+jVar]*x_c[P_col[index]*nVar+jVar];
+  }
+  
+  AMG_Smooth(iLevel, AMG_PostSmooth);
+  
+}
+
+void CSysMatrix::ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  CSysVector & b = *AMG_Rhs[0];
+  CSysVector & x = *AMG_Sol[0];
+  unsigned long i;
+  
+  for (i = 0; i < nPointDomain*nVar; i++) b[i] = vec[i];
+  
+  AMG_Cycle(0);
+  
+  for (i = 0; i < nPointDomain*nVar; i++) prod[i] = x[i];
+  
+  /*--- MPI Parallelization ---*/
+  
+  if (geometry != NULL) SendReceive_Solution(prod, geometry, config);
+  else SendReceive_Local(prod);
+  
+}
+
+void CSysMatrix::DeleteAMG(void) {
+  
+  unsigned short iLevel;
+  
+  if (AMG_Matrix == NULL) return;
+  
+  for (iLevel = 0; iLevel < AMG_nLevel; iLevel++) {
+    if (iLevel > 0) delete AMG_Matrix[iLevel];
+    if (AMG_Prolong_ptr[iLevel] != NULL)  delete [] AMG_Prolong_ptr[iLevel];
+    if (AMG_Prolong_col[iLevel] != NULL)  delete [] AMG_Prolong_col[iLevel];
+    if (AMG_Prolong_val[iLevel] != NULL)  delete [] AMG_Prolong_val[iLevel];
+    if (AMG_Restrict_ptr[iLevel] != NULL) delete [] AMG_Restrict_ptr[iLevel];
+    if (AMG_Restrict_row[iLevel] != NULL) delete [] AMG_Restrict_row[iLevel];
+    if (AMG_Restrict_idx[iLevel] != NULL) delete [] AMG_Restrict_idx[iLevel];
+    if (AMG_Rhs != NULL) {
+      delete AMG_Rhs[iLevel];
+      delete AMG_Sol[iLevel];
+      delete AMG_Res[iLevel];
+      delete AMG_Aux[iLevel];
+    }
+  }
+  
+  delete [] AMG_Matrix;
+  delete [] AMG_Prolong_ptr;
+  delete [] AMG_Prolong_col;
+  delete [] AMG_Prolong_val;
+  delete [] AMG_Restrict_ptr;
+  delete [] AMG_Restrict_row;
+  delete [] AMG_Restrict_idx;
+  if (AMG_Rhs != NULL) {
+    delete [] AMG_Rhs;
+    delete [] AMG_Sol;
+    delete [] AMG_Res;
+    delete [] AMG_Aux;
+  }
+  if (AMG_CoarseLU != NULL)  delete [] AMG_CoarseLU;
+  if (AMG_CoarsePiv != NULL) delete [] AMG_CoarsePiv;
+  
+  AMG_nLevel = 0;       AMG_Matrix = NULL;
+  AMG_Prolong_ptr = NULL;  AMG_Prolong_col = NULL;  AMG_Prolong_val = NULL;
+  AMG_Restrict_ptr = NULL; AMG_Restrict_row = NULL; AMG_Restrict_idx = NULL;
+  AMG_Rhs = NULL; AMG_Sol = NULL; AMG_Res = NULL; AMG_Aux = NULL;
+  AMG_CoarseLU = NULL;  AMG_CoarsePiv = NULL;  AMG_nCoarseDense = 0;
+  
+}
+
 void CSysMatrix::ComputeResidual(const CSysVector & sol, const CSysVector & f, CSysVector & res) {
   
   unsigned long iPoint, iVar;
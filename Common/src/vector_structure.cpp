@@ -195,6 +195,9 @@ void CSysVector::Equals_AX(const su2double & a, CSysVector & x) {
     cerr << "CSysVector::Equals_AX(): " << "sizes do not match";
     throw(-1);
   }
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] = a * x.vec_val[i];
 }
@@ -205,6 +208,9 @@ void CSysVector::Plus_AX(const su2double & a, CSysVector & x) {
     cerr << "CSysVector::Plus_AX(): " << "sizes do not match";
     throw(-1);
   }
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] += a * x.vec_val[i];
 }
@@ -215,6 +221,9 @@ void CSysVector::Equals_AX_Plus_BY(const su2double & a, CSysVector & x, const su
     cerr << "CSysVector::Equals_AX_Plus_BY(): " << "sizes do not match";
     throw(-1);
   }
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] = a * x.vec_val[i] + b * y.vec_val[i];
 }
@@ -244,6 +253,9 @@ CSysVector & CSysVector::operator=(const CSysVector & u) {
 }
 
 CSysVector & CSysVector::operator=(const su2double & val) {
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] = val;
   return *this;
@@ -264,6 +276,9 @@ CSysVector & CSysVector::operator+=(const CSysVector & u) {
     cerr << "CSysVector::operator+=(CSysVector): " << "sizes do not match";
     throw(-1);
   }
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] += u.vec_val[i];
   return *this;
@@ -284,6 +299,9 @@ CSysVector & CSysVector::operator-=(const CSysVector & u) {
     cerr << "CSysVector::operator-=(CSysVector): " << "sizes do not match";
     throw(-1);
   }
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] -= u.vec_val[i];
   return *this;
@@ -309,6 +327,9 @@ CSysVector operator*(const su2double & val, const CSysVector & u) {
 
 CSysVector & CSysVector::operator*=(const su2double & val) {
   
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] *= val;
   return *this;
@@ -325,6 +346,9 @@ CSysVector CSysVector::operator/(const su2double & val) const {
 
 CSysVector & CSysVector::operator/=(const su2double & val) {
   
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] /= val;
   return *this;
@@ -404,6 +428,9 @@ su2double dotProd(const CSysVector & u, const CSysVector & v) {
   /*--- find local inner product and, if a parallel run, sum over all
    processors (we use nElemDomain instead of nElem) ---*/
   su2double loc_prod = 0.0;
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static) reduction(+:loc_prod)
+#endif
   for (unsigned long i = 0; i < u.nElmDomain; i++)
     loc_prod += u.vec_val[i]*v.vec_val[i];
   su2double prod = 0.0;
@@ -416,3 +443,53 @@ su2double dotProd(const CSysVector & u, const CSysVector & v) {
   
   return prod;
 }
+
+void dotProdLocal(unsigned short nDot, const CSysVector * const *u, const CSysVector * const *v, su2double *prod) {
+  
+  unsigned short iDot;
+  
+  /*--- check for consistent sizes ---*/
+  for (iDot = 0; iDot < nDot; iDot++) {
+    if ((u[iDot]->nElm != u[0]->nElm) || (v[iDot]->nElm != u[0]->nElm)) {
+      cerr << "CSysVector friend dotProdLocal(unsigned short, CSysVector**, CSysVector**, su2double*): "
+      << "CSysVector sizes do not match";
+      throw(-1);
+    }
+  }
+  
+  for (iDot = 0; iDot < nDot; iDot++) prod[iDot] = 0.0;
+  
+  /*--- every thread accumulates its own partial sums, which are added
+   together at the end (no array reductions in OpenMP 3) ---*/
+#ifdef HAVE_OMP
+#pragma omp parallel
+#endif
+  {
+    vector<su2double> loc_prod(nDot, 0.0);
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+    for (unsigned long i = 0; i < u[0]->nElmDomain; i++)
+      for (unsigned short jDot = 0; jDot < nDot; jDot++)
+        loc_prod[jDot] += u[jDot]->vec_val[i]*v[jDot]->vec_val[i];
+#ifdef HAVE_OMP
+#pragma omp critical
+#endif
+    for (unsigned short jDot = 0; jDot < nDot; jDot++)
+      prod[jDot] += loc_prod[jDot];
+  }
+  
+}
+
+void dotProdFused(unsigned short nDot, const CSysVector * const *u, const CSysVector * const *v, su2double *prod) {
+  
+#ifdef HAVE_MPI
+  su2double *loc_prod = new su2double[nDot];
+  dotProdLocal(nDot, u, v, loc_prod);
+  SU2_MPI::Allreduce(loc_prod, prod, nDot, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  delete [] loc_prod;
+#else
+  dotProdLocal(nDot, u, v, prod);
+#endif
+  
+}
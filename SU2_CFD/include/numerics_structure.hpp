@@ -48,6 +48,40 @@
 
 using namespace std;
 
+/*!
+ * \class CEdgeBlock
+ * \brief Block of edges stored in SoA form (one array of EDGE_BLOCK_SIZE lanes per quantity),
+ *        used by the batched convective numerics of the compressible flow equations.
+ * \version 4.2.0 "Cardinal"
+ */
+class CEdgeBlock {
+public:
+  unsigned short nEdge;            /*!< \brief Number of edges stored in the block. */
+  bool Dissipation;                /*!< \brief The scheme needs the artificial dissipation data (centered schemes). */
+  unsigned long Point_i[EDGE_BLOCK_SIZE],  /*!< \brief First point of each edge. */
+  Point_j[EDGE_BLOCK_SIZE];        /*!< \brief Second point of each edge. */
+  su2double Normal[3][EDGE_BLOCK_SIZE];    /*!< \brief Normal vectors, their norm is the area of the face. */
+  su2double V_i[8][EDGE_BLOCK_SIZE],       /*!< \brief Primitive variables (T, vel, P, rho, h, c) at point i. */
+  V_j[8][EDGE_BLOCK_SIZE];         /*!< \brief Primitive variables (T, vel, P, rho, h, c) at point j. */
+  su2double Lambda_i[EDGE_BLOCK_SIZE],     /*!< \brief Spectral radius at point i. */
+  Lambda_j[EDGE_BLOCK_SIZE];       /*!< \brief Spectral radius at point j. */
+  su2double Neighbor_i[EDGE_BLOCK_SIZE],   /*!< \brief Number of neighbors of the point i. */
+  Neighbor_j[EDGE_BLOCK_SIZE];     /*!< \brief Number of neighbors of the point j. */
+  su2double Sensor_i[EDGE_BLOCK_SIZE],     /*!< \brief Pressure sensor at point i. */
+  Sensor_j[EDGE_BLOCK_SIZE];       /*!< \brief Pressure sensor at point j. */
+  su2double Und_Lapl_i[5][EDGE_BLOCK_SIZE],  /*!< \brief Undivided laplacians at point i. */
+  Und_Lapl_j[5][EDGE_BLOCK_SIZE];  /*!< \brief Undivided laplacians at point j. */
+  su2double Residual[5][EDGE_BLOCK_SIZE];  /*!< \brief Residual of each edge. */
+  su2double Jacobian_i[5][5][EDGE_BLOCK_SIZE], /*!< \brief Jacobian of each edge at point i (implicit computation). */
+  Jacobian_j[5][5][EDGE_BLOCK_SIZE];   /*!< \brief Jacobian of each edge at point j (implicit computation). */
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_dissipation - Store the artificial dissipation data of the edges.
+   */
+  CEdgeBlock(bool val_dissipation);
+};
+
 /*!
  * \class CNumerics
  * \brief Class for defining the numerical methods.
@@ -64,6 +98,9 @@ protected:
   su2double *Enthalpy_formation;
   su2double Prandtl_Lam;				/*!< \brief Laminar Prandtl's number. */
   su2double Prandtl_Turb;		/*!< \brief Turbulent Prandtl's number. */
+  unsigned short nThread;       /*!< \brief Number of threads of the threaded edge loops (see SetThread_Numerics). */
+  CNumerics **Thread_Numerics;  /*!< \brief Copy of the numerics for each thread, the copy of thread 0 is this object. */
+  CEdgeBlock *Block;            /*!< \brief Block of edges of the batched numerics (NULL if the scheme has no batched kernel). */
   
 public:
   
@@ -225,6 +262,45 @@ public:
    */
   virtual ~CNumerics(void);
   
+  /*!
+   * \brief Set the copies of the numerics for the threaded edge loops, the class takes their ownership.
+   * \param[in] val_nThread - Number of threads.
+   * \param[in] val_numerics - Copy of the numerics for each thread, the first one is not used.
+   */
+  void SetThread_Numerics(unsigned short val_nThread, CNumerics **val_numerics);
+  
+  /*!
+   * \brief Get the number of threads with a copy of the numerics (1 if there are no copies).
+   */
+  unsigned short GetnThread_Numerics(void);
+  
+  /*!
+   * \brief Get the copy of the numerics of a thread.
+   * \param[in] val_thread - Thread.
+   */
+  CNumerics *GetThread_Numerics(unsigned short val_thread);
+  
+  /*!
+   * \brief Get the block of edges of the batched numerics.
+   * \return Block of edges, NULL if the fluxes are computed one edge at a time.
+   */
+  CEdgeBlock *GetEdge_Block(void);
+  
+  /*!
+   * \brief Store the normal, the primitive variables and (centered schemes) the dissipation data
+   *        currently set in the numerics as a new edge of the block.
+   * \param[in] val_iPoint - First point of the edge.
+   * \param[in] val_jPoint - Second point of the edge.
+   * \return <code>TRUE</code> if the block is full; otherwise <code>FALSE</code>.
+   */
+  bool AddEdge_Block(unsigned long val_iPoint, unsigned long val_jPoint);
+  
+  /*!
+   * \brief Compute the residual and the Jacobians of all the edges of the block.
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void ComputeResidual_Block(CConfig *config);
+  
   /*!
    * \brief Compute the determinant of a 3 by 3 matrix.
    * \param[in] val_matrix 3 by 3 matrix.
@@ -858,6 +934,33 @@ public:
                                  su2double val_laminar_viscosity,
                                  su2double val_eddy_viscosity);
   
+  /*!
+   * \brief Compute the projected inviscid flux vector of a block of edges.
+   * \param[in] val_nEdge - Number of edges of the block.
+   * \param[in] val_density - Density of each edge.
+   * \param[in] val_velocity - Velocity of each edge.
+   * \param[in] val_pressure - Pressure of each edge.
+   * \param[in] val_enthalpy - Enthalpy of each edge.
+   * \param[in] val_normal - Normal vector of each edge, the norm of the vector is the area of the face.
+   * \param[out] val_Proj_Flux - Projected inviscid flux of each edge.
+   */
+  void GetInviscidProjFlux_Block(unsigned short val_nEdge, su2double *val_density, su2double (*val_velocity)[EDGE_BLOCK_SIZE],
+                                 su2double *val_pressure, su2double *val_enthalpy, su2double (*val_normal)[EDGE_BLOCK_SIZE],
+                                 su2double (*val_Proj_Flux)[EDGE_BLOCK_SIZE]);
+  
+  /*!
+   * \brief Compute the projection of the inviscid Jacobian matrices of a block of edges.
+   * \param[in] val_nEdge - Number of edges of the block.
+   * \param[in] val_velocity - Velocity of each edge.
+   * \param[in] val_energy - Energy of each edge.
+   * \param[in] val_normal - Normal vector of each edge, the norm of the vector is the area of the face.
+   * \param[in] val_scale - Scale of the projection.
+   * \param[out] val_Proj_Jac_Tensor - Projected inviscid Jacobian of each edge.
+   */
+  void GetInviscidProjJac_Block(unsigned short val_nEdge, su2double (*val_velocity)[EDGE_BLOCK_SIZE], su2double *val_energy,
+                                su2double (*val_normal)[EDGE_BLOCK_SIZE], su2double val_scale,
+                                su2double (*val_Proj_Jac_Tensor)[5][EDGE_BLOCK_SIZE]);
+  
   /*!
    * \brief Compute the projection of the inviscid Jacobian matrices.
    * \param[in] val_velocity Pointer to the velocity.
@@ -1132,6 +1235,32 @@ public:
   void GetPMatrix_inv(su2double *val_density, su2double *val_velocity,
                       su2double *val_soundspeed, su2double *val_normal,
                       su2double **val_invp_tensor);
+  
+  /*!
+   * \brief Computation of the matrix P of a block of edges.
+   * \param[in] val_nEdge - Number of edges of the block.
+   * \param[in] val_density - Density of each edge.
+   * \param[in] val_velocity - Velocity of each edge.
+   * \param[in] val_soundspeed - Sound speed of each edge.
+   * \param[in] val_normal - Unit normal vector of each edge.
+   * \param[out] val_p_tensor - P matrix of each edge.
+   */
+  void GetPMatrix_Block(unsigned short val_nEdge, su2double *val_density, su2double (*val_velocity)[EDGE_BLOCK_SIZE],
+                        su2double *val_soundspeed, su2double (*val_normal)[EDGE_BLOCK_SIZE],
+                        su2double (*val_p_tensor)[5][EDGE_BLOCK_SIZE]);
+  
+  /*!
+   * \brief Computation of the matrix P^{-1} of a block of edges.
+   * \param[in] val_nEdge - Number of edges of the block.
+   * \param[in] val_density - Density of each edge.
+   * \param[in] val_velocity - Velocity of each edge.
+   * \param[in] val_soundspeed - Sound speed of each edge.
+   * \param[in] val_normal - Unit normal vector of each edge.
+   * \param[out] val_invp_tensor - Inverse of the P matrix of each edge.
+   */
+  void GetPMatrix_inv_Block(unsigned short val_nEdge, su2double *val_density, su2double (*val_velocity)[EDGE_BLOCK_SIZE],
+                            su2double *val_soundspeed, su2double (*val_normal)[EDGE_BLOCK_SIZE],
+                            su2double (*val_invp_tensor)[5][EDGE_BLOCK_SIZE]);
 
   /*!
    * \brief Computation of the matrix P^{-1} (artificial compresibility), this matrix diagonalize the conservative Jacobians
@@ -1620,6 +1749,12 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
+  
+  /*!
+   * \brief Compute the Roe's flux of all the edges of the block.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Block(CConfig *config);
 };
 
 
@@ -2553,6 +2688,12 @@ public:
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j,
                        CConfig *config);
+  
+  /*!
+   * \brief Compute the flow residual of all the edges of the block using a JST method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Block(CConfig *config);
 };
 
 /*!
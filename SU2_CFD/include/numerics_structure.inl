@@ -45,6 +45,14 @@ inline su2double CNumerics::Determinant_3x3(su2double A00,
   
 }
 
+inline unsigned short CNumerics::GetnThread_Numerics(void) { return nThread; }
+
+inline CNumerics *CNumerics::GetThread_Numerics(unsigned short val_thread) { return (val_thread == 0) ? this : Thread_Numerics[val_thread]; }
+
+inline CEdgeBlock *CNumerics::GetEdge_Block(void) { return Block; }
+
+inline void CNumerics::ComputeResidual_Block(CConfig *config) { }
+
 inline void CNumerics::Compute_Mass_Matrix(CElement *element_container, CConfig *config){ }
 
 inline void CNumerics::Compute_Dead_Load(CElement *element_container, CConfig *config){ }
@@ -91,6 +91,20 @@ class COutput {
   unsigned short wrote_base_file;
   su2double RhoRes_New, RhoRes_Old;
   int cgns_base, cgns_zone, cgns_base_results, cgns_zone_results;
+#ifdef HAVE_MPI
+  vector<MPI_File> Async_File;        /*!< \brief Files being written in the background (asynchronous output). */
+  vector<MPI_Request> Async_Request;  /*!< \brief Requests of the background writes. */
+#endif
+  vector<vector<char>*> Async_Buffer; /*!< \brief Snapshots of the data written in the background, owned until the write is completed. */
+  map<string, string> Xdmf_Grids;     /*!< \brief Grids of the time steps already written in each XDMF index. */
+  map<string, string> Xdmf_Mesh;      /*!< \brief Geometry and topology items of the last mesh written in each XDMF index. */
+  string Timing_Buffer;               /*!< \brief Rows of the timing history not yet written (master node). */
+  unsigned long Timing_Offset;        /*!< \brief Bytes of the timing history already written (master node). */
+  vector<vector<pair<unsigned short, unsigned long> > > FastOutput_Surface; /*!< \brief Owned vertices (marker, vertex) of the fast output surface stream, per zone. */
+  vector<vector<long> > FastOutput_Probe;               /*!< \brief Local point of each probe on the rank that owns it (-1 elsewhere), per zone. */
+  vector<vector<unsigned long> > FastOutput_Plane_Edge; /*!< \brief Points of the edges cut by the sampling planes, per zone. */
+  vector<vector<su2double> > FastOutput_Plane_Weight;   /*!< \brief Interpolation weight of the second point of the cut edges, per zone. */
+  vector<vector<unsigned short> > FastOutput_Plane;     /*!< \brief Sampling plane of the cut edges, per zone. */
   
 protected:
 
@@ -273,6 +287,59 @@ public:
    * \param[in] val_iZone - iZone index.
 	 */
 	void SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone);
+  
+  /*!
+	 * \brief Name of the restart file of a zone (zone number and iteration appended when needed).
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_iZone - iZone index.
+	 */
+  string GetRestart_FileName(CConfig *config, CGeometry *geometry, unsigned short val_iZone);
+  
+  /*!
+	 * \brief Write a binary native SU2 restart file, each rank writes its own points with MPI-IO.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] val_iZone - iZone index.
+	 */
+  void SetRestart_Binary(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone);
+  
+  /*!
+	 * \brief Write a compressed binary SU2 restart file, the points are redistributed in blocks of consecutive
+   *        global index (one per rank) that are compressed independently and written with MPI-IO.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_filename - Name of the restart file.
+   * \param[in] Fields - Names of the fields.
+   * \param[in] Sorted_Points - Global and local index of the domain points, sorted by global index.
+   * \param[in] Buffer - Values of the sorted domain points, one row per point.
+	 */
+  void SetRestart_Compressed(CConfig *config, CGeometry *geometry, string val_filename, vector<string> &Fields,
+                             vector<pair<unsigned long, unsigned long> > &Sorted_Points, vector<passivedouble> &Buffer);
+  
+  /*!
+	 * \brief Compress a block of rows of the restart, one stream per field (quantized within the tolerance or without loss).
+   * \param[in] Rows - Values of the block, one row per point.
+   * \param[in] nRows - Number of points of the block.
+   * \param[in] nFields - Number of fields.
+   * \param[in] Tolerance - Absolute error tolerance of the fields, 0 for no loss.
+   * \param[out] Stream - Compressed bytes, appended.
+	 */
+  void Compress_Block(const passivedouble *Rows, unsigned long nRows, unsigned long nFields,
+                      const vector<passivedouble> &Tolerance, vector<unsigned char> &Stream);
+  
+  /*!
+	 * \brief Check if the restart file of a solver can be written in binary format.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+  bool GetBinary_Restart(CConfig *config);
+  
+  /*!
+	 * \brief Complete the files that are being written in the background (asynchronous output).
+   *        Collective, all the ranks call it at the same points (before the next output and at the exit).
+	 */
+  void SetAsync_Flush(void);
 
   /*!
 	 * \brief Write the x, y, & z coordinates to a CGNS output file.
@@ -316,6 +383,84 @@ public:
 	 */
 	void SetParaview_MeshASCII(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol, bool new_file);
 
+  /*!
+	 * \brief Write a Paraview XML binary solution file in parallel, every rank writes its own piece (.vtu)
+   *        of the volume or surface solution and the master node writes the index of the pieces (.pvtu).
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver - Container vector with all the solutions.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] surf_sol - Write the surface solution instead of the volume solution.
+	 */
+	void SetParaview_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol);
+  
+  /*!
+	 * \brief Write the solution in a single raw binary file with collective MPI-IO and its XDMF index (.xmf),
+   *        the time steps of an unsteady simulation are appended to the same files.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver - Container vector with all the solutions.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] surf_sol - Add the grid of the plotted surfaces to the volume grid.
+	 */
+	void SetXDMF_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol);
+  
+  /*!
+	 * \brief Local elements of the volume or of the plotted surfaces that are written by this rank in the parallel output.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] surf_sol - Elements of the plotted surfaces instead of the volume elements.
+   * \param[out] Elements - Elements written by this rank.
+	 */
+	void GetLocal_Elements(CConfig *config, CGeometry *geometry, bool surf_sol, vector<CPrimalGrid*> &Elements);
+  
+  /*!
+	 * \brief Names and values of the point data of the parallel output for a list of local points.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver - Container vector with all the solutions.
+   * \param[in] Point_List - Local points.
+   * \param[out] Fields - Names of the fields.
+   * \param[out] Values - Values of the fields, one contiguous array of the points of the list per field.
+	 */
+	void LoadLocal_PointData(CConfig *config, CGeometry *geometry, CSolver **solver, vector<unsigned long> &Point_List,
+                           vector<string> &Fields, vector<float> &Values);
+  
+  /*!
+	 * \brief Write the fast output of the flow solution: every rank appends its vertices of the selected markers
+   *        and its samples of the sampling planes to its binary stream, the master node appends the probes to the file of the run.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iExtIter - Current external (time) iteration.
+	 * \param[in] val_nZone - Total number of zones.
+	 */
+	void SetFastOutput_Files(CSolver ****solver_container, CGeometry ***geometry, CConfig **config,
+                           unsigned long iExtIter, unsigned short val_nZone);
+  
+  /*!
+	 * \brief Add a row to the timing history: wall time of the phases of the iteration (maximum over the ranks),
+   *        linear iterations, CFL number and, for the flow solvers, residuals and coefficients. The rows are
+   *        kept by the master node and written in large blocks (in the background with asynchronous output).
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iExtIter - Current external (time) iteration.
+	 * \param[in] val_nZone - Total number of zones.
+	 * \param[in] val_last - Last iteration of the run, the remaining rows are written.
+	 */
+	void SetTiming_History(CSolver ****solver_container, CConfig **config, unsigned long iExtIter,
+                         unsigned short val_nZone, bool val_last);
+  
+  /*!
+	 * \brief Find the vertices, the probes (with the ADT of the points) and the edges cut by the sampling planes of the fast output.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] val_iZone - Current zone.
+	 */
+	void SetFastOutput_Locate(CConfig *config, CGeometry *geometry, unsigned short val_iZone);
+
   /*!
 	 * \brief Write a Tecplot ASCII solution file.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -41,6 +41,7 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <set>
 #include <iostream>
 #include <stdlib.h>
 #include <stdio.h>
@@ -60,6 +61,40 @@
 
 using namespace std;
 
+/*!
+ * \class CEdgeWorkspace
+ * \brief Auxiliary vectors and matrices of the edge loops of a solver, each thread has its own set.
+ */
+class CEdgeWorkspace {
+public:
+  su2double *Residual,  /*!< \brief Auxiliary nVar vector for the residual of an edge. */
+  **Jacobian_i,         /*!< \brief Auxiliary nVar x nVar matrix for the Jacobian of point i. */
+  **Jacobian_j,         /*!< \brief Auxiliary nVar x nVar matrix for the Jacobian of point j. */
+  *Solution_i,          /*!< \brief Auxiliary nVar vector for the reconstructed solution at point i. */
+  *Solution_j,          /*!< \brief Auxiliary nVar vector for the reconstructed solution at point j. */
+  *Primitive_i,         /*!< \brief Auxiliary vector for the reconstructed primitive variables at point i. */
+  *Primitive_j,         /*!< \brief Auxiliary vector for the reconstructed primitive variables at point j. */
+  *Secondary_i,         /*!< \brief Auxiliary vector for the reconstructed secondary variables at point i. */
+  *Secondary_j,         /*!< \brief Auxiliary vector for the reconstructed secondary variables at point j. */
+  *Vector_i,            /*!< \brief Auxiliary nDim vector for the reconstruction at point i. */
+  *Vector_j;            /*!< \brief Auxiliary nDim vector for the reconstruction at point j. */
+  unsigned short nVar;  /*!< \brief Number of variables. */
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nDim - Number of dimensions of the problem.
+   * \param[in] val_nVar - Number of variables of the problem.
+   * \param[in] val_nPrimVar - Number of primitive variables.
+   * \param[in] val_nSecondaryVar - Number of secondary variables.
+   */
+  CEdgeWorkspace(unsigned short val_nDim, unsigned short val_nVar, unsigned short val_nPrimVar, unsigned short val_nSecondaryVar);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CEdgeWorkspace(void);
+};
+
 /*!
  * \class CSolver
  * \brief Main class for defining the PDE solution, it requires
@@ -117,6 +152,89 @@ protected:
 
     unsigned short nOutputVariables;  /*!< \brief Number of variables to write. */
 
+  CHaloExchange *Halo;        /*!< \brief Persistent exchange of the halo points, built on first use. */
+  CVariableStorage *Variable_Storage; /*!< \brief Contiguous storage of the variables of the points (see SetContiguous_Storage). */
+  CEdgeWorkspace **Edge_Workspace;    /*!< \brief Auxiliary vectors of the edge loops, one set per thread (see SetEdge_Loop). */
+  unsigned short nThread_Edge;        /*!< \brief Number of sets in Edge_Workspace. */
+  unsigned short Comm_Type;   /*!< \brief Quantity of the exchange in progress (MPI_QUANTITIES). */
+  bool Comm_Velocity;         /*!< \brief Variables 1 to nDim of the exchange in progress are a vector. */
+  
+  /*!
+   * \brief Number of values per point of an exchanged quantity.
+   * \param[in] commType - Quantity to be exchanged (MPI_QUANTITIES).
+   */
+  unsigned short GetnVar_Comms(unsigned short commType);
+  
+  vector<string> Restart_Fields;      /*!< \brief Names of the fields of the restart file (without the PointID). */
+  vector<passivedouble> Restart_Data; /*!< \brief Values of the restart fields at the domain points, in local order. */
+  
+  /*!
+   * \brief Sort the domain points by global index.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[out] val_sorted - Pairs of global and local index of the domain points.
+   */
+  void Sort_GlobalIndex(CGeometry *geometry, vector<pair<unsigned long, unsigned long> > &val_sorted);
+  
+  /*!
+   * \brief Read the values of the domain points from an ASCII restart file.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   * \return Number of domain points found in the file.
+   */
+  unsigned long Read_Restart_ASCII(CGeometry *geometry, CConfig *config, string val_filename);
+  
+  /*!
+   * \brief Read the values of the domain points from a binary restart file, each rank reads its own rows.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   * \return Number of domain points found in the file.
+   */
+  unsigned long Read_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename);
+  
+  /*!
+   * \brief Read the values of the domain points from a compressed restart file, the blocks of the file are
+   *        decompressed by the ranks in turn and the rows are sent to the ranks of the points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   * \return Number of domain points found in the file.
+   */
+  unsigned long Read_Restart_Compressed(CGeometry *geometry, CConfig *config, string val_filename);
+  
+  /*!
+   * \brief Decompress a block of rows of a compressed restart file (see COutput::Compress_Block).
+   * \param[in] Stream - Compressed bytes of the block.
+   * \param[in] nRows - Number of points of the block.
+   * \param[in] nFields - Number of fields.
+   * \param[in] Tolerance - Absolute error tolerance of the fields, 0 for no loss.
+   * \param[out] Rows - Values of the block, one row per point.
+   */
+  void Decompress_Block(const unsigned char *Stream, unsigned long nRows, unsigned long nFields,
+                        const vector<passivedouble> &Tolerance, passivedouble *Rows);
+  
+  /*!
+   * \brief Read a restart file (ASCII, binary or compressed, detected from the file) into Restart_Fields and Restart_Data.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   *
+   * The values of a point are the coordinates followed by the variables, as in the file.
+   */
+  void Read_Restart_File(CGeometry *geometry, CConfig *config, string val_filename);
+  
+  /*!
+   * \brief Release the memory of the restart data.
+   */
+  void Clear_Restart_Data(void);
+  
+  /*!
+   * \brief Move the arrays of the variables of all the points into contiguous storage
+   *        owned by the solver, the CVariable accessors keep working on the new storage.
+   */
+  void SetContiguous_Storage(void);
+
 public:
   
   CSysVector LinSysSol;		/*!< \brief vector to store iterative solution of implicit linear system. */
@@ -142,6 +260,82 @@ public:
 	 */
 	virtual ~CSolver(void);
      
+  /*!
+   * \brief Pack a quantity of the send points and start its exchange with the neighbors.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] commType - Quantity to be exchanged (MPI_QUANTITIES).
+   * \param[in] val_velocity - Variables 1 to nDim are a velocity (or momentum) vector, rotated across periodic boundaries.
+   *
+   * An exchange that is still in progress is completed first.
+   */
+  void InitiateComms(CGeometry *geometry, CConfig *config, unsigned short commType, bool val_velocity = false);
+  
+  /*!
+   * \brief Wait for the exchange started by InitiateComms and store the values of the halo points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CompleteComms(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Check if an exchange started by InitiateComms is still in progress.
+   */
+  bool GetComms_Pending(void);
+  
+  /*!
+   * \brief Get the edge to compute at a position of an edge loop that overlaps an exchange in progress.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_edge - Position in the edge loop.
+   * \param[in] val_overlap - Value of GetComms_Pending before the loop, otherwise the edges keep their order.
+   * \return Index of the edge. The edges without halo points come first, and the exchange is
+   *         completed before the first edge with a halo point.
+   */
+  unsigned long GetEdge_Overlap(CGeometry *geometry, CConfig *config, unsigned long val_edge, bool val_overlap);
+  
+  /*!
+   * \brief Set up an edge loop. The loop is threaded over the colors of the edge groups when the edges
+   *        are colored and the numerics have a copy for each thread, otherwise it is serial.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] numerics - Description of the numerical method of the loop.
+   * \param[in] val_nPrimVar - Number of primitive variables reconstructed in the edge loops of the solver.
+   * \param[in] val_threaded - The loop can be threaded (it does not use thread unsafe members).
+   * \return Number of threads of the loop, an exchange in progress is completed before a threaded loop.
+   */
+  unsigned short SetEdge_Loop(CGeometry *geometry, CConfig *config, CNumerics *numerics, unsigned short val_nPrimVar, bool val_threaded = true);
+  
+  /*!
+   * \brief Get the edge groups of a color of an edge loop (see SetEdge_Loop).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_nThread - Number of threads of the loop, a serial loop has one group with all the edges.
+   * \param[in] val_color - Color.
+   * \param[out] val_begin - First group.
+   * \param[out] val_end - Last group plus one.
+   */
+  void GetEdge_Groups(CGeometry *geometry, unsigned short val_nThread, unsigned short val_color, unsigned long &val_begin, unsigned long &val_end);
+  
+  /*!
+   * \brief Get the edges of a group of an edge loop (see SetEdge_Loop).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_nThread - Number of threads of the loop.
+   * \param[in] val_group - Group.
+   * \param[out] val_begin - First edge.
+   * \param[out] val_end - Last edge plus one.
+   */
+  void GetEdge_Range(CGeometry *geometry, unsigned short val_nThread, unsigned long val_group, unsigned long &val_begin, unsigned long &val_end);
+  
+  /*!
+   * \brief Compute the fluxes of the edges stored in the block of the batched numerics, add them
+   *        to the residual and the Jacobian, and empty the block.
+   * \param[in] numerics - Description of the numerical method, with a block of edges.
+   * \param[in] val_work - Auxiliary vectors of the thread.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_implicit - Add the Jacobians of the edges.
+   */
+  void SetEdge_Block_Residual(CNumerics *numerics, CEdgeWorkspace *val_work, CConfig *config, bool val_implicit);
+  
     /*!
 	 * \brief Set number of linear solver iterations.
 	 * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -3217,7 +3411,7 @@ public:
 
   virtual void VolumeProjection(CGeometry *geometry, CConfig *config, su2double steplen);
 
-  virtual void DensityFiltering(CGeometry *geometry, CConfig *config, bool updsens);
+  virtual void DensityFiltering(CGeometry *geometry, CConfig *config);
 
   virtual void GaussElimination(su2double **A, su2double *b, unsigned long nElemx);
 
@@ -3655,8 +3849,9 @@ public:
 	 * \brief Compute the extrapolated quantities, for MUSCL upwind 2nd reconstruction,
 	 * in a more thermodynamic consistent way
 	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_work - Auxiliary vectors with the reconstructed variables.
 	 */
-	void ComputeConsExtrapolation(CConfig *config);
+	void ComputeConsExtrapolation(CConfig *config, CEdgeWorkspace *val_work);
 	/*!
 	 * \brief Source term integration.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -7210,6 +7405,20 @@ private:
   su2double Emin;
   su2double penal;
 
+  passivedouble **Kab_Cache;  /*!< \brief Unscaled stiffness blocks Kab of each element, for linear elasticity. */
+  bool Kab_Cache_Active;      /*!< \brief Whether the stiffness matrix is reassembled from the cached blocks. */
+  bool Kab_Cache_Built;       /*!< \brief Whether the cached blocks are filled for the current mesh. */
+  unsigned long Kab_Cache_Coord; /*!< \brief Coordinate version of the geometry the cached blocks were computed on. */
+
+  /*!
+   * \brief Get the number of nodes and the finite element kind of an element.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iElem - Index of the element.
+   * \param[out] nNodes - Number of nodes of the element.
+   * \param[out] EL_KIND - Kind of finite element used for the element.
+   */
+  void Get_ElemKind(CGeometry *geometry, unsigned long iElem, unsigned short &nNodes, int &EL_KIND);
+
 public:
 
 	CElement*** element_container; 	/*!< \brief Vector which the define the finite element structure for each problem. */
@@ -8746,6 +8955,31 @@ private:
   su2double** Hess;
   su2double** Bess;
 
+  unsigned short LBFGS_Memory;  /*!< \brief Number of stored (s,y) pairs of the limited-memory BFGS update (0 for the dense matrix). */
+  unsigned short LBFGS_Count;   /*!< \brief Number of valid (s,y) pairs currently stored. */
+  unsigned short LBFGS_Head;    /*!< \brief Position in the circular history where the next pair is written. */
+  su2double** LBFGS_s;          /*!< \brief History of the design updates s_k. */
+  su2double** LBFGS_y;          /*!< \brief History of the gradient differences y_k. */
+  su2double* LBFGS_rho;         /*!< \brief Inverse curvature 1/(y_k^T s_k) of each stored pair. */
+  su2double* LBFGS_alpha;       /*!< \brief Auxiliary coefficients of the two-loop recursion. */
+  su2double LBFGS_Gamma;        /*!< \brief Scaling s_k^T y_k/(y_k^T y_k) of the initial inverse Hessian, from the newest pair. */
+  vector<bool> Elem_Owned;      /*!< \brief Elements owned by this rank (no halo points), each element of the mesh is counted once in the global sums. */
+
+  CSysMatrix* FilterMatrix;     /*!< \brief Helmholtz filter operator on the element dual graph (owned elements, then halo elements). */
+  CSysVector* FilterRhs;        /*!< \brief Right-hand side of the Helmholtz filter. */
+  CSysVector* FilterSol;        /*!< \brief Solution of the Helmholtz filter. */
+  su2double* FilterVolume;      /*!< \brief Volume of each element, i.e. the lumped mass of the filter. */
+  vector<long> Filter_Row;      /*!< \brief Row of each local element in the filter system, -1 if it has no owner. */
+  unsigned long Filter_nRow;    /*!< \brief Number of rows of the elements owned by this rank. */
+  bool FilterMatrix_Built;      /*!< \brief Whether the filter operator and its preconditioner are up to date. */
+  unsigned long FilterMatrix_Coord; /*!< \brief Version of the coordinates the filter operator was assembled with. */
+
+  su2double* Projection_y;      /*!< \brief Unprojected design Density + steplen*UpdateSens of the volume projection. */
+  su2double* Projection_z;      /*!< \brief Projected design for the current multiplier of the volume projection. */
+  su2double Projection_Lambda;  /*!< \brief Volume multiplier of the last projection, used to warm-start the next one. */
+  bool Projection_Warm;         /*!< \brief Whether Projection_Lambda holds a previous multiplier. */
+  su2double Projection_Volume;  /*!< \brief Number of elements of the mesh (owned elements of all ranks), computed on the first projection. */
+
 public:
 
   /*!
@@ -8979,6 +9213,20 @@ public:
 
   void BFGSUpdateProjected(CGeometry *geometry, CConfig *config, unsigned short ExtIter);
 
+  /*!
+   * \brief Set the elements owned by this rank (Elem_Owned), the partition does not change during the run.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetElem_Owned(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Apply the limited-memory inverse Hessian approximation to a vector (two-loop recursion).
+   * \param[in] nElem - Number of design variables.
+   * \param[in,out] val_vector - Vector to be multiplied, overwritten with the result.
+   */
+  void LBFGSApply(unsigned long nElem, su2double *val_vector);
+
   void UpdateMultiplier(CConfig *config);
 
   void RegisterConstraint_Func(CConfig *config, CGeometry *geometry);
@@ -9013,7 +9261,43 @@ public:
 
   void VolumeProjection(CGeometry *geometry, CConfig *config, su2double steplen);
 
-  void DensityFiltering(CGeometry *geometry, CConfig *config, bool updsens);
+  /*!
+   * \brief Project the design for a given volume multiplier and evaluate the volume constraint.
+   * \param[in] lambda - Volume multiplier.
+   * \param[in] nElem - Number of local elements (the volume is summed over the owned ones).
+   * \param[in] target - Target volume, summed over all ranks.
+   * \return Global volume of the projected design minus the target volume.
+   */
+  su2double VolumeProjection_Residual(su2double lambda, unsigned long nElem, su2double target);
+
+  void DensityFiltering(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Assemble the Helmholtz operator (eps^2*Laplacian + I) on the element dual graph
+   *        and build its preconditioner. Only needs to be repeated when the mesh changes.
+   *        Each element is a row of the rank that owns it (see CGeometry::GetHalo_Points),
+   *        the neighbors across the partition and the halo copies of the elements are
+   *        halo rows, exchanged after every product of the linear solver.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetHelmholtz_Operator(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Personalized all-to-all exchange of the records of the filter setup,
+   *        T is unsigned long or passivedouble (passive records only).
+   * \param[in] Send - Values sent to each rank.
+   * \param[out] Recv - Values received from each rank.
+   */
+  template<class T>
+  void Exchange_Filter(vector<vector<T> > &Send, vector<vector<T> > &Recv);
+
+  /*!
+   * \brief Filter the design update with the Helmholtz PDE filter on an unstructured mesh.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void HelmholtzFiltering(CGeometry *geometry, CConfig *config);
 
   void GaussElimination(su2double **A, su2double *b, unsigned long nElemx);
 
@@ -33,6 +33,8 @@
 
 inline void CSolver::SetIterLinSolver(unsigned short val_iterlinsolver) { IterLinSolver = val_iterlinsolver; }
 
+inline bool CSolver::GetComms_Pending(void) { return ((Halo != NULL) && Halo->GetComms_Pending()); }
+
 inline unsigned short CSolver::GetnSpecies(void) { return 0; }
 
 inline void CSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) { }
@@ -1397,7 +1399,7 @@ inline void CSolver::LoadOldAdjoint(){}
 
 inline void CSolver::VolumeProjection(CGeometry *geometry, CConfig *config, su2double steplen){}
 
-inline void CSolver::DensityFiltering(CGeometry *geometry, CConfig *config, bool updsens){}
+inline void CSolver::DensityFiltering(CGeometry *geometry, CConfig *config){}
 
 inline void CSolver::GaussElimination(su2double **A, su2double *b, unsigned long nElemx){}
 
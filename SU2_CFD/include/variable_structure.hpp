@@ -45,6 +45,85 @@
 
 using namespace std;
 
+/*!
+ * \class CVariableStorage
+ * \brief Contiguous storage of the variables of all the points of a solver.
+ * \version 4.2.0 "Cardinal"
+ *
+ * Each field (solution, gradient, primitive variables, ...) is one array
+ * holding the values of all the points one after the other (point-major),
+ * the block of each point is padded to a multiple of nPad values. Matrices
+ * (gradients) also get one array of row pointers for all the points, so that
+ * the CVariable accessors returning su2double** keep working.
+ */
+class CVariableStorage {
+  
+public:
+  
+  /*!
+   * \brief Fields that can be stored contiguously.
+   */
+  enum ENUM_VAR_FIELD {
+    SOLUTION = 0, SOLUTION_OLD, SOLUTION_STORE, SOLUTION_SAVE, SOLUTION_TIME_N, SOLUTION_TIME_N1,
+    GRADIENT, LIMITER, SOLUTION_MAX, SOLUTION_MIN, RES_TRUNC_ERROR, RESIDUAL_OLD, RESIDUAL_SUM,
+    UNDIVIDED_LAPLACIAN, PRIMITIVE, GRADIENT_PRIMITIVE, LIMITER_PRIMITIVE,
+    SECONDARY, GRADIENT_SECONDARY, LIMITER_SECONDARY,
+    N_VAR_FIELD
+  };
+  
+private:
+  
+  unsigned long nPoint;                 /*!< \brief Number of points of the solver. */
+  unsigned short nPad;                  /*!< \brief The block of each point is padded to a multiple of nPad values. */
+  su2double *Field[N_VAR_FIELD];        /*!< \brief Values of each field. */
+  su2double **Row[N_VAR_FIELD];         /*!< \brief Row pointers of the matrix fields. */
+  unsigned long Size[N_VAR_FIELD];      /*!< \brief Number of values of a point (before padding). */
+  unsigned long Stride[N_VAR_FIELD];    /*!< \brief Distance between the blocks of two consecutive points. */
+  unsigned short nRow[N_VAR_FIELD];     /*!< \brief Number of rows of the matrix fields. */
+  
+  /*!
+   * \brief Allocate a field on first use, and check the size on the next uses.
+   */
+  void Allocate(unsigned short val_field, unsigned long val_size, unsigned short val_nrow);
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_npoint - Number of points of the solver.
+   * \param[in] val_npad - The block of each point is padded to a multiple of val_npad values (1 for no padding).
+   */
+  CVariableStorage(unsigned long val_npoint, unsigned short val_npad);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CVariableStorage(void);
+  
+  /*!
+   * \brief Move a vector of a point into the field, the vector is deleted.
+   * \param[in] val_field - Field (ENUM_VAR_FIELD).
+   * \param[in] val_point - Point.
+   * \param[in] val_vector - Vector to move, NULL if the field is not used.
+   * \param[in] val_size - Size of the vector.
+   * \return Location of the vector in the field (NULL if val_vector is NULL).
+   */
+  su2double *MoveVector(unsigned short val_field, unsigned long val_point, su2double *val_vector, unsigned short val_size);
+  
+  /*!
+   * \brief Move a matrix of a point into the field, the rows and the row pointers are deleted.
+   * \param[in] val_field - Field (ENUM_VAR_FIELD).
+   * \param[in] val_point - Point.
+   * \param[in] val_matrix - Matrix to move, NULL if the field is not used.
+   * \param[in] val_nrow - Number of rows.
+   * \param[in] val_ncol - Number of columns.
+   * \return Row pointers of the matrix in the field (NULL if val_matrix is NULL).
+   */
+  su2double **MoveMatrix(unsigned short val_field, unsigned long val_point, su2double **val_matrix,
+                         unsigned short val_nrow, unsigned short val_ncol);
+  
+};
+
 /*! 
  * \class CVariable
  * \brief Main class for defining the variables.
@@ -88,6 +167,7 @@ protected:
                                              note that this variable cannnot be static, it is possible to
                                              have different number of nVar in the same problem. */
   su2double *Solution_Adj_Old;    /*!< \brief Solution of the problem. */
+  bool Contiguous;                /*!< \brief The arrays moved by SetContiguous_Storage belong to a CVariableStorage. */
 
   
 public:
@@ -117,6 +197,13 @@ public:
 	 */
 	virtual ~CVariable(void);
 
+  /*!
+	 * \brief Move the arrays of the point into contiguous storage shared by all the points of the solver.
+	 * \param[in] storage - Contiguous storage of the solver.
+	 * \param[in] val_point - Index of the point.
+	 */
+	virtual void SetContiguous_Storage(CVariableStorage *storage, unsigned long val_point);
+
 	/*!
 	 * \brief Set the value of the solution.
 	 * \param[in] val_solution - Solution of the problem.
@@ -3300,6 +3387,13 @@ public:
 	 */		
 	virtual ~CEulerVariable(void);
 
+  /*!
+	 * \brief Move the arrays of the point, including the primitive variables, into contiguous storage.
+	 * \param[in] storage - Contiguous storage of the solver.
+	 * \param[in] val_point - Index of the point.
+	 */
+	void SetContiguous_Storage(CVariableStorage *storage, unsigned long val_point);
+
 	/*!
 	 * \brief Set to zero the gradient of the primitive variables.
 	 */
@@ -3956,6 +4050,13 @@ public:
 	 */
 	virtual ~CTurbVariable(void);
 
+  /*!
+	 * \brief Move the arrays of the point, including the limiter bounds, into contiguous storage.
+	 * \param[in] storage - Contiguous storage of the solver.
+	 * \param[in] val_point - Index of the point.
+	 */
+	void SetContiguous_Storage(CVariableStorage *storage, unsigned long val_point);
+
 	/*!
 	 * \brief Get the value of the eddy viscosity.
 	 * \return the value of the eddy viscosity.
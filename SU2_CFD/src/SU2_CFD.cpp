@@ -335,6 +335,10 @@ int main(int argc, char *argv[]) {
     historyFile_FSI.close();
   }
   
+  /*--- The timing history measures the iterations from here ---*/
+  
+  for (iZone = 0; iZone < nZone; iZone++) config_container[iZone]->Reset_Phase_Time();
+  
   while (ExtIter < config_container[ZONE_0]->GetnExtIter()) {
     
     /*--- Set the value of the external iteration. ---*/
@@ -374,6 +378,8 @@ int main(int argc, char *argv[]) {
     
     UsedTime = (StopTime - StartTime);
     
+    unsigned short Previous_Phase = config_container[ZONE_0]->Start_Phase(PHASE_OUTPUT);
+    
     /*--- For specific applications, evaluate and plot the equivalent area. ---*/
     
     if (config_container[ZONE_0]->GetEquivArea() == YES) {
@@ -397,6 +403,14 @@ int main(int argc, char *argv[]) {
       
     }
     
+    /*--- Write the fast output (surface stream, probes and sampling planes),
+     without merging the solution in the master node. ---*/
+    
+    if (config_container[ZONE_0]->GetFastOutput() &&
+        (ExtIter % config_container[ZONE_0]->GetFastOutput_Freq() == 0)) {
+      output->SetFastOutput_Files(solver_container, geometry_container, config_container, ExtIter, nZone);
+    }
+    
     
     /*--- Evaluate the new CFL number (adaptive). ---*/
     
@@ -500,6 +514,15 @@ int main(int argc, char *argv[]) {
       
     }
     
+    /*--- Add the iteration to the timing history. ---*/
+    
+    if (config_container[ZONE_0]->GetWrt_Timing_History()) {
+      output->SetTiming_History(solver_container, config_container, ExtIter, nZone,
+                                (StopCalc || (ExtIter+1 >= config_container[ZONE_0]->GetnExtIter())));
+    }
+    
+    config_container[ZONE_0]->Stop_Phase(Previous_Phase);
+    
     /*--- If the convergence criteria has been met, terminate the simulation. ---*/
     if (StopCalc) break;
     
@@ -507,6 +530,10 @@ int main(int argc, char *argv[]) {
     
   }
   
+  /*--- Complete the output files still being written in the background. ---*/
+  
+  output->SetAsync_Flush();
+  
   /*--- Output some information to the console. ---*/
   
   if (rank == MASTER_NODE) {
@@ -119,6 +119,17 @@ unsigned short GetnDim(string val_mesh_filename, unsigned short val_format) {
       }
       break;
       
+    case SU2_BINARY:
+      
+      /*--- The dimension is the first entry of the header, after the file tag ---*/
+      
+      unsigned long header[CSU2BinaryMesh::HEADER_SIZE];
+      char file_tag[8];
+      mesh_file.read(file_tag, 8);
+      mesh_file.read((char*)header, sizeof(header));
+      if (mesh_file.good()) nDim = header[CSU2BinaryMesh::HEADER_NDIM];
+      break;
+      
     case CGNS:
       
 #ifdef HAVE_CGNS
@@ -309,10 +320,18 @@ void Geometrical_Preprocessing(CGeometry ***geometry, CConfig **config, unsigned
     if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
     geometry[iZone][MESH_0]->SetPoint_Connectivity();
     
-    /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+    /*--- Renumbering points using Reverse Cuthill McKee ordering or
+     a Hilbert space-filling curve. The edges are numbered afterwards
+     by increasing first node (SetEdges), so they follow the new order ---*/
     
-    if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-    geometry[iZone][MESH_0]->SetRCM_Ordering(config[iZone]);
+    if (config[iZone]->GetKind_Point_Ordering() == RCM_ORDERING) {
+      if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+      geometry[iZone][MESH_0]->SetRCM_Ordering(config[iZone]);
+    }
+    if (config[iZone]->GetKind_Point_Ordering() == HILBERT_ORDERING) {
+      if (rank == MASTER_NODE) cout << "Renumbering points (Hilbert curve Ordering)." << endl;
+      geometry[iZone][MESH_0]->SetHilbert_Ordering(config[iZone]);
+    }
     
     /*--- recompute elements surrounding points, points surrounding points ---*/
     
@@ -369,6 +388,17 @@ void Geometrical_Preprocessing(CGeometry ***geometry, CConfig **config, unsigned
     if (rank == MASTER_NODE) cout << "Checking for periodicity." << endl;
     geometry[iZone][MESH_0]->Check_Periodicity(config[iZone]);
     
+    /*--- Store the point and edge data of the dual grid contiguously ---*/
+    
+    geometry[iZone][MESH_0]->SetContiguous_Storage(config[iZone]);
+    
+    /*--- Color the edges for the threaded edge loops ---*/
+    
+    if (config[iZone]->GetEdge_Coloring()) {
+      if (rank == MASTER_NODE) cout << "Coloring the edges." << endl;
+      geometry[iZone][MESH_0]->SetEdge_Coloring(config[iZone]);
+    }
+    
     if ((config[iZone]->GetnMGLevels() != 0) && (rank == MASTER_NODE))
       cout << "Setting the multigrid structure." << endl;
     
@@ -414,6 +444,14 @@ void Geometrical_Preprocessing(CGeometry ***geometry, CConfig **config, unsigned
         delete geometry[iZone][iMGlevel];
         break;
       } 
+      
+      /*--- Store the point and edge data of the dual grid contiguously ---*/
+      
+      geometry[iZone][iMGlevel]->SetContiguous_Storage(config[iZone]);
+      
+      if (config[iZone]->GetEdge_Coloring())
+        geometry[iZone][iMGlevel]->SetEdge_Coloring(config[iZone]);
+      
     }
     
   }
@@ -118,6 +118,12 @@ CDriver::CDriver(CIteration **iteration_container,
     Numerics_Preprocessing(numerics_container[iZone], solver_container[iZone],
                            geometry_container[iZone], config_container[iZone]);
     
+    /*--- Copies of the edge numerics for the threads of the colored edge loops ---*/
+    
+    if (config_container[iZone]->GetEdge_Coloring())
+      Numerics_Thread_Preprocessing(numerics_container[iZone], solver_container[iZone],
+                                    geometry_container[iZone], config_container[iZone]);
+    
     if (rank == MASTER_NODE) cout << "Numerics Preprocessing." << endl;
     
   }
@@ -1384,6 +1390,85 @@ void CDriver::Numerics_Preprocessing(CNumerics ****numerics_container,
 }
 
 
+void CDriver::Numerics_Thread_Preprocessing(CNumerics ****numerics_container,
+                                            CSolver ***solver_container, CGeometry **geometry,
+                                            CConfig *config) {
+  
+  unsigned short iMGlevel, iSol, iTerm, iThread, nSol = 0, nThread = 1;
+  unsigned short Sol[2] = {FLOW_SOL, TURB_SOL}, Term[2] = {CONV_TERM, VISC_TERM};
+  CNumerics ****numerics_thread, *****numerics_copy;
+  bool complete;
+  
+#ifdef HAVE_OMP
+  nThread = omp_get_max_threads();
+#endif
+  
+  /*--- Solvers with threaded edge loops ---*/
+  
+  switch (config->GetKind_Solver()) {
+    case EULER : case NAVIER_STOKES: case ADJ_EULER : nSol = 1; break;
+    case RANS : case ADJ_RANS : nSol = 2; break;
+    case ADJ_NAVIER_STOKES : nSol = (config->GetKind_Turb_Model() != NONE) ? 2 : 1; break;
+  }
+  
+  if ((nThread == 1) || (nSol == 0)) return;
+  
+  numerics_copy = new CNumerics****[config->GetnMGLevels()+1];
+  for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+    numerics_copy[iMGlevel] = new CNumerics***[nSol];
+    for (iSol = 0; iSol < nSol; iSol++) {
+      numerics_copy[iMGlevel][iSol] = new CNumerics**[2];
+      for (iTerm = 0; iTerm < 2; iTerm++)
+        numerics_copy[iMGlevel][iSol][iTerm] = new CNumerics*[nThread];
+    }
+  }
+  
+  /*--- A complete set of numerics for each thread, the edge numerics are
+   kept and the rest of the set is deleted ---*/
+  
+  for (iThread = 1; iThread < nThread; iThread++) {
+    
+    numerics_thread = new CNumerics***[config->GetnMGLevels()+1];
+    Numerics_Preprocessing(numerics_thread, solver_container, geometry, config);
+    
+    for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
+      for (iSol = 0; iSol < nSol; iSol++)
+        for (iTerm = 0; iTerm < 2; iTerm++) {
+          numerics_copy[iMGlevel][iSol][iTerm][iThread] = numerics_thread[iMGlevel][Sol[iSol]][Term[iTerm]];
+          numerics_thread[iMGlevel][Sol[iSol]][Term[iTerm]] = NULL;
+        }
+    
+    Numerics_Postprocessing(numerics_thread, solver_container, geometry, config);
+    delete [] numerics_thread;
+    
+  }
+  
+  /*--- The numerics of the master thread own the copies. Some terms are not allocated
+   (e.g. NO_CENTERED or a turbulent convective scheme NONE), those are skipped and their
+   edge loops use the serial path, since they have no copies for the threads ---*/
+  
+  for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+    for (iSol = 0; iSol < nSol; iSol++) {
+      for (iTerm = 0; iTerm < 2; iTerm++) {
+        complete = (numerics_container[iMGlevel][Sol[iSol]][Term[iTerm]] != NULL);
+        for (iThread = 1; iThread < nThread; iThread++)
+          if (numerics_copy[iMGlevel][iSol][iTerm][iThread] == NULL) complete = false;
+        if (complete)
+          numerics_container[iMGlevel][Sol[iSol]][Term[iTerm]]->SetThread_Numerics(nThread, numerics_copy[iMGlevel][iSol][iTerm]);
+        else {
+          for (iThread = 1; iThread < nThread; iThread++)
+            if (numerics_copy[iMGlevel][iSol][iTerm][iThread] != NULL) delete numerics_copy[iMGlevel][iSol][iTerm][iThread];
+          delete [] numerics_copy[iMGlevel][iSol][iTerm];
+        }
+      }
+      delete [] numerics_copy[iMGlevel][iSol];
+    }
+    delete [] numerics_copy[iMGlevel];
+  }
+  delete [] numerics_copy;
+  
+}
+
 void CDriver::Numerics_Postprocessing(CNumerics ****numerics_container,
                                       CSolver ***solver_container, CGeometry **geometry,
                                       CConfig *config) {
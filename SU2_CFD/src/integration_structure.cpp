@@ -54,7 +54,7 @@ void CIntegration::Space_Integration(CGeometry *geometry,
                                      CConfig *config, unsigned short iMesh,
                                      unsigned short iRKStep,
                                      unsigned short RunTime_EqSystem) {
-  unsigned short iMarker;
+  unsigned short iMarker, Previous_Phase;
   
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
@@ -62,6 +62,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   
   /*--- Compute inviscid residuals ---*/
   
+  Previous_Phase = config->Start_Phase(PHASE_CONVECTIVE);
+  
   switch (config->GetKind_ConvNumScheme()) {
     case SPACE_CENTERED:
       solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh, iRKStep);
@@ -74,13 +76,19 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   
   /*--- Compute viscous residuals ---*/
   
+  config->Start_Phase(PHASE_VISCOUS);
+  
   solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics[VISC_TERM], config, iMesh, iRKStep);
   
   
   /*--- Compute source term residuals ---*/
   
+  config->Start_Phase(PHASE_SOURCE);
+  
   solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics[SOURCE_FIRST_TERM], numerics[SOURCE_SECOND_TERM], config, iMesh);
   
+  config->Stop_Phase(Previous_Phase);
+  
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
   
   if (dual_time)
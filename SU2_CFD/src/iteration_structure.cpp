@@ -3861,7 +3861,7 @@ void TopologyOptimization::OneShot(COutput *output, CIntegration ***integration_
 
         //perform a filtering step of the update (once) and a projection onto the feasible set in each line search step
         if(whilecounter==1){
-          solver_container[val_iZone][MESH_0][ADJFLOW_SOL]->DensityFiltering(geometry_container[val_iZone][MESH_0], config_container[ZONE_0], true);
+          solver_container[val_iZone][MESH_0][ADJFLOW_SOL]->DensityFiltering(geometry_container[val_iZone][MESH_0], config_container[ZONE_0]);
           solver_container[val_iZone][MESH_0][ADJFLOW_SOL]->VolumeProjection(geometry_container[val_iZone][MESH_0], config_container[ZONE_0], steplen);
         }
         else{
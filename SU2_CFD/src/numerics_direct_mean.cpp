@@ -54,6 +54,11 @@ CCentJST_Flow::CCentJST_Flow(unsigned short val_nDim, unsigned short val_nVar, C
   MeanVelocity = new su2double [nDim];
   ProjFlux = new su2double [nVar];
   
+  /*--- Block of edges for the batched residual (not with grid movement) ---*/
+  
+  if (config->GetEdge_Block_Numerics() && !grid_movement)
+    Block = new CEdgeBlock(true);
+  
 }
 
 CCentJST_Flow::~CCentJST_Flow(void) {
@@ -226,6 +231,111 @@ void CCentJST_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
   AD::EndPreacc();
 }
 
+void CCentJST_Flow::ComputeResidual_Block(CConfig *config) {
+  
+  unsigned short k, nEdge = Block->nEdge;
+  su2double *rho_i = Block->V_i[nDim+2], *rho_j = Block->V_j[nDim+2],
+  *p_i = Block->V_i[nDim+1], *p_j = Block->V_j[nDim+1],
+  *h_i = Block->V_i[nDim+3], *h_j = Block->V_j[nDim+3],
+  *c_i = Block->V_i[nDim+4], *c_j = Block->V_j[nDim+4],
+  (*vel_i)[EDGE_BLOCK_SIZE] = &Block->V_i[1], (*vel_j)[EDGE_BLOCK_SIZE] = &Block->V_j[1],
+  (*normal)[EDGE_BLOCK_SIZE] = Block->Normal;
+  su2double mean_rho[EDGE_BLOCK_SIZE], mean_p[EDGE_BLOCK_SIZE], mean_h[EDGE_BLOCK_SIZE], mean_e[EDGE_BLOCK_SIZE],
+  mean_vel[3][EDGE_BLOCK_SIZE], diff_u[5][EDGE_BLOCK_SIZE], sqvel_i[EDGE_BLOCK_SIZE], sqvel_j[EDGE_BLOCK_SIZE],
+  projvel_i[EDGE_BLOCK_SIZE], projvel_j[EDGE_BLOCK_SIZE], area[EDGE_BLOCK_SIZE], eps_2[EDGE_BLOCK_SIZE],
+  eps_4[EDGE_BLOCK_SIZE], scale[EDGE_BLOCK_SIZE], e_i, e_j, mean_lambda, phi_i, phi_j, sc_2, cte_0, cte_1;
+  
+  /*--- Mean values of the primitive variables, energy, and differences of the
+   conservative variables (with a correction for the enthalpy). The loops over
+   the edges are the inner ones, so that they can be vectorized ---*/
+  
+  for (k = 0; k < nEdge; k++) {
+    e_i = h_i[k] - p_i[k]/rho_i[k];
+    e_j = h_j[k] - p_j[k]/rho_j[k];
+    mean_rho[k] = 0.5*(rho_i[k]+rho_j[k]);
+    mean_p[k] = 0.5*(p_i[k]+p_j[k]);
+    mean_h[k] = 0.5*(h_i[k]+h_j[k]);
+    mean_e[k] = 0.5*(e_i+e_j);
+    diff_u[0][k] = rho_i[k]-rho_j[k];
+    diff_u[nVar-1][k] = rho_i[k]*h_i[k]-rho_j[k]*h_j[k];
+    sqvel_i[k] = 0.0; sqvel_j[k] = 0.0;
+    projvel_i[k] = 0.0; projvel_j[k] = 0.0; area[k] = 0.0;
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (k = 0; k < nEdge; k++) {
+      mean_vel[iDim][k] = 0.5*(vel_i[iDim][k]+vel_j[iDim][k]);
+      diff_u[iDim+1][k] = rho_i[k]*vel_i[iDim][k]-rho_j[k]*vel_j[iDim][k];
+      sqvel_i[k] += 0.5*vel_i[iDim][k]*vel_i[iDim][k];
+      sqvel_j[k] += 0.5*vel_j[iDim][k]*vel_j[iDim][k];
+      projvel_i[k] += vel_i[iDim][k]*normal[iDim][k];
+      projvel_j[k] += vel_j[iDim][k]*normal[iDim][k];
+      area[k] += normal[iDim][k]*normal[iDim][k];
+    }
+  }
+  
+  /*--- Residual and Jacobians of the inviscid flux, scale = 0.5 because val_residual ~ 0.5*(fc_i+fc_j)*Normal ---*/
+  
+  GetInviscidProjFlux_Block(nEdge, mean_rho, mean_vel, mean_p, mean_h, normal, Block->Residual);
+  
+  if (implicit) {
+    GetInviscidProjJac_Block(nEdge, mean_vel, mean_e, normal, 0.5, Block->Jacobian_i);
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
+        for (k = 0; k < nEdge; k++)
+          Block->Jacobian_j[iVar][jVar][k] = Block->Jacobian_i[iVar][jVar][k];
+  }
+  
+  /*--- Local spectral radius, stretching factor, and dissipation coefficients ---*/
+  
+  for (k = 0; k < nEdge; k++) {
+    area[k] = sqrt(area[k]);
+    mean_lambda = 0.5*(fabs(projvel_i[k])+c_i[k]*area[k] + fabs(projvel_j[k])+c_j[k]*area[k]);
+    phi_i = pow(Block->Lambda_i[k]/(4.0*mean_lambda), Param_p);
+    phi_j = pow(Block->Lambda_j[k]/(4.0*mean_lambda), Param_p);
+    scale[k] = 4.0*phi_i*phi_j/(phi_i+phi_j)*mean_lambda;
+    sc_2 = 3.0*(Block->Neighbor_i[k]+Block->Neighbor_j[k])/(Block->Neighbor_i[k]*Block->Neighbor_j[k]);
+    eps_2[k] = Param_Kappa_2*0.5*(Block->Sensor_i[k]+Block->Sensor_j[k])*sc_2;
+    eps_4[k] = max(0.0, Param_Kappa_4-eps_2[k])*sc_2*sc_2/4.0;
+  }
+  
+  /*--- Artificial dissipation part of the residual ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (k = 0; k < nEdge; k++)
+      Block->Residual[iVar][k] += (eps_2[k]*diff_u[iVar][k] - eps_4[k]*(Block->Und_Lapl_i[iVar][k]-Block->Und_Lapl_j[iVar][k]))*scale[k];
+  
+  /*--- Jacobian computation ---*/
+  
+  if (implicit) {
+    
+    for (k = 0; k < nEdge; k++) {
+      
+      cte_0 = (eps_2[k] + eps_4[k]*(Block->Neighbor_i[k]+1.0))*scale[k];
+      cte_1 = (eps_2[k] + eps_4[k]*(Block->Neighbor_j[k]+1.0))*scale[k];
+      
+      for (iVar = 0; iVar < (nVar-1); iVar++) {
+        Block->Jacobian_i[iVar][iVar][k] += cte_0;
+        Block->Jacobian_j[iVar][iVar][k] -= cte_1;
+      }
+      
+      /*--- Last rows of Jacobian_i and Jacobian_j ---*/
+      
+      Block->Jacobian_i[nVar-1][0][k] += cte_0*Gamma_Minus_One*sqvel_i[k];
+      Block->Jacobian_j[nVar-1][0][k] -= cte_1*Gamma_Minus_One*sqvel_j[k];
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Block->Jacobian_i[nVar-1][iDim+1][k] -= cte_0*Gamma_Minus_One*vel_i[iDim][k];
+        Block->Jacobian_j[nVar-1][iDim+1][k] += cte_1*Gamma_Minus_One*vel_j[iDim][k];
+      }
+      Block->Jacobian_i[nVar-1][nVar-1][k] += cte_0*Gamma;
+      Block->Jacobian_j[nVar-1][nVar-1][k] -= cte_1*Gamma;
+      
+    }
+    
+  }
+  
+}
+
 CCentJST_KE_Flow::CCentJST_KE_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -2358,6 +2468,11 @@ CUpwRoe_Flow::CUpwRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CCo
     P_Tensor[iVar] = new su2double [nVar];
     invP_Tensor[iVar] = new su2double [nVar];
   }
+  
+  /*--- Block of edges for the batched residual (not with grid movement) ---*/
+  
+  if (config->GetEdge_Block_Numerics() && !grid_movement)
+    Block = new CEdgeBlock(false);
 }
 
 CUpwRoe_Flow::~CUpwRoe_Flow(void) {
@@ -2618,6 +2733,168 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
 
 }
 
+void CUpwRoe_Flow::ComputeResidual_Block(CConfig *config) {
+  
+  unsigned short k, nEdge = Block->nEdge;
+  su2double *rho_i = Block->V_i[nDim+2], *rho_j = Block->V_j[nDim+2],
+  *p_i = Block->V_i[nDim+1], *p_j = Block->V_j[nDim+1],
+  *h_i = Block->V_i[nDim+3], *h_j = Block->V_j[nDim+3],
+  (*vel_i)[EDGE_BLOCK_SIZE] = &Block->V_i[1], (*vel_j)[EDGE_BLOCK_SIZE] = &Block->V_j[1],
+  (*normal)[EDGE_BLOCK_SIZE] = Block->Normal;
+  su2double area[EDGE_BLOCK_SIZE], unit_normal[3][EDGE_BLOCK_SIZE], roe_rho[EDGE_BLOCK_SIZE], roe_vel[3][EDGE_BLOCK_SIZE],
+  roe_h[EDGE_BLOCK_SIZE], roe_c[EDGE_BLOCK_SIZE], roe_c2[EDGE_BLOCK_SIZE], r[EDGE_BLOCK_SIZE], projvel[EDGE_BLOCK_SIZE],
+  lambda[5][EDGE_BLOCK_SIZE], flux_i[5][EDGE_BLOCK_SIZE], flux_j[5][EDGE_BLOCK_SIZE], p_tensor[5][5][EDGE_BLOCK_SIZE],
+  invp_tensor[5][5][EDGE_BLOCK_SIZE], diff[5][EDGE_BLOCK_SIZE], e_i[EDGE_BLOCK_SIZE], e_j[EDGE_BLOCK_SIZE],
+  mod_jac[EDGE_BLOCK_SIZE], delta_p, delta_c, delta_entropy = config->GetEntropyFix_Coeff();
+  
+  /*--- Face area, Roe-averaged variables and the squared Roe sound speed. The
+   loops over the edges are the inner ones, so that they can be vectorized ---*/
+  
+  for (k = 0; k < nEdge; k++) {
+    area[k] = 0.0; roe_c2[k] = 0.0; projvel[k] = 0.0;
+    r[k] = sqrt(fabs(rho_j[k]/rho_i[k]));
+    roe_rho[k] = r[k]*rho_i[k];
+    roe_h[k] = (r[k]*h_j[k]+h_i[k])/(r[k]+1);
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (k = 0; k < nEdge; k++) {
+      area[k] += normal[iDim][k]*normal[iDim][k];
+      roe_vel[iDim][k] = (r[k]*vel_j[iDim][k]+vel_i[iDim][k])/(r[k]+1);
+      roe_c2[k] += roe_vel[iDim][k]*roe_vel[iDim][k];
+    }
+  for (k = 0; k < nEdge; k++) {
+    area[k] = sqrt(area[k]);
+    roe_c2[k] = (Gamma-1)*(roe_h[k]-0.5*roe_c2[k]);
+    
+    /*--- Negative RoeSoundSpeed2, the fluxes of the edge are set to zero below ---*/
+    
+    roe_c[k] = sqrt(fabs(roe_c2[k]));
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (k = 0; k < nEdge; k++) {
+      unit_normal[iDim][k] = normal[iDim][k]/area[k];
+      projvel[k] += roe_vel[iDim][k]*unit_normal[iDim][k];
+    }
+  
+  /*--- Projected fluxes and the P matrix (do it with the unit normal) ---*/
+  
+  GetInviscidProjFlux_Block(nEdge, rho_i, vel_i, p_i, h_i, normal, flux_i);
+  GetInviscidProjFlux_Block(nEdge, rho_j, vel_j, p_j, h_j, normal, flux_j);
+  GetPMatrix_Block(nEdge, roe_rho, roe_vel, roe_c, unit_normal, p_tensor);
+  
+  /*--- Flow eigenvalues, absolute value with Mavriplis' entropy correction ---*/
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (k = 0; k < nEdge; k++)
+      lambda[iDim][k] = fabs(projvel[k]);
+  for (k = 0; k < nEdge; k++) {
+    lambda[nVar-2][k] = fabs(projvel[k] + roe_c[k]);
+    lambda[nVar-1][k] = fabs(projvel[k] - roe_c[k]);
+  }
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (k = 0; k < nEdge; k++)
+      lambda[iVar][k] = max(lambda[iVar][k], delta_entropy*(fabs(projvel[k]) + roe_c[k]));
+  
+  if (!implicit) {
+    
+    /*--- Wave amplitudes (characteristics), stored in diff ---*/
+    
+    for (k = 0; k < nEdge; k++) {
+      delta_p = p_j[k] - p_i[k];
+      diff[0][k] = (rho_j[k] - rho_i[k]) - delta_p/(roe_c[k]*roe_c[k]);
+      diff[nVar-2][k] = delta_p/(roe_rho[k]*roe_c[k]);
+      diff[nVar-1][k] = delta_p/(roe_rho[k]*roe_c[k]);
+    }
+    for (iDim = 0; iDim < nDim; iDim++)
+      for (k = 0; k < nEdge; k++) {
+        delta_c = (vel_j[iDim][k] - vel_i[iDim][k])*unit_normal[iDim][k];
+        diff[nVar-2][k] += delta_c;
+        diff[nVar-1][k] -= delta_c;
+      }
+    if (nDim == 2) {
+      for (k = 0; k < nEdge; k++)
+        diff[1][k] = unit_normal[1][k]*(vel_j[0][k]-vel_i[0][k])-unit_normal[0][k]*(vel_j[1][k]-vel_i[1][k]);
+    }
+    else {
+      for (k = 0; k < nEdge; k++) {
+        diff[1][k] = unit_normal[0][k]*(vel_j[2][k]-vel_i[2][k])-unit_normal[2][k]*(vel_j[0][k]-vel_i[0][k]);
+        diff[2][k] = unit_normal[1][k]*(vel_j[0][k]-vel_i[0][k])-unit_normal[0][k]*(vel_j[1][k]-vel_i[1][k]);
+      }
+    }
+    
+    /*--- Roe's Flux approximation ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (k = 0; k < nEdge; k++)
+        Block->Residual[iVar][k] = 0.5*(flux_i[iVar][k]+flux_j[iVar][k]);
+      for (jVar = 0; jVar < nVar; jVar++)
+        for (k = 0; k < nEdge; k++)
+          Block->Residual[iVar][k] -= 0.5*lambda[jVar][k]*diff[jVar][k]*p_tensor[iVar][jVar][k]*area[k];
+    }
+    
+  }
+  
+  else {
+    
+    /*--- Inverse P, and Jacobians of the inviscid flux scaled by kappa ---*/
+    
+    GetPMatrix_inv_Block(nEdge, roe_rho, roe_vel, roe_c, unit_normal, invp_tensor);
+    
+    for (k = 0; k < nEdge; k++) {
+      e_i[k] = h_i[k] - p_i[k]/rho_i[k];
+      e_j[k] = h_j[k] - p_j[k]/rho_j[k];
+    }
+    GetInviscidProjJac_Block(nEdge, vel_i, e_i, normal, kappa, Block->Jacobian_i);
+    GetInviscidProjJac_Block(nEdge, vel_j, e_j, normal, kappa, Block->Jacobian_j);
+    
+    /*--- Difference of the conservative variables ---*/
+    
+    for (k = 0; k < nEdge; k++) {
+      diff[0][k] = rho_j[k]-rho_i[k];
+      diff[nVar-1][k] = rho_j[k]*e_j[k]-rho_i[k]*e_i[k];
+    }
+    for (iDim = 0; iDim < nDim; iDim++)
+      for (k = 0; k < nEdge; k++)
+        diff[iDim+1][k] = rho_j[k]*vel_j[iDim][k]-rho_i[k]*vel_i[iDim][k];
+    
+    /*--- Roe's Flux approximation, |Proj_ModJac_Tensor| = P x |Lambda| x inverse P ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (k = 0; k < nEdge; k++)
+        Block->Residual[iVar][k] = kappa*(flux_i[iVar][k]+flux_j[iVar][k]);
+      for (jVar = 0; jVar < nVar; jVar++) {
+        for (k = 0; k < nEdge; k++)
+          mod_jac[k] = 0.0;
+        for (kVar = 0; kVar < nVar; kVar++)
+          for (k = 0; k < nEdge; k++)
+            mod_jac[k] += p_tensor[iVar][kVar][k]*lambda[kVar][k]*invp_tensor[kVar][jVar][k];
+        for (k = 0; k < nEdge; k++) {
+          mod_jac[k] *= (1.0-kappa)*area[k];
+          Block->Residual[iVar][k] -= mod_jac[k]*diff[jVar][k];
+          Block->Jacobian_i[iVar][jVar][k] += mod_jac[k];
+          Block->Jacobian_j[iVar][jVar][k] -= mod_jac[k];
+        }
+      }
+    }
+    
+  }
+  
+  /*--- Negative RoeSoundSpeed2, the jump variables are too large, no fluxes ---*/
+  
+  for (k = 0; k < nEdge; k++) {
+    if (roe_c2[k] <= 0.0) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Block->Residual[iVar][k] = 0.0;
+        for (jVar = 0; jVar < nVar; jVar++) {
+          Block->Jacobian_i[iVar][jVar][k] = 0.0;
+          Block->Jacobian_j[iVar][jVar][k] = 0.0;
+        }
+      }
+    }
+  }
+  
+}
+
 
 CUpwGeneralRoe_Flow::CUpwGeneralRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
@@ -55,6 +55,10 @@ CNumerics::CNumerics(void) {
 
   l = NULL;
   m = NULL;
+  
+  nThread = 1;
+  Thread_Numerics = NULL;
+  Block = NULL;
 
 }
 
@@ -85,6 +89,10 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
 
   l = NULL;
   m = NULL;
+  
+  nThread = 1;
+  Thread_Numerics = NULL;
+  Block = NULL;
  
 	nDim = val_nDim;
 	nVar = val_nVar;
@@ -177,6 +185,61 @@ CNumerics::~CNumerics(void) {
   if (l != NULL) delete [] l;
   if (m != NULL) delete [] m;
 
+  if (Thread_Numerics != NULL) {
+    for (unsigned short iThread = 1; iThread < nThread; iThread++)
+      delete Thread_Numerics[iThread];
+    delete [] Thread_Numerics;
+  }
+  
+  if (Block != NULL) delete Block;
+
+}
+
+void CNumerics::SetThread_Numerics(unsigned short val_nThread, CNumerics **val_numerics) {
+  
+  nThread = val_nThread;
+  Thread_Numerics = val_numerics;
+  Thread_Numerics[0] = this;
+  
+}
+
+CEdgeBlock::CEdgeBlock(bool val_dissipation) {
+  
+  nEdge = 0;
+  Dissipation = val_dissipation;
+  
+}
+
+bool CNumerics::AddEdge_Block(unsigned long val_iPoint, unsigned long val_jPoint) {
+  
+  unsigned short iDim, iVar, k = Block->nEdge;
+  
+  Block->Point_i[k] = val_iPoint; Block->Point_j[k] = val_jPoint;
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+    Block->Normal[iDim][k] = Normal[iDim];
+  
+  for (iVar = 0; iVar < nDim+5; iVar++) {
+    Block->V_i[iVar][k] = V_i[iVar];
+    Block->V_j[iVar][k] = V_j[iVar];
+  }
+  
+  /*--- Artificial dissipation data of the centered schemes ---*/
+  
+  if (Block->Dissipation) {
+    Block->Lambda_i[k] = Lambda_i;   Block->Lambda_j[k] = Lambda_j;
+    Block->Sensor_i[k] = Sensor_i;   Block->Sensor_j[k] = Sensor_j;
+    Block->Neighbor_i[k] = su2double(Neighbor_i); Block->Neighbor_j[k] = su2double(Neighbor_j);
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Block->Und_Lapl_i[iVar][k] = Und_Lapl_i[iVar];
+      Block->Und_Lapl_j[iVar][k] = Und_Lapl_j[iVar];
+    }
+  }
+  
+  Block->nEdge++;
+  
+  return (Block->nEdge == EDGE_BLOCK_SIZE);
+  
 }
 
 void CNumerics::GetInviscidFlux(su2double val_density, su2double *val_velocity,
@@ -363,6 +426,74 @@ void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_energ
   AD_END_PASSIVE
 }
 
+void CNumerics::GetInviscidProjFlux_Block(unsigned short val_nEdge, su2double *val_density, su2double (*val_velocity)[EDGE_BLOCK_SIZE],
+                                          su2double *val_pressure, su2double *val_enthalpy, su2double (*val_normal)[EDGE_BLOCK_SIZE],
+                                          su2double (*val_Proj_Flux)[EDGE_BLOCK_SIZE]) {
+  
+  unsigned short iDim, jDim, iVar, k;
+  su2double rhoun[EDGE_BLOCK_SIZE];
+  
+  /*--- The loops over the edges are the inner ones, so that they can be vectorized ---*/
+  
+  for (iVar = 0; iVar < nDim+2; iVar++)
+    for (k = 0; k < val_nEdge; k++)
+      val_Proj_Flux[iVar][k] = 0.0;
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (k = 0; k < val_nEdge; k++) {
+      rhoun[k] = val_density[k]*val_velocity[iDim][k]*val_normal[iDim][k];
+      val_Proj_Flux[0][k] += rhoun[k];
+      val_Proj_Flux[iDim+1][k] += val_pressure[k]*val_normal[iDim][k];
+      val_Proj_Flux[nDim+1][k] += rhoun[k]*val_enthalpy[k];
+    }
+    for (jDim = 0; jDim < nDim; jDim++)
+      for (k = 0; k < val_nEdge; k++)
+        val_Proj_Flux[jDim+1][k] += rhoun[k]*val_velocity[jDim][k];
+  }
+  
+}
+
+void CNumerics::GetInviscidProjJac_Block(unsigned short val_nEdge, su2double (*val_velocity)[EDGE_BLOCK_SIZE], su2double *val_energy,
+                                         su2double (*val_normal)[EDGE_BLOCK_SIZE], su2double val_scale,
+                                         su2double (*val_Proj_Jac_Tensor)[5][EDGE_BLOCK_SIZE]) {
+  AD_BEGIN_PASSIVE
+  unsigned short iDim, jDim, k;
+  su2double proj_vel[EDGE_BLOCK_SIZE], phi[EDGE_BLOCK_SIZE], a1[EDGE_BLOCK_SIZE], a2 = Gamma-1.0;
+  
+  for (k = 0; k < val_nEdge; k++) {
+    proj_vel[k] = 0.0; phi[k] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (k = 0; k < val_nEdge; k++) {
+      phi[k]      += val_velocity[iDim][k]*val_velocity[iDim][k];
+      proj_vel[k] += val_velocity[iDim][k]*val_normal[iDim][k];
+    }
+  
+  for (k = 0; k < val_nEdge; k++) {
+    phi[k] = 0.5*Gamma_Minus_One*phi[k];
+    a1[k] = Gamma*val_energy[k]-phi[k];
+    val_Proj_Jac_Tensor[0][0][k] = 0.0;
+    val_Proj_Jac_Tensor[0][nDim+1][k] = 0.0;
+    val_Proj_Jac_Tensor[nDim+1][0][k] = val_scale*proj_vel[k]*(phi[k]-a1[k]);
+    val_Proj_Jac_Tensor[nDim+1][nDim+1][k] = val_scale*Gamma*proj_vel[k];
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (k = 0; k < val_nEdge; k++) {
+      val_Proj_Jac_Tensor[0][iDim+1][k] = val_scale*val_normal[iDim][k];
+      val_Proj_Jac_Tensor[iDim+1][0][k] = val_scale*(val_normal[iDim][k]*phi[k] - val_velocity[iDim][k]*proj_vel[k]);
+      val_Proj_Jac_Tensor[iDim+1][nDim+1][k] = val_scale*a2*val_normal[iDim][k];
+      val_Proj_Jac_Tensor[nDim+1][iDim+1][k] = val_scale*(val_normal[iDim][k]*a1[k]-a2*val_velocity[iDim][k]*proj_vel[k]);
+    }
+    for (jDim = 0; jDim < nDim; jDim++)
+      for (k = 0; k < val_nEdge; k++)
+        val_Proj_Jac_Tensor[iDim+1][jDim+1][k] = val_scale*(val_normal[jDim][k]*val_velocity[iDim][k]-a2*val_normal[iDim][k]*val_velocity[jDim][k]);
+    for (k = 0; k < val_nEdge; k++)
+      val_Proj_Jac_Tensor[iDim+1][iDim+1][k] += val_scale*proj_vel[k];
+  }
+  AD_END_PASSIVE
+}
+
 
 void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_enthalpy,
 		su2double *val_chi, su2double *val_kappa,
@@ -764,6 +895,176 @@ void CNumerics::GetPMatrix_inv(su2double *val_density, su2double *val_velocity,
 	}
 }
 
+void CNumerics::GetPMatrix_Block(unsigned short val_nEdge, su2double *val_density, su2double (*val_velocity)[EDGE_BLOCK_SIZE],
+                                 su2double *val_soundspeed, su2double (*val_normal)[EDGE_BLOCK_SIZE],
+                                 su2double (*val_p_tensor)[5][EDGE_BLOCK_SIZE]) {
+  
+  unsigned short k;
+  su2double rho, u, v, w, nx, ny, nz, sqvel, rhooc, rhoxc, proj_vel;
+  
+  if (nDim == 2) {
+    
+    for (k = 0; k < val_nEdge; k++) {
+      
+      rho = val_density[k]; u = val_velocity[0][k]; v = val_velocity[1][k];
+      nx = val_normal[0][k]; ny = val_normal[1][k];
+      rhooc = rho/val_soundspeed[k]; rhoxc = rho*val_soundspeed[k];
+      sqvel = u*u+v*v;
+      
+      val_p_tensor[0][0][k]=1.0;
+      val_p_tensor[0][1][k]=0.0;
+      val_p_tensor[0][2][k]=0.5*rhooc;
+      val_p_tensor[0][3][k]=0.5*rhooc;
+      
+      val_p_tensor[1][0][k]=u;
+      val_p_tensor[1][1][k]=rho*ny;
+      val_p_tensor[1][2][k]=0.5*(u*rhooc+nx*rho);
+      val_p_tensor[1][3][k]=0.5*(u*rhooc-nx*rho);
+      
+      val_p_tensor[2][0][k]=v;
+      val_p_tensor[2][1][k]=-rho*nx;
+      val_p_tensor[2][2][k]=0.5*(v*rhooc+ny*rho);
+      val_p_tensor[2][3][k]=0.5*(v*rhooc-ny*rho);
+      
+      val_p_tensor[3][0][k]=0.5*sqvel;
+      val_p_tensor[3][1][k]=rho*u*ny-rho*v*nx;
+      val_p_tensor[3][2][k]=0.5*(0.5*sqvel*rhooc+rho*u*nx+rho*v*ny+rhoxc/Gamma_Minus_One);
+      val_p_tensor[3][3][k]=0.5*(0.5*sqvel*rhooc-rho*u*nx-rho*v*ny+rhoxc/Gamma_Minus_One);
+      
+    }
+    
+  }
+  else {
+    
+    for (k = 0; k < val_nEdge; k++) {
+      
+      rho = val_density[k]; u = val_velocity[0][k]; v = val_velocity[1][k]; w = val_velocity[2][k];
+      nx = val_normal[0][k]; ny = val_normal[1][k]; nz = val_normal[2][k];
+      rhooc = rho/val_soundspeed[k]; rhoxc = rho*val_soundspeed[k];
+      sqvel = u*u+v*v+w*w; proj_vel = u*nx+v*ny+w*nz;
+      
+      val_p_tensor[0][0][k]=nx;
+      val_p_tensor[0][1][k]=ny;
+      val_p_tensor[0][2][k]=nz;
+      val_p_tensor[0][3][k]=0.5*rhooc;
+      val_p_tensor[0][4][k]=0.5*rhooc;
+      
+      val_p_tensor[1][0][k]=u*nx;
+      val_p_tensor[1][1][k]=u*ny-rho*nz;
+      val_p_tensor[1][2][k]=u*nz+rho*ny;
+      val_p_tensor[1][3][k]=0.5*(u*rhooc+rho*nx);
+      val_p_tensor[1][4][k]=0.5*(u*rhooc-rho*nx);
+      
+      val_p_tensor[2][0][k]=v*nx+rho*nz;
+      val_p_tensor[2][1][k]=v*ny;
+      val_p_tensor[2][2][k]=v*nz-rho*nx;
+      val_p_tensor[2][3][k]=0.5*(v*rhooc+rho*ny);
+      val_p_tensor[2][4][k]=0.5*(v*rhooc-rho*ny);
+      
+      val_p_tensor[3][0][k]=w*nx-rho*ny;
+      val_p_tensor[3][1][k]=w*ny+rho*nx;
+      val_p_tensor[3][2][k]=w*nz;
+      val_p_tensor[3][3][k]=0.5*(w*rhooc+rho*nz);
+      val_p_tensor[3][4][k]=0.5*(w*rhooc-rho*nz);
+      
+      val_p_tensor[4][0][k]=0.5*sqvel*nx+rho*v*nz-rho*w*ny;
+      val_p_tensor[4][1][k]=0.5*sqvel*ny-rho*u*nz+rho*w*nx;
+      val_p_tensor[4][2][k]=0.5*sqvel*nz+rho*u*ny-rho*v*nx;
+      val_p_tensor[4][3][k]=0.5*(0.5*sqvel*rhooc+rho*proj_vel+rhoxc/Gamma_Minus_One);
+      val_p_tensor[4][4][k]=0.5*(0.5*sqvel*rhooc-rho*proj_vel+rhoxc/Gamma_Minus_One);
+      
+    }
+    
+  }
+  
+}
+
+void CNumerics::GetPMatrix_inv_Block(unsigned short val_nEdge, su2double *val_density, su2double (*val_velocity)[EDGE_BLOCK_SIZE],
+                                     su2double *val_soundspeed, su2double (*val_normal)[EDGE_BLOCK_SIZE],
+                                     su2double (*val_invp_tensor)[5][EDGE_BLOCK_SIZE]) {
+  
+  unsigned short k;
+  su2double rho, u, v, w, nx, ny, nz, sqvel, gm1_o_c2, gm1_o_rhoxc, proj_vel_o_rho;
+  
+  if (nDim == 2) {
+    
+    for (k = 0; k < val_nEdge; k++) {
+      
+      rho = val_density[k]; u = val_velocity[0][k]; v = val_velocity[1][k];
+      nx = val_normal[0][k]/rho; ny = val_normal[1][k]/rho;
+      gm1_o_c2 = Gamma_Minus_One/(val_soundspeed[k]*val_soundspeed[k]);
+      gm1_o_rhoxc = Gamma_Minus_One/(rho*val_soundspeed[k]);
+      sqvel = u*u+v*v;
+      
+      val_invp_tensor[0][0][k]=1.0-0.5*gm1_o_c2*sqvel;
+      val_invp_tensor[0][1][k]=gm1_o_c2*u;
+      val_invp_tensor[0][2][k]=gm1_o_c2*v;
+      val_invp_tensor[0][3][k]=-gm1_o_c2;
+      
+      val_invp_tensor[1][0][k]=-ny*u+nx*v;
+      val_invp_tensor[1][1][k]=ny;
+      val_invp_tensor[1][2][k]=-nx;
+      val_invp_tensor[1][3][k]=0.0;
+      
+      val_invp_tensor[2][0][k]=-nx*u-ny*v+0.5*gm1_o_rhoxc*sqvel;
+      val_invp_tensor[2][1][k]=nx-gm1_o_rhoxc*u;
+      val_invp_tensor[2][2][k]=ny-gm1_o_rhoxc*v;
+      val_invp_tensor[2][3][k]=gm1_o_rhoxc;
+      
+      val_invp_tensor[3][0][k]=nx*u+ny*v+0.5*gm1_o_rhoxc*sqvel;
+      val_invp_tensor[3][1][k]=-nx-gm1_o_rhoxc*u;
+      val_invp_tensor[3][2][k]=-ny-gm1_o_rhoxc*v;
+      val_invp_tensor[3][3][k]=gm1_o_rhoxc;
+      
+    }
+    
+  }
+  else {
+    
+    for (k = 0; k < val_nEdge; k++) {
+      
+      rho = val_density[k]; u = val_velocity[0][k]; v = val_velocity[1][k]; w = val_velocity[2][k];
+      nx = val_normal[0][k]; ny = val_normal[1][k]; nz = val_normal[2][k];
+      gm1_o_c2 = Gamma_Minus_One/(val_soundspeed[k]*val_soundspeed[k]);
+      gm1_o_rhoxc = Gamma_Minus_One/(rho*val_soundspeed[k]);
+      sqvel = u*u+v*v+w*w; proj_vel_o_rho = (nx*u+ny*v+nz*w)/rho;
+      
+      val_invp_tensor[0][0][k]=nx-nz*v/rho+ny*w/rho-nx*0.5*gm1_o_c2*sqvel;
+      val_invp_tensor[0][1][k]=nx*gm1_o_c2*u;
+      val_invp_tensor[0][2][k]=nz/rho+nx*gm1_o_c2*v;
+      val_invp_tensor[0][3][k]=-ny/rho+nx*gm1_o_c2*w;
+      val_invp_tensor[0][4][k]=-nx*gm1_o_c2;
+      
+      val_invp_tensor[1][0][k]=ny+nz*u/rho-nx*w/rho-ny*0.5*gm1_o_c2*sqvel;
+      val_invp_tensor[1][1][k]=-nz/rho+ny*gm1_o_c2*u;
+      val_invp_tensor[1][2][k]=ny*gm1_o_c2*v;
+      val_invp_tensor[1][3][k]=nx/rho+ny*gm1_o_c2*w;
+      val_invp_tensor[1][4][k]=-ny*gm1_o_c2;
+      
+      val_invp_tensor[2][0][k]=nz-ny*u/rho+nx*v/rho-nz*0.5*gm1_o_c2*sqvel;
+      val_invp_tensor[2][1][k]=ny/rho+nz*gm1_o_c2*u;
+      val_invp_tensor[2][2][k]=-nx/rho+nz*gm1_o_c2*v;
+      val_invp_tensor[2][3][k]=nz*gm1_o_c2*w;
+      val_invp_tensor[2][4][k]=-nz*gm1_o_c2;
+      
+      val_invp_tensor[3][0][k]=-proj_vel_o_rho+0.5*gm1_o_rhoxc*sqvel;
+      val_invp_tensor[3][1][k]=nx/rho-gm1_o_rhoxc*u;
+      val_invp_tensor[3][2][k]=ny/rho-gm1_o_rhoxc*v;
+      val_invp_tensor[3][3][k]=nz/rho-gm1_o_rhoxc*w;
+      val_invp_tensor[3][4][k]=gm1_o_rhoxc;
+      
+      val_invp_tensor[4][0][k]=proj_vel_o_rho+0.5*gm1_o_rhoxc*sqvel;
+      val_invp_tensor[4][1][k]=-nx/rho-gm1_o_rhoxc*u;
+      val_invp_tensor[4][2][k]=-ny/rho-gm1_o_rhoxc*v;
+      val_invp_tensor[4][3][k]=-nz/rho-gm1_o_rhoxc*w;
+      val_invp_tensor[4][4][k]=gm1_o_rhoxc;
+      
+    }
+    
+  }
+  
+}
+
 void CNumerics::GetPMatrix_inv(su2double **val_invp_tensor, su2double *val_density, su2double *val_velocity,
 		su2double *val_soundspeed, su2double *val_chi, su2double *val_kappa, su2double *val_normal) {
 
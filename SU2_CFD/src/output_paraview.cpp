@@ -1777,3 +1777,223 @@ void COutput::SetParaview_MeshASCII(CConfig *config, CGeometry *geometry, unsign
   if (SurfacePoint != NULL) delete [] SurfacePoint;
   
 }
+
+void COutput::SetParaview_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol) {
+  
+  unsigned short iDim, iNode, nDim = geometry->GetnDim();
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  unsigned long iPoint, jPoint, iElem, iField, nFields, nPiece_Point = 0, nPiece_Elem = 0, nPiece_Conn = 0;
+  unsigned long iExtIter = config->GetExtIter();
+  int rank = MASTER_NODE, size = SINGLE_NODE, iProcessor;
+  bool adjoint        = (config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint());
+  bool fem            = (Kind_Solver == FEM_ELASTICITY);
+  vector<string> Fields;
+  char buffer[MAX_STRING_SIZE];
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  /*--- File names: every rank writes its own piece (<name>_<rank>.vtu), the
+   master node writes the index of the pieces (<name>.pvtu). ---*/
+  
+  string filename;
+  if (fem) filename = (surf_sol ? config->GetSurfStructure_FileName() : config->GetStructure_FileName());
+  else if (adjoint) filename = (surf_sol ? config->GetSurfAdjCoeff_FileName() : config->GetAdj_FileName());
+  else filename = (surf_sol ? config->GetSurfFlowCoeff_FileName() : config->GetFlow_FileName());
+  
+  if ((val_nZone > 1) && (config->GetUnsteady_Simulation() != TIME_SPECTRAL)) {
+    SPRINTF (buffer, "_%d", SU2_TYPE::Int(val_iZone));
+    filename.append(buffer);
+  }
+  if (config->GetUnsteady_Simulation() == TIME_SPECTRAL) {
+    SPRINTF (buffer, "_%05d", SU2_TYPE::Int(val_iZone));
+    filename.append(buffer);
+  }
+  else if ((config->GetUnsteady_Simulation() && config->GetWrt_Unsteady()) ||
+           (config->GetDynamic_Analysis() && config->GetWrt_Dynamic())) {
+    SPRINTF (buffer, "_%05d", SU2_TYPE::Int(iExtIter));
+    filename.append(buffer);
+  }
+  
+  SPRINTF (buffer, "_%d.vtu", rank);
+  string piece_filename = filename + string(buffer);
+  string index_filename = filename + ".pvtu";
+  
+  /*--- Elements of the piece (without the halo cells of the lower ranks) ---*/
+  
+  vector<CPrimalGrid*> Piece_Elem;
+  GetLocal_Elements(config, geometry, surf_sol, Piece_Elem);
+  nPiece_Elem = Piece_Elem.size();
+  
+  /*--- Points of the piece, numbered in the local order ---*/
+  
+  vector<bool> Used(geometry->GetnPoint(), false);
+  for (iElem = 0; iElem < nPiece_Elem; iElem++) {
+    nPiece_Conn += Piece_Elem[iElem]->GetnNodes();
+    for (iNode = 0; iNode < Piece_Elem[iElem]->GetnNodes(); iNode++)
+      Used[Piece_Elem[iElem]->GetNode(iNode)] = true;
+  }
+  vector<unsigned long> Piece_Point, Piece_Index(geometry->GetnPoint(), 0);
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    if (Used[iPoint]) {
+      Piece_Index[iPoint] = Piece_Point.size();
+      Piece_Point.push_back(iPoint);
+    }
+  }
+  nPiece_Point = Piece_Point.size();
+  
+  /*--- Coordinates and point data of the piece (one contiguous array per field) ---*/
+  
+  vector<float> Coords_Piece(3*nPiece_Point, 0.0), Data_Piece;
+  
+  for (jPoint = 0; jPoint < nPiece_Point; jPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coords_Piece[3*jPoint+iDim] = float(SU2_TYPE::GetValue(geometry->node[Piece_Point[jPoint]]->GetCoord(iDim)));
+  }
+  
+  LoadLocal_PointData(config, geometry, solver, Piece_Point, Fields, Data_Piece);
+  nFields = Fields.size();
+  
+  /*--- Connectivity of the piece in local numbering (VTK and SU2 share the element types and node ordering) ---*/
+  
+  vector<int> Conn_Piece(nPiece_Conn), Offset_Piece(nPiece_Elem);
+  vector<unsigned char> Type_Piece(nPiece_Elem);
+  
+  nPiece_Conn = 0;
+  for (iElem = 0; iElem < nPiece_Elem; iElem++) {
+    for (iNode = 0; iNode < Piece_Elem[iElem]->GetnNodes(); iNode++)
+      Conn_Piece[nPiece_Conn++] = int(Piece_Index[Piece_Elem[iElem]->GetNode(iNode)]);
+    Offset_Piece[iElem] = int(nPiece_Conn);
+    Type_Piece[iElem] = (unsigned char)(Piece_Elem[iElem]->GetVTK_Type());
+  }
+  
+  /*--- Image of the piece: XML header and the arrays appended in raw binary,
+   each array preceded by its size in bytes (UInt32) ---*/
+  
+  unsigned short Endian_Test = 1;
+  string byte_order = ((*(char *)&Endian_Test) == 1 ? "LittleEndian" : "BigEndian");
+  
+  unsigned int nBytes, Offset = 0;
+  ostringstream Header;
+  
+  Header << "<?xml version=\"1.0\"?>\n";
+  Header << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"" << byte_order << "\">\n";
+  Header << "<UnstructuredGrid>\n";
+  Header << "<Piece NumberOfPoints=\"" << nPiece_Point << "\" NumberOfCells=\"" << nPiece_Elem << "\">\n";
+  
+  Header << "<PointData>\n";
+  for (iField = 0; iField < nFields; iField++) {
+    Header << "<DataArray type=\"Float32\" Name=\"" << Fields[iField] << "\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+    Offset += sizeof(unsigned int) + nPiece_Point*sizeof(float);
+  }
+  Header << "</PointData>\n";
+  
+  Header << "<Points>\n";
+  Header << "<DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+  Offset += sizeof(unsigned int) + 3*nPiece_Point*sizeof(float);
+  Header << "</Points>\n";
+  
+  Header << "<Cells>\n";
+  Header << "<DataArray type=\"Int32\" Name=\"connectivity\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+  Offset += sizeof(unsigned int) + nPiece_Conn*sizeof(int);
+  Header << "<DataArray type=\"Int32\" Name=\"offsets\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+  Offset += sizeof(unsigned int) + nPiece_Elem*sizeof(int);
+  Header << "<DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+  Header << "</Cells>\n";
+  
+  Header << "</Piece>\n";
+  Header << "</UnstructuredGrid>\n";
+  Header << "<AppendedData encoding=\"raw\">\n_";
+  
+  string Header_Str = Header.str(), Footer_Str = "\n</AppendedData>\n</VTKFile>\n";
+  
+  vector<char> *Piece = new vector<char>();
+  Piece->reserve(Header_Str.size() + Offset + sizeof(unsigned int) + nPiece_Elem + Footer_Str.size());
+  Piece->insert(Piece->end(), Header_Str.begin(), Header_Str.end());
+  
+  nBytes = nPiece_Point*sizeof(float);
+  for (iField = 0; iField < nFields; iField++) {
+    Piece->insert(Piece->end(), (char *)&nBytes, (char *)&nBytes + sizeof(unsigned int));
+    if (nPiece_Point > 0) Piece->insert(Piece->end(), (char *)&Data_Piece[iField*nPiece_Point], (char *)&Data_Piece[iField*nPiece_Point] + nBytes);
+  }
+  
+  nBytes = 3*nPiece_Point*sizeof(float);
+  Piece->insert(Piece->end(), (char *)&nBytes, (char *)&nBytes + sizeof(unsigned int));
+  if (nPiece_Point > 0) Piece->insert(Piece->end(), (char *)&Coords_Piece[0], (char *)&Coords_Piece[0] + nBytes);
+  
+  nBytes = nPiece_Conn*sizeof(int);
+  Piece->insert(Piece->end(), (char *)&nBytes, (char *)&nBytes + sizeof(unsigned int));
+  if (nPiece_Conn > 0) Piece->insert(Piece->end(), (char *)&Conn_Piece[0], (char *)&Conn_Piece[0] + nBytes);
+  
+  nBytes = nPiece_Elem*sizeof(int);
+  Piece->insert(Piece->end(), (char *)&nBytes, (char *)&nBytes + sizeof(unsigned int));
+  if (nPiece_Elem > 0) Piece->insert(Piece->end(), (char *)&Offset_Piece[0], (char *)&Offset_Piece[0] + nBytes);
+  
+  nBytes = nPiece_Elem*sizeof(unsigned char);
+  Piece->insert(Piece->end(), (char *)&nBytes, (char *)&nBytes + sizeof(unsigned int));
+  if (nPiece_Elem > 0) Piece->insert(Piece->end(), (char *)&Type_Piece[0], (char *)&Type_Piece[0] + nBytes);
+  
+  Piece->insert(Piece->end(), Footer_Str.begin(), Footer_Str.end());
+  
+  /*--- Write the piece, in the background (non-blocking MPI-IO on this rank alone)
+   if requested, the image is then kept until the write is completed. ---*/
+  
+#ifdef HAVE_MPI
+  if (config->GetWrt_Async_Output()) {
+    MPI_File fhw;
+    MPI_Request request;
+    char fname[MAX_STRING_SIZE];
+    strncpy(fname, piece_filename.c_str(), MAX_STRING_SIZE-1); fname[MAX_STRING_SIZE-1] = '\0';
+    if (MPI_File_open(MPI_COMM_SELF, fname, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw) == MPI_SUCCESS) {
+      MPI_File_set_size(fhw, 0);
+      MPI_File_iwrite_at(fhw, 0, Piece->data(), Piece->size(), MPI_CHAR, &request);
+      Async_Buffer.push_back(Piece);
+      Async_File.push_back(fhw);
+      Async_Request.push_back(request);
+      Piece = NULL;
+    }
+  }
+#endif
+  
+  if (Piece != NULL) {
+    ofstream Piece_File(piece_filename.c_str(), ios::out | ios::binary);
+    if (Piece_File.is_open()) {
+      Piece_File.write(Piece->data(), Piece->size());
+      Piece_File.close();
+    }
+    else cout << "Unable to open the Paraview file " << piece_filename << "." << endl;
+    delete Piece;
+  }
+  
+  /*--- The master node writes the index, the pieces are referenced
+   relative to the directory of the index file ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    string piece_basename = filename.substr(filename.find_last_of('/')+1);
+    
+    ofstream Index_File(index_filename.c_str(), ios::out);
+    if (Index_File.is_open()) {
+      Index_File << "<?xml version=\"1.0\"?>\n";
+      Index_File << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\"" << byte_order << "\">\n";
+      Index_File << "<PUnstructuredGrid GhostLevel=\"0\">\n";
+      Index_File << "<PPointData>\n";
+      for (iField = 0; iField < nFields; iField++)
+        Index_File << "<PDataArray type=\"Float32\" Name=\"" << Fields[iField] << "\"/>\n";
+      Index_File << "</PPointData>\n";
+      Index_File << "<PPoints>\n";
+      Index_File << "<PDataArray type=\"Float32\" NumberOfComponents=\"3\"/>\n";
+      Index_File << "</PPoints>\n";
+      for (iProcessor = 0; iProcessor < size; iProcessor++)
+        Index_File << "<Piece Source=\"" << piece_basename << "_" << iProcessor << ".vtu\"/>\n";
+      Index_File << "</PUnstructuredGrid>\n";
+      Index_File << "</VTKFile>\n";
+      Index_File.close();
+    }
+    else cout << "Unable to open the Paraview file " << index_filename << "." << endl;
+    
+  }
+  
+}
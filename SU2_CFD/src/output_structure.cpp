@@ -30,6 +30,7 @@
  */
 
 #include "../include/output_structure.hpp"
+#include "../../Common/include/adt_structure.hpp"
 
 COutput::COutput(void) {
   
@@ -73,6 +74,10 @@ COutput::COutput(void) {
   
   wrote_Paraview_base = false;
   
+  /*--- Initialize the timing history ---*/
+  
+  Timing_Offset = 0;
+  
   /*--- Initialize residual ---*/
   
   RhoRes_New = EPS;
@@ -85,6 +90,34 @@ COutput::~COutput(void) {
   /* Coords and Conn_*(Connectivity) have their own dealloc functions */
   /* Data is taken care of in DeallocateSolution function */
   
+  /*--- Complete the files still being written in the background ---*/
+  
+  SetAsync_Flush();
+  
+}
+
+void COutput::SetAsync_Flush(void) {
+  
+  unsigned long iWrite;
+  
+  /*--- Wait for the background writes and close their files, the files are
+   closed in the same order on all the ranks (the close is collective). ---*/
+  
+#ifdef HAVE_MPI
+  for (iWrite = 0; iWrite < Async_File.size(); iWrite++) {
+    MPI_Wait(&Async_Request[iWrite], MPI_STATUS_IGNORE);
+    MPI_File_close(&Async_File[iWrite]);
+  }
+  Async_File.clear();
+  Async_Request.clear();
+#endif
+  
+  /*--- Release the snapshots ---*/
+  
+  for (iWrite = 0; iWrite < Async_Buffer.size(); iWrite++)
+    delete Async_Buffer[iWrite];
+  Async_Buffer.clear();
+  
 }
 
 void COutput::SetSurfaceCSV_Flow(CConfig *config, CGeometry *geometry,
@@ -3734,43 +3767,19 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
   
   /*--- Local variables ---*/
   
-  unsigned short nZone = geometry->GetnZone();
   unsigned short Kind_Solver  = config->GetKind_Solver();
   unsigned short iVar, iDim, nDim = geometry->GetnDim();
-  unsigned long iPoint, iExtIter = config->GetExtIter();
+  unsigned long iPoint;
   bool grid_movement = config->GetGrid_Movement();
   bool dynamic_fem = (config->GetDynamic_Analysis() == DYNAMIC);
   bool fem = ((config->GetKind_Solver() == FEM_ELASTICITY)||
 		  	  (config->GetKind_Solver() == ADJ_ELASTICITY));
-  bool disc_adj_fem = (config->GetKind_Solver() == DISC_ADJ_FEM);
   ofstream restart_file;
   string filename;
   
   /*--- Retrieve filename from config ---*/
   
-  if (((config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint())) && ((config->GetKind_Solver() != DISC_ADJ_FEM)))  {
-    filename = config->GetRestart_AdjFileName();
-    filename = config->GetObjFunc_Extension(filename);
-  } else if (fem){
-    filename = config->GetRestart_FEMFileName();
-  } else if (disc_adj_fem){
-    filename = config->GetRestart_AdjFEMFileName();
-  } else {
-    filename = config->GetRestart_FlowFileName();
-  }
-  
-  /*--- Append the zone number if multizone problems ---*/
-  if (nZone > 1)
-    filename= config->GetMultizone_FileName(filename, val_iZone);
-  
-  /*--- Unsteady problems require an iteration number to be appended. ---*/
-  if (config->GetUnsteady_Simulation() == TIME_SPECTRAL) {
-    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(val_iZone));
-  } else if (config->GetWrt_Unsteady()) {
-    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
-  } else if ((fem) && (config->GetWrt_Dynamic())) {
-    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
-  }
+  filename = GetRestart_FileName(config, geometry, val_iZone);
   
   /*--- Open the restart file and write the solution. ---*/
   
@@ -3826,14 +3835,16 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
     }
     
     if ((Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
-      if (config->GetOutput_FileFormat() == PARAVIEW) {
+      if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_BINARY) ||
+          (config->GetOutput_FileFormat() == XDMF)) {
         restart_file << "\t\"Pressure\"\t\"Temperature\"\t\"Pressure_Coefficient\"\t\"Mach\"";
       } else
         restart_file << "\t\"Pressure\"\t\"Temperature\"\t\"C<sub>p</sub>\"\t\"Mach\"";
     }
     
     if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
-      if (config->GetOutput_FileFormat() == PARAVIEW) {
+      if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_BINARY) ||
+          (config->GetOutput_FileFormat() == XDMF)) {
         if (nDim == 2) restart_file << "\t\"Laminar_Viscosity\"\t\"Skin_Friction_Coefficient_X\"\t\"Skin_Friction_Coefficient_Y\"\t\"Heat_Flux\"\t\"Y_Plus\"";
         if (nDim == 3) restart_file << "\t\"Laminar_Viscosity\"\t\"Skin_Friction_Coefficient_X\"\t\"Skin_Friction_Coefficient_Y\"\t\"Skin_Friction_Coefficient_Z\"\t\"Heat_Flux\"\t\"Y_Plus\"";
       } else {
@@ -3843,7 +3854,8 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
     }
     
     if (Kind_Solver == RANS) {
-      if (config->GetOutput_FileFormat() == PARAVIEW) {
+      if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_BINARY) ||
+          (config->GetOutput_FileFormat() == XDMF)) {
         restart_file << "\t\"Eddy_Viscosity\"";
       } else
         restart_file << "\t\"<greek>m</greek><sub>t</sub>\"";
@@ -3935,169 +3947,1427 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
   
 }
 
-void COutput::DeallocateCoordinates(CConfig *config, CGeometry *geometry) {
+string COutput::GetRestart_FileName(CConfig *config, CGeometry *geometry, unsigned short val_iZone) {
   
-  unsigned short iDim, nDim = geometry->GetnDim();
+  unsigned short nZone = geometry->GetnZone();
+  unsigned long iExtIter = config->GetExtIter();
+  bool fem = ((config->GetKind_Solver() == FEM_ELASTICITY)||
+              (config->GetKind_Solver() == ADJ_ELASTICITY));
+  bool disc_adj_fem = (config->GetKind_Solver() == DISC_ADJ_FEM);
+  string filename;
   
-  int rank = MASTER_NODE;
-#ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#endif
+  if (((config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint())) && ((config->GetKind_Solver() != DISC_ADJ_FEM)))  {
+    filename = config->GetRestart_AdjFileName();
+    filename = config->GetObjFunc_Extension(filename);
+  } else if (fem){
+    filename = config->GetRestart_FEMFileName();
+  } else if (disc_adj_fem){
+    filename = config->GetRestart_AdjFEMFileName();
+  } else {
+    filename = config->GetRestart_FlowFileName();
+  }
   
-  /*--- The master node alone owns all data found in this routine. ---*/
+  /*--- Append the zone number if multizone problems ---*/
+  if (nZone > 1)
+    filename= config->GetMultizone_FileName(filename, val_iZone);
   
-  if (rank == MASTER_NODE) {
-    
-    /*--- Deallocate memory for coordinate data ---*/
-    
-    for (iDim = 0; iDim < nDim; iDim++) {
-      delete [] Coords[iDim];
-    }
-    delete [] Coords;
+  /*--- Unsteady problems require an iteration number to be appended. ---*/
+  if (config->GetUnsteady_Simulation() == TIME_SPECTRAL) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(val_iZone));
+  } else if (config->GetWrt_Unsteady()) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
+  } else if ((fem) && (config->GetWrt_Dynamic())) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
   }
+  
+  return filename;
+  
 }
 
-void COutput::DeallocateConnectivity(CConfig *config, CGeometry *geometry, bool surf_sol) {
+bool COutput::GetBinary_Restart(CConfig *config) {
   
-  int rank = MASTER_NODE;
-#ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#endif
+  /*--- The binary format holds the variables read back by the direct flow and FEM solvers ---*/
+  
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  
+  return ((config->GetWrt_Binary_Restart() || config->GetWrt_Compressed_Restart()) &&
+          ((Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) ||
+           (Kind_Solver == RANS) || (Kind_Solver == FEM_ELASTICITY)));
+  
+}
 
-  /*--- The master node alone owns all data found in this routine. ---*/
-  if (rank == MASTER_NODE) {
+void COutput::SetRestart_Binary(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone) {
+  
+  unsigned short iVar, iDim, nDim = geometry->GetnDim(), iSol, nSol = 0;
+  unsigned long iPoint, iSorted, iField, nFields, nPointDomain = geometry->GetnPointDomain();
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  bool grid_movement = config->GetGrid_Movement();
+  bool fem = (Kind_Solver == FEM_ELASTICITY);
+  bool dynamic_fem = (config->GetDynamic_Analysis() == DYNAMIC);
+  vector<string> Fields;
+  vector<pair<unsigned long, unsigned long> > Sorted_Points;
+  CSolver *Sol[2];
+  char buffer[MAX_STRING_SIZE];
+  
+  string filename = GetRestart_FileName(config, geometry, val_iZone);
+  
+  /*--- Names of the fields, the same columns as the ASCII file without
+   the output-only variables: the coordinates, the solution of the solvers
+   and the grid velocities or the FEM velocities and accelerations. ---*/
+  
+  Fields.push_back("\"x\""); Fields.push_back("\"y\"");
+  if (nDim == 3) Fields.push_back("\"z\"");
+  
+  if (fem) { Sol[nSol++] = solver[FEA_SOL]; }
+  else {
+    Sol[nSol++] = solver[FLOW_SOL];
+    if (Kind_Solver == RANS) Sol[nSol++] = solver[TURB_SOL];
+  }
+  
+  unsigned short nVar_Sol = 0;
+  for (iSol = 0; iSol < nSol; iSol++) nVar_Sol += Sol[iSol]->GetnVar();
+  
+  for (iVar = 0; iVar < nVar_Sol; iVar++) {
+    SPRINTF(buffer, fem ? "\"Displacement_%d\"" : "\"Conservative_%d\"", iVar+1);
+    Fields.push_back(buffer);
+  }
+  if (fem && dynamic_fem) {
+    for (iVar = 0; iVar < nVar_Sol; iVar++) { SPRINTF(buffer, "\"Velocity_%d\"", iVar+1); Fields.push_back(buffer); }
+    for (iVar = 0; iVar < nVar_Sol; iVar++) { SPRINTF(buffer, "\"Acceleration_%d\"", iVar+1); Fields.push_back(buffer); }
+  }
+  if (grid_movement && !fem) {
+    Fields.push_back("\"Grid_Velx\""); Fields.push_back("\"Grid_Vely\"");
+    if (nDim == 3) Fields.push_back("\"Grid_Velz\"");
+  }
+  nFields = Fields.size();
+  
+  /*--- Values of the domain points, in increasing order of global index ---*/
+  
+  Sorted_Points.resize(nPointDomain);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Sorted_Points[iPoint] = make_pair(geometry->node[iPoint]->GetGlobalIndex(), iPoint);
+  sort(Sorted_Points.begin(), Sorted_Points.end());
+  
+  vector<passivedouble> Buffer(nPointDomain*nFields);
+  
+  for (iSorted = 0; iSorted < nPointDomain; iSorted++) {
+    iPoint = Sorted_Points[iSorted].second;
+    passivedouble *Values = &Buffer[iSorted*nFields];
     
-    /*--- Deallocate memory for connectivity data ---*/
-    if (surf_sol) {
-      if (nGlobal_Line > 0      && Conn_Line      != NULL) delete [] Conn_Line;
-      if (nGlobal_BoundTria > 0 && Conn_BoundTria != NULL) delete [] Conn_BoundTria;
-      if (nGlobal_BoundQuad > 0 && Conn_BoundQuad != NULL) delete [] Conn_BoundQuad;
+    for (iDim = 0; iDim < nDim; iDim++)
+      *(Values++) = SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim));
+    for (iSol = 0; iSol < nSol; iSol++)
+      for (iVar = 0; iVar < Sol[iSol]->GetnVar(); iVar++)
+        *(Values++) = SU2_TYPE::GetValue(Sol[iSol]->node[iPoint]->GetSolution(iVar));
+    if (fem && dynamic_fem) {
+      for (iVar = 0; iVar < nVar_Sol; iVar++) *(Values++) = SU2_TYPE::GetValue(Sol[0]->node[iPoint]->GetSolution_Vel(iVar));
+      for (iVar = 0; iVar < nVar_Sol; iVar++) *(Values++) = SU2_TYPE::GetValue(Sol[0]->node[iPoint]->GetSolution_Accel(iVar));
     }
-    else {
-      if (nGlobal_Tria > 0 && Conn_Tria != NULL) delete [] Conn_Tria;
-      if (Conn_Quad != NULL) delete [] Conn_Quad;
-      if (Conn_Tetr != NULL) delete [] Conn_Tetr;
-      if (Conn_Hexa != NULL) delete [] Conn_Hexa;
-      if (Conn_Pris != NULL) delete [] Conn_Pris;
-      if (Conn_Pyra != NULL) delete [] Conn_Pyra;
+    if (grid_movement && !fem) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        *(Values++) = SU2_TYPE::GetValue(geometry->node[iPoint]->GetGridVel()[iDim]);
     }
-    
   }
-}
-
-void COutput::DeallocateSolution(CConfig *config, CGeometry *geometry) {
   
-  int rank = MASTER_NODE;
+  /*--- The compressed format is written from the same values ---*/
+  
+  if (config->GetWrt_Compressed_Restart()) {
+    SetRestart_Compressed(config, geometry, filename, Fields, Sorted_Points, Buffer);
+    return;
+  }
+  
+  /*--- Layout of the file: the tag, the number of fields and of points, the names
+   of the fields (MAX_STRING_SIZE characters each), and the values ordered by
+   global index. The master writes the header, every rank writes its own rows. ---*/
+  
+  unsigned long header[2] = {nFields, geometry->GetGlobal_nPointDomain()};
+  vector<char> Names(nFields*MAX_STRING_SIZE, '\0');
+  for (iField = 0; iField < nFields; iField++)
+    strncpy(&Names[iField*MAX_STRING_SIZE], Fields[iField].c_str(), MAX_STRING_SIZE-1);
+  
 #ifdef HAVE_MPI
+  
+  int rank;
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#endif
+  unsigned long offset = 8 + 2*sizeof(unsigned long) + nFields*MAX_STRING_SIZE;
+  MPI_File fhw;
+  char fname[MAX_STRING_SIZE];
+  strncpy(fname, filename.c_str(), MAX_STRING_SIZE-1); fname[MAX_STRING_SIZE-1] = '\0';
+  
+  if (MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw) != MPI_SUCCESS) {
+    if (rank == MASTER_NODE) cout << "Unable to open the restart file " << filename << "." << endl;
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+  }
+  MPI_File_set_size(fhw, 0);
   
-  /*--- The master node alone owns all data found in this routine. ---*/
   if (rank == MASTER_NODE) {
+    char file_tag[] = "SU2RST01";
+    MPI_File_write_at(fhw, 0, file_tag, 8, MPI_CHAR, MPI_STATUS_IGNORE);
+    MPI_File_write_at(fhw, 8, header, 2, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+    MPI_File_write_at(fhw, 8+2*sizeof(unsigned long), Names.data(), Names.size(), MPI_CHAR, MPI_STATUS_IGNORE);
+  }
+  
+  /*--- One block per point in the file view, at the position of its global index
+   (byte displacements, the global index of large meshes does not fit in an int) ---*/
+  
+  MPI_Datatype rowtype, filetype;
+  vector<MPI_Aint> Displ(nPointDomain);
+  for (iSorted = 0; iSorted < nPointDomain; iSorted++)
+    Displ[iSorted] = (MPI_Aint)(Sorted_Points[iSorted].first*nFields*sizeof(passivedouble));
+  
+  MPI_Type_contiguous(nFields, MPI_DOUBLE, &rowtype);
+  MPI_Type_create_hindexed_block(Displ.size(), 1, Displ.data(), rowtype, &filetype);
+  MPI_Type_commit(&filetype);
+  
+  char native[] = "native";
+  MPI_File_set_view(fhw, (MPI_Offset)offset, MPI_DOUBLE, filetype, native, MPI_INFO_NULL);
+  
+  if (config->GetWrt_Async_Output()) {
     
-    /*--- Deallocate memory for solution data ---*/
-    for (unsigned short iVar = 0; iVar < nVar_Total; iVar++) {
-      delete [] Data[iVar];
+    /*--- Keep a snapshot of the values and write it in the background, the file
+     is completed (and closed) before the next output or at the exit. ---*/
+    
+    vector<char> *Snapshot = new vector<char>((char *)Buffer.data(), (char *)(Buffer.data()+Buffer.size()));
+    MPI_Request request;
+    MPI_File_iwrite(fhw, Snapshot->data(), Buffer.size(), MPI_DOUBLE, &request);
+    Async_Buffer.push_back(Snapshot);
+    Async_File.push_back(fhw);
+    Async_Request.push_back(request);
+    
+  }
+  else {
+    MPI_File_write_all(fhw, Buffer.data(), Buffer.size(), MPI_DOUBLE, MPI_STATUS_IGNORE);
+    MPI_File_close(&fhw);
+  }
+  
+  MPI_Type_free(&filetype);
+  MPI_Type_free(&rowtype);
+  
+#else
+  
+  ofstream restart_file(filename.c_str(), ios::out | ios::binary);
+  restart_file.write("SU2RST01", 8);
+  restart_file.write((char*)header, 2*sizeof(unsigned long));
+  restart_file.write(Names.data(), Names.size());
+  restart_file.write((char*)Buffer.data(), Buffer.size()*sizeof(passivedouble));
+  restart_file.close();
+  
+#endif
+  
+}
+
+void COutput::Compress_Block(const passivedouble *Rows, unsigned long nRows, unsigned long nFields,
+                             const vector<passivedouble> &Tolerance, vector<unsigned char> &Stream) {
+  
+  unsigned long iRow, iField;
+  unsigned short iByte, nZero;
+  passivedouble Scale;
+  long Quant, Quant_Old;
+  unsigned long Bits, Bits_Old, Code;
+  bool Quantized;
+  
+  /*--- One stream per field, the rows are consecutive points. A field with a tolerance is
+   quantized (error below the tolerance) and the differences of the integers of two
+   consecutive points are written as variable length integers; otherwise the bits of the
+   value are xor-ed with the previous value and only the non-zero bytes are written. ---*/
+  
+  for (iField = 0; iField < nFields; iField++) {
+    
+    Quantized = (Tolerance[iField] > 0.0);
+    Scale = (Quantized ? 0.5/Tolerance[iField] : 0.0);
+    for (iRow = 0; Quantized && (iRow < nRows); iRow++)
+      if (!(fabs(Rows[iRow*nFields+iField]*Scale) < 1.0E18)) Quantized = false;
+    Stream.push_back(Quantized);
+    
+    if (Quantized) {
+      Quant_Old = 0;
+      for (iRow = 0; iRow < nRows; iRow++) {
+        Quant = (long)floor(Rows[iRow*nFields+iField]*Scale + 0.5);
+        Code = ((unsigned long)(Quant - Quant_Old) << 1) ^ (unsigned long)((Quant - Quant_Old) >> 63);
+        while (Code >= 0x80) { Stream.push_back((unsigned char)(Code | 0x80)); Code >>= 7; }
+        Stream.push_back((unsigned char)Code);
+        Quant_Old = Quant;
+      }
+    }
+    else {
+      Bits_Old = 0;
+      for (iRow = 0; iRow < nRows; iRow++) {
+        memcpy(&Bits, &Rows[iRow*nFields+iField], sizeof(unsigned long));
+        Code = Bits ^ Bits_Old;
+        for (nZero = 0; (nZero < 8) && ((Code >> (8*(7-nZero))) & 0xFF) == 0; nZero++);
+        Stream.push_back((unsigned char)nZero);
+        for (iByte = 0; iByte < 8-nZero; iByte++) Stream.push_back((unsigned char)(Code >> (8*iByte)));
+        Bits_Old = Bits;
+      }
     }
-    delete [] Data;
     
   }
+  
 }
 
-void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config) {
-  char cstr[200], buffer[50], turb_resid[1000];
-  unsigned short iMarker, iMarker_Monitoring;
-  string Monitoring_Tag, monitoring_coeff, aeroelastic_coeff;
+void COutput::SetRestart_Compressed(CConfig *config, CGeometry *geometry, string val_filename, vector<string> &Fields,
+                                    vector<pair<unsigned long, unsigned long> > &Sorted_Points, vector<passivedouble> &Buffer) {
   
-  bool rotating_frame = config->GetRotating_Frame();
-  bool aeroelastic = config->GetAeroelastic_Simulation();
-  bool equiv_area = config->GetEquivArea();
-  bool turbulent = ((config->GetKind_Solver() == RANS) || (config->GetKind_Solver() == ADJ_RANS) ||
-                    (config->GetKind_Solver() == DISC_ADJ_RANS));
-  bool frozen_turb = config->GetFrozen_Visc();
-  bool freesurface = (config->GetKind_Regime() == FREESURFACE);
-  bool inv_design = (config->GetInvDesign_Cp() || config->GetInvDesign_HeatFlux());
-  bool output_1d = config->GetWrt_1D_Output();
-  bool output_per_surface = false;
-  bool output_massflow = (config->GetKind_ObjFunc() == MASS_FLOW_RATE);
-  if (config->GetnMarker_Monitoring() > 1) output_per_surface = true;
+  unsigned short nDim = geometry->GetnDim();
+  unsigned long iField, nFields = Fields.size(), iBlock, nBlock = 1, iRow, nPoint_Global = geometry->GetGlobal_nPointDomain();
+  unsigned long Block_Begin = 0, Block_nPoint = Sorted_Points.size();
+  int rank = MASTER_NODE;
+  vector<passivedouble> Block_Rows;
+  vector<unsigned char> Stream;
   
-  unsigned short direct_diff = config->GetDirectDiff();
+  /*--- The coordinates are stored without loss ---*/
   
-  bool isothermal = false;
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-    if ((config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ))
-      isothermal = true;
+  vector<passivedouble> Tolerance(nFields, 0.0);
+  for (iField = nDim; iField < nFields; iField++)
+    Tolerance[iField] = SU2_TYPE::GetValue(config->GetRestart_Compression_Tol(iField-nDim));
   
-  /*--- Write file name with extension ---*/
+#ifdef HAVE_MPI
   
-  string filename = config->GetConv_FileName();
-  strcpy (cstr, filename.data());
+  /*--- The points are moved to blocks of consecutive global index, one per rank, so
+   that the file does not depend on the partition and consecutive values are close ---*/
   
-  if (config->GetWrt_Unsteady() && config->GetRestart()) {
-    long iExtIter = config->GetUnst_RestartIter();
-    if (SU2_TYPE::Int(iExtIter) < 10) SPRINTF (buffer, "_0000%d", SU2_TYPE::Int(iExtIter));
-    if ((SU2_TYPE::Int(iExtIter) >= 10) && (SU2_TYPE::Int(iExtIter) < 100)) SPRINTF (buffer, "_000%d", SU2_TYPE::Int(iExtIter));
-    if ((SU2_TYPE::Int(iExtIter) >= 100) && (SU2_TYPE::Int(iExtIter) < 1000)) SPRINTF (buffer, "_00%d", SU2_TYPE::Int(iExtIter));
-    if ((SU2_TYPE::Int(iExtIter) >= 1000) && (SU2_TYPE::Int(iExtIter) < 10000)) SPRINTF (buffer, "_0%d", SU2_TYPE::Int(iExtIter));
-    if (SU2_TYPE::Int(iExtIter) >= 10000) SPRINTF (buffer, "_%d", SU2_TYPE::Int(iExtIter));
-    strcat(cstr, buffer);
+  int size, iProcessor;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  nBlock = size;
+  
+  unsigned long iSorted, Global_Index, nChunk = nPoint_Global/size, nRem = nPoint_Global%size;
+  Block_Begin = rank*nChunk + min((unsigned long)rank, nRem);
+  Block_nPoint = nChunk + (((unsigned long)rank < nRem) ? 1 : 0);
+  
+  vector<vector<passivedouble> > Rows_Send(size);
+  for (iSorted = 0; iSorted < Sorted_Points.size(); iSorted++) {
+    Global_Index = Sorted_Points[iSorted].first;
+    if (Global_Index < nRem*(nChunk+1)) iProcessor = Global_Index/(nChunk+1);
+    else iProcessor = nRem + (Global_Index - nRem*(nChunk+1))/nChunk;
+    Rows_Send[iProcessor].push_back(passivedouble(Global_Index));
+    Rows_Send[iProcessor].insert(Rows_Send[iProcessor].end(), &Buffer[iSorted*nFields], &Buffer[(iSorted+1)*nFields]);
   }
   
-  if ((config->GetOutput_FileFormat() == TECPLOT) ||
-      (config->GetOutput_FileFormat() == FIELDVIEW)) SPRINTF (buffer, ".dat");
-  else if ((config->GetOutput_FileFormat() == TECPLOT_BINARY) ||
-           (config->GetOutput_FileFormat() == FIELDVIEW_BINARY))  SPRINTF (buffer, ".plt");
-  else if (config->GetOutput_FileFormat() == PARAVIEW)  SPRINTF (buffer, ".csv");
-  strcat(cstr, buffer);
+  unsigned long *nSend = new unsigned long[size], *nRecv = new unsigned long[size];
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    nSend[iProcessor] = Rows_Send[iProcessor].size();
+  
+  MPI_Alltoall(nSend, 1, MPI_UNSIGNED_LONG, nRecv, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  
+  unsigned long *Recv_Offset = new unsigned long[size+1];
+  Recv_Offset[0] = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    Recv_Offset[iProcessor+1] = Recv_Offset[iProcessor] + nRecv[iProcessor];
+  vector<passivedouble> Rows_Recv(Recv_Offset[size]);
+  
+  MPI_Request *Request = new MPI_Request[2*size];
+  MPI_Status *Status = new MPI_Status[2*size];
+  int nRequest = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (nRecv[iProcessor] > 0)
+      SU2_MPI::Irecv(&Rows_Recv[Recv_Offset[iProcessor]], nRecv[iProcessor], MPI_DOUBLE,
+                     iProcessor, 0, MPI_COMM_WORLD, &Request[nRequest++]);
+    if (nSend[iProcessor] > 0)
+      SU2_MPI::Isend(&Rows_Send[iProcessor][0], nSend[iProcessor], MPI_DOUBLE,
+                     iProcessor, 0, MPI_COMM_WORLD, &Request[nRequest++]);
+  }
+  SU2_MPI::Waitall(nRequest, Request, Status);
   
-  ConvHist_file->open(cstr, ios::out);
-  ConvHist_file->precision(15);
+  delete [] nSend; delete [] nRecv; delete [] Recv_Offset;
+  delete [] Request; delete [] Status;
+  Rows_Send.clear();
   
-  /*--- Begin of the header ---*/
+  Block_Rows.resize(Block_nPoint*nFields);
+  for (iRow = 0; iRow < Rows_Recv.size(); iRow += nFields+1) {
+    Global_Index = (unsigned long)Rows_Recv[iRow];
+    copy(&Rows_Recv[iRow+1], &Rows_Recv[iRow+1]+nFields, &Block_Rows[(Global_Index-Block_Begin)*nFields]);
+  }
   
-  char begin[]= "\"Iteration\"";
+#else
   
-  /*--- Header for the coefficients ---*/
+  /*--- All the points are local and already sorted, they form one block ---*/
   
-  char flow_coeff[]= ",\"CLift\",\"CDrag\",\"CSideForce\",\"CMx\",\"CMy\",\"CMz\",\"CFx\",\"CFy\",\"CFz\",\"CL/CD\"";
-  char heat_coeff[]= ",\"HeatFlux_Total\",\"HeatFlux_Maximum\"";
-  char equivalent_area_coeff[]= ",\"CEquivArea\",\"CNearFieldOF\"";
-  char rotating_frame_coeff[]= ",\"CMerit\",\"CT\",\"CQ\"";
-  char free_surface_coeff[]= ",\"CFreeSurface\"";
-  char wave_coeff[]= ",\"CWave\"";
-  char fem_coeff[]= ",\"VM_Stress\"";
-  char adj_coeff[]= ",\"Sens_Geo\",\"Sens_Mach\",\"Sens_AoA\",\"Sens_Press\",\"Sens_Temp\",\"Sens_AoS\"";
-  char oneD_outputs[]= ",\"Avg_TotalPress\",\"Avg_Mach\",\"Avg_Temperature\",\"MassFlowRate\",\"FluxAvg_Pressure\",\"FluxAvg_Density\",\"FluxAvg_Velocity\",\"FluxAvg_Enthalpy\"";
-  char Cp_inverse_design[]= ",\"Cp_Diff\"";
-  char Heat_inverse_design[]= ",\"HeatFlux_Diff\"";
-  char mass_flow_rate[] = ",\"MassFlowRate\"";
-  char d_flow_coeff[] = ",\"D(CLift)\",\"D(CDrag)\",\"D(CSideForce)\",\"D(CMx)\",\"D(CMy)\",\"D(CMz)\",\"D(CFx)\",\"D(CFy)\",\"D(CFz)\",\"D(CL/CD)\"";
+  Block_Rows = Buffer;
   
-  /* Find the markers being monitored and create a header for them */
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    Monitoring_Tag = config->GetMarker_Monitoring(iMarker_Monitoring);
-    monitoring_coeff += ",\"CLift_"  + Monitoring_Tag + "\"";
-    monitoring_coeff += ",\"CDrag_"  + Monitoring_Tag + "\"";
-    monitoring_coeff += ",\"CSideForce_" + Monitoring_Tag + "\"";
-    monitoring_coeff += ",\"CL/CD_" + Monitoring_Tag + "\"";
-    monitoring_coeff += ",\"CFx_"    + Monitoring_Tag + "\"";
-    monitoring_coeff += ",\"CFy_"    + Monitoring_Tag + "\"";
-    monitoring_coeff += ",\"CFz_"    + Monitoring_Tag + "\"";
-    monitoring_coeff += ",\"CMx_"    + Monitoring_Tag + "\"";
-    monitoring_coeff += ",\"CMy_"    + Monitoring_Tag + "\"";
-    monitoring_coeff += ",\"CMz_"    + Monitoring_Tag + "\"";
-    aeroelastic_coeff += ",\"plunge_" + Monitoring_Tag + "\"";
-    aeroelastic_coeff += ",\"pitch_"  + Monitoring_Tag + "\"";
-  }
+#endif
   
-  /*--- Header for the residuals ---*/
+  Compress_Block(Block_Rows.data(), Block_nPoint, nFields, Tolerance, Stream);
   
-  char flow_resid[]= ",\"Res_Flow[0]\",\"Res_Flow[1]\",\"Res_Flow[2]\",\"Res_Flow[3]\",\"Res_Flow[4]\"";
-  char adj_flow_resid[]= ",\"Res_AdjFlow[0]\",\"Res_AdjFlow[1]\",\"Res_AdjFlow[2]\",\"Res_AdjFlow[3]\",\"Res_AdjFlow[4]\"";
-  switch (config->GetKind_Turb_Model()) {
-    case SA:	   SPRINTF (turb_resid, ",\"Res_Turb[0]\""); break;
-    case SA_NEG: SPRINTF (turb_resid, ",\"Res_Turb[0]\""); break;
+  /*--- Layout of the file: the tag, the number of fields, of points and of blocks, the names
+   of the fields (MAX_STRING_SIZE characters each), the tolerances of the fields, the table of
+   the blocks (first global index, number of points, byte offset and byte size) and the blocks. ---*/
+  
+  vector<unsigned long> Block_Size(nBlock, Stream.size()), Table(4*nBlock);
+  
+#ifdef HAVE_MPI
+  unsigned long Stream_Size = Stream.size();
+  SU2_MPI::Allgather(&Stream_Size, 1, MPI_UNSIGNED_LONG, Block_Size.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#endif
+  
+  unsigned long header[3] = {nFields, nPoint_Global, nBlock};
+  unsigned long offset = 8 + 3*sizeof(unsigned long) + nFields*MAX_STRING_SIZE + nFields*sizeof(passivedouble) + Table.size()*sizeof(unsigned long);
+  unsigned long Block_Offset = offset;
+  
+  for (iBlock = 0; iBlock < nBlock; iBlock++) {
+    Table[4*iBlock]   = iBlock*(nPoint_Global/nBlock) + min(iBlock, nPoint_Global%nBlock);
+    Table[4*iBlock+1] = nPoint_Global/nBlock + ((iBlock < nPoint_Global%nBlock) ? 1 : 0);
+    Table[4*iBlock+2] = offset;
+    Table[4*iBlock+3] = Block_Size[iBlock];
+    if (iBlock == (unsigned long)rank) Block_Offset = offset;
+    offset += Block_Size[iBlock];
+  }
+  
+  vector<char> Names(nFields*MAX_STRING_SIZE, '\0');
+  for (iField = 0; iField < nFields; iField++)
+    strncpy(&Names[iField*MAX_STRING_SIZE], Fields[iField].c_str(), MAX_STRING_SIZE-1);
+  
+#ifdef HAVE_MPI
+  
+  MPI_File fhw;
+  char fname[MAX_STRING_SIZE];
+  strncpy(fname, val_filename.c_str(), MAX_STRING_SIZE-1); fname[MAX_STRING_SIZE-1] = '\0';
+  
+  if (MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw) != MPI_SUCCESS) {
+    if (rank == MASTER_NODE) cout << "Unable to open the restart file " << val_filename << "." << endl;
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+  }
+  MPI_File_set_size(fhw, 0);
+  
+  if (rank == MASTER_NODE) {
+    char file_tag[] = "SU2RST02";
+    unsigned long pos = 8;
+    MPI_File_write_at(fhw, 0, file_tag, 8, MPI_CHAR, MPI_STATUS_IGNORE);
+    MPI_File_write_at(fhw, pos, header, 3, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE); pos += 3*sizeof(unsigned long);
+    MPI_File_write_at(fhw, pos, Names.data(), Names.size(), MPI_CHAR, MPI_STATUS_IGNORE); pos += Names.size();
+    MPI_File_write_at(fhw, pos, Tolerance.data(), nFields, MPI_DOUBLE, MPI_STATUS_IGNORE); pos += nFields*sizeof(passivedouble);
+    MPI_File_write_at(fhw, pos, Table.data(), Table.size(), MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+  }
+  
+  if (config->GetWrt_Async_Output()) {
+    
+    /*--- The block is written in the background, as the binary restart ---*/
+    
+    vector<char> *Snapshot = new vector<char>(Stream.begin(), Stream.end());
+    MPI_Request request;
+    MPI_File_iwrite_at(fhw, (MPI_Offset)Block_Offset, Snapshot->data(), Snapshot->size(), MPI_BYTE, &request);
+    Async_Buffer.push_back(Snapshot);
+    Async_File.push_back(fhw);
+    Async_Request.push_back(request);
+    
+  }
+  else {
+    MPI_File_write_at_all(fhw, (MPI_Offset)Block_Offset, Stream.data(), Stream.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+    MPI_File_close(&fhw);
+  }
+  
+#else
+  
+  ofstream restart_file(val_filename.c_str(), ios::out | ios::binary);
+  restart_file.write("SU2RST02", 8);
+  restart_file.write((char*)header, 3*sizeof(unsigned long));
+  restart_file.write(Names.data(), Names.size());
+  restart_file.write((char*)Tolerance.data(), nFields*sizeof(passivedouble));
+  restart_file.write((char*)Table.data(), Table.size()*sizeof(unsigned long));
+  restart_file.write((char*)Stream.data(), Stream.size());
+  restart_file.close();
+  
+#endif
+  
+}
+
+void COutput::GetLocal_Elements(CConfig *config, CGeometry *geometry, bool surf_sol, vector<CPrimalGrid*> &Elements) {
+  
+  unsigned short iNode, iMarker, nMarker = (surf_sol ? config->GetnMarker_All() : 1);
+  unsigned long iElem, nElem;
+  bool Wrt_Halo = config->GetWrt_Halo(), Wrt_Elem;
+  CPrimalGrid *Elem;
+  
+  /*--- Halo points, of the overlapping halo cells only one copy is kept
+   (the one of the higher rank) and the periodic points are handled as
+   when the connectivity is merged ---*/
+  
+  vector<bool> Halo;
+  geometry->GetHalo_Points(config, Halo, true);
+  
+  /*--- The volume elements or the boundary elements of the plotted markers,
+   without halo points unless they are requested ---*/
+  
+  Elements.clear();
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (surf_sol && (config->GetMarker_All_Plotting(iMarker) != YES)) continue;
+    nElem = (surf_sol ? geometry->GetnElem_Bound(iMarker) : geometry->GetnElem());
+    for (iElem = 0; iElem < nElem; iElem++) {
+      Elem = (surf_sol ? geometry->bound[iMarker][iElem] : geometry->elem[iElem]);
+      Wrt_Elem = true;
+      for (iNode = 0; iNode < Elem->GetnNodes(); iNode++)
+        if (Halo[Elem->GetNode(iNode)] && !Wrt_Halo) Wrt_Elem = false;
+      if (Wrt_Elem) Elements.push_back(Elem);
+    }
+  }
+  
+}
+
+void COutput::LoadLocal_PointData(CConfig *config, CGeometry *geometry, CSolver **solver, vector<unsigned long> &Point_List,
+                                  vector<string> &Fields, vector<float> &Values) {
+  
+  unsigned short iDim, iVar, iSol, nSol = 0, nDim = geometry->GetnDim();
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  unsigned long iPoint, jPoint, iField, nPoint_List = Point_List.size();
+  bool grid_movement  = config->GetGrid_Movement();
+  bool adjoint        = (config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint());
+  bool fem            = (Kind_Solver == FEM_ELASTICITY);
+  bool flow           = ((Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS));
+  bool compressible   = (config->GetKind_Regime() == COMPRESSIBLE);
+  su2double RefVel2 = 0.0, RefPressure = 0.0, factor = 0.0, Value;
+  CSolver *Sol[2];
+  char buffer[MAX_STRING_SIZE];
+  
+  /*--- Names of the point data, the solution of the solvers and the same
+   additional variables as the ASCII file for the flow solvers ---*/
+  
+  if (fem) { Sol[nSol++] = solver[FEA_SOL]; }
+  else if (adjoint) { Sol[nSol++] = solver[ADJFLOW_SOL]; }
+  else {
+    Sol[nSol++] = solver[FLOW_SOL];
+    if (Kind_Solver == RANS) Sol[nSol++] = solver[TURB_SOL];
+  }
+  
+  unsigned short nVar_Sol = 0;
+  for (iSol = 0; iSol < nSol; iSol++) nVar_Sol += Sol[iSol]->GetnVar();
+  
+  Fields.clear();
+  for (iVar = 0; iVar < nVar_Sol; iVar++) {
+    SPRINTF(buffer, fem ? "Displacement_%d" : "Conservative_%d", iVar+1);
+    Fields.push_back(buffer);
+  }
+  if (config->GetWrt_Limiters() && !fem) {
+    for (iVar = 0; iVar < nVar_Sol; iVar++) { SPRINTF(buffer, "Limiter_%d", iVar+1); Fields.push_back(buffer); }
+  }
+  if (grid_movement && !fem) {
+    Fields.push_back("Grid_Velx"); Fields.push_back("Grid_Vely");
+    if (nDim == 3) Fields.push_back("Grid_Velz");
+  }
+  if (flow) {
+    Fields.push_back("Pressure");
+    if (compressible) Fields.push_back("Temperature");
+    Fields.push_back("Pressure_Coefficient");
+    if (compressible) Fields.push_back("Mach");
+  }
+  if (flow && (Kind_Solver != EULER)) Fields.push_back("Laminar_Viscosity");
+  if (Kind_Solver == RANS) Fields.push_back("Eddy_Viscosity");
+  
+  /*--- Non-dimensionalization of the pressure coefficient ---*/
+  
+  if (flow) {
+    if (grid_movement) {
+      su2double Mach2Vel = sqrt(config->GetGamma()*config->GetGas_ConstantND()*config->GetTemperature_FreeStreamND());
+      RefVel2 = (config->GetMach_Motion()*Mach2Vel)*(config->GetMach_Motion()*Mach2Vel);
+    }
+    else {
+      for (iDim = 0; iDim < nDim; iDim++)
+        RefVel2 += solver[FLOW_SOL]->GetVelocity_Inf(iDim)*solver[FLOW_SOL]->GetVelocity_Inf(iDim);
+    }
+    RefPressure = solver[FLOW_SOL]->GetPressure_Inf();
+    factor = 1.0 / (0.5*solver[FLOW_SOL]->GetDensity_Inf()*config->GetRefAreaCoeff()*RefVel2);
+  }
+  
+  /*--- Values of the points of the list, one contiguous array per field ---*/
+  
+  Values.resize(Fields.size()*nPoint_List);
+  
+  for (jPoint = 0; jPoint < nPoint_List; jPoint++) {
+    iPoint = Point_List[jPoint];
+    
+    iField = 0;
+    for (iSol = 0; iSol < nSol; iSol++)
+      for (iVar = 0; iVar < Sol[iSol]->GetnVar(); iVar++)
+        Values[(iField++)*nPoint_List+jPoint] = float(SU2_TYPE::GetValue(Sol[iSol]->node[iPoint]->GetSolution(iVar)));
+    if (config->GetWrt_Limiters() && !fem) {
+      for (iSol = 0; iSol < nSol; iSol++)
+        for (iVar = 0; iVar < Sol[iSol]->GetnVar(); iVar++)
+          Values[(iField++)*nPoint_List+jPoint] = float(SU2_TYPE::GetValue(Sol[iSol]->node[iPoint]->GetLimiter(iVar)));
+    }
+    if (grid_movement && !fem) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        Values[(iField++)*nPoint_List+jPoint] = float(SU2_TYPE::GetValue(geometry->node[iPoint]->GetGridVel()[iDim]));
+    }
+    if (flow) {
+      CVariable *Flow_Node = solver[FLOW_SOL]->node[iPoint];
+      Value = (compressible ? Flow_Node->GetPressure() : Flow_Node->GetPressureInc());
+      Values[(iField++)*nPoint_List+jPoint] = float(SU2_TYPE::GetValue(Value));
+      if (compressible) Values[(iField++)*nPoint_List+jPoint] = float(SU2_TYPE::GetValue(Flow_Node->GetTemperature()));
+      Values[(iField++)*nPoint_List+jPoint] = float(SU2_TYPE::GetValue((Value - RefPressure)*factor*config->GetRefAreaCoeff()));
+      if (compressible) Values[(iField++)*nPoint_List+jPoint] = float(SU2_TYPE::GetValue(sqrt(Flow_Node->GetVelocity2())/Flow_Node->GetSoundSpeed()));
+      if (Kind_Solver != EULER) {
+        Value = (compressible ? Flow_Node->GetLaminarViscosity() : Flow_Node->GetLaminarViscosityInc());
+        Values[(iField++)*nPoint_List+jPoint] = float(SU2_TYPE::GetValue(Value));
+      }
+      if (Kind_Solver == RANS) {
+        Value = (compressible ? Flow_Node->GetEddyViscosity() : Flow_Node->GetEddyViscosityInc());
+        Values[(iField++)*nPoint_List+jPoint] = float(SU2_TYPE::GetValue(Value));
+      }
+    }
+  }
+  
+}
+
+void COutput::SetXDMF_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol) {
+  
+  unsigned short iDim, iNode, iGrid, nGrid, nDim = geometry->GetnDim();
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  unsigned long iPoint, iSorted, iElem, iField, nFields, nPointDomain = geometry->GetnPointDomain();
+  unsigned long nGlobal_Point = geometry->GetGlobal_nPointDomain(), nLocal_Elem[2], nGlobal_Elem_Grid[2], nLocal_Topo[2], nGlobal_Topo[2], Offset_Topo[2];
+  unsigned long Offset, Offset_Coord = 0, Offset_Field, Offset_Grid_Topo[2];
+  int rank = MASTER_NODE;
+  bool adjoint  = (config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint());
+  bool fem      = (Kind_Solver == FEM_ELASTICITY);
+  bool unsteady = ((config->GetUnsteady_Simulation() && config->GetWrt_Unsteady()) ||
+                   (config->GetDynamic_Analysis() && config->GetWrt_Dynamic()));
+  vector<string> Fields;
+  char buffer[MAX_STRING_SIZE];
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- One heavy data file (raw binary) and one XDMF index per zone, the time steps of
+   an unsteady run are appended to the same files during the run. ---*/
+  
+  string filename;
+  if (fem) filename = config->GetStructure_FileName();
+  else if (adjoint) filename = config->GetAdj_FileName();
+  else filename = config->GetFlow_FileName();
+  
+  if (val_nZone > 1) {
+    SPRINTF (buffer, "_%d", SU2_TYPE::Int(val_iZone));
+    filename.append(buffer);
+  }
+  
+  string data_filename = filename + ".bin";
+  string index_filename = filename + ".xmf";
+  string data_basename = data_filename.substr(data_filename.find_last_of('/')+1);
+  
+  bool first_output = (Xdmf_Grids.find(index_filename) == Xdmf_Grids.end());
+  
+  /*--- The first output of a restarted unsteady run continues the files of the previous
+   run: the master node recovers the grids of its time steps from the existing index ---*/
+  
+  int restart_append = 0;
+  if (unsteady && first_output && config->GetRestart() && (rank == MASTER_NODE)) {
+    ifstream Index_File(index_filename.c_str(), ios::in);
+    ifstream Data_File(data_filename.c_str(), ios::in | ios::binary);
+    if (Index_File.is_open() && Data_File.is_open()) {
+      ostringstream Index_Str;
+      Index_Str << Index_File.rdbuf();
+      string Index_Text = Index_Str.str(), Series = "CollectionType=\"Temporal\">\n", Series_End = "</Grid>\n</Domain>";
+      size_t Grids_Begin = Index_Text.find(Series), Grids_End = Index_Text.rfind(Series_End);
+      if ((Grids_Begin != string::npos) && (Grids_End != string::npos) && (Grids_Begin+Series.size() <= Grids_End)) {
+        Xdmf_Grids[index_filename] = Index_Text.substr(Grids_Begin+Series.size(), Grids_End-Grids_Begin-Series.size());
+        restart_append = 1;
+      }
+    }
+  }
+#ifdef HAVE_MPI
+  if (unsteady && first_output && config->GetRestart())
+    MPI_Bcast(&restart_append, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+  
+  /*--- The mesh is written with the first output of the run, the items of the
+   previous run are not kept, and after every output if the grid moves ---*/
+  
+  bool append = (unsteady && (!first_output || (restart_append == 1)));
+  bool wrt_mesh = (!append || first_output || config->GetGrid_Movement());
+  
+  /*--- Owned points ordered by global index, their rows in the global datasets ---*/
+  
+  vector<pair<unsigned long, unsigned long> > Sorted_Points(nPointDomain);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Sorted_Points[iPoint] = make_pair(geometry->node[iPoint]->GetGlobalIndex(), iPoint);
+  sort(Sorted_Points.begin(), Sorted_Points.end());
+  
+  vector<unsigned long> Point_List(nPointDomain);
+  for (iSorted = 0; iSorted < nPointDomain; iSorted++)
+    Point_List[iSorted] = Sorted_Points[iSorted].second;
+  
+  vector<float> Coords_Local(3*nPointDomain, 0.0), Values_Local;
+  for (iSorted = 0; iSorted < nPointDomain; iSorted++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coords_Local[3*iSorted+iDim] = float(SU2_TYPE::GetValue(geometry->node[Point_List[iSorted]]->GetCoord(iDim)));
+  
+  LoadLocal_PointData(config, geometry, solver, Point_List, Fields, Values_Local);
+  nFields = Fields.size();
+  
+  /*--- Mixed topology of the volume and of the plotted surfaces in global numbering:
+   XDMF type of the element followed by its nodes (a polyline also needs its number of nodes) ---*/
+  
+  nGrid = (surf_sol ? 2 : 1);
+  vector<unsigned long> Topo_Local[2];
+  vector<CPrimalGrid*> Elements;
+  
+  for (iGrid = 0; iGrid < nGrid; iGrid++) {
+    GetLocal_Elements(config, geometry, (iGrid == 1), Elements);
+    nLocal_Elem[iGrid] = Elements.size();
+    for (iElem = 0; iElem < Elements.size(); iElem++) {
+      switch (Elements[iElem]->GetVTK_Type()) {
+        case LINE:          Topo_Local[iGrid].push_back(2); Topo_Local[iGrid].push_back(2); break;
+        case TRIANGLE:      Topo_Local[iGrid].push_back(4); break;
+        case QUADRILATERAL: Topo_Local[iGrid].push_back(5); break;
+        case TETRAHEDRON:   Topo_Local[iGrid].push_back(6); break;
+        case PYRAMID:       Topo_Local[iGrid].push_back(7); break;
+        case PRISM:         Topo_Local[iGrid].push_back(8); break;
+        case HEXAHEDRON:    Topo_Local[iGrid].push_back(9); break;
+      }
+      for (iNode = 0; iNode < Elements[iElem]->GetnNodes(); iNode++)
+        Topo_Local[iGrid].push_back(geometry->node[Elements[iElem]->GetNode(iNode)]->GetGlobalIndex());
+    }
+    nLocal_Topo[iGrid] = Topo_Local[iGrid].size();
+  }
+  
+  /*--- Global sizes and position of the topology of this rank ---*/
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(nLocal_Elem, nGlobal_Elem_Grid, nGrid, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(nLocal_Topo, nGlobal_Topo, nGrid, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Exscan(nLocal_Topo, Offset_Topo, nGrid, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  if (rank == MASTER_NODE) { Offset_Topo[0] = 0; Offset_Topo[1] = 0; }
+#else
+  for (iGrid = 0; iGrid < nGrid; iGrid++) {
+    nGlobal_Elem_Grid[iGrid] = nLocal_Elem[iGrid]; nGlobal_Topo[iGrid] = nLocal_Topo[iGrid]; Offset_Topo[iGrid] = 0;
+  }
+#endif
+  
+  /*--- Layout of this output in the heavy data file, after the previous time steps:
+   the coordinates and the topologies (only when the mesh changes), then the fields ---*/
+  
+#ifdef HAVE_MPI
+  
+  MPI_File fhw;
+  MPI_Offset file_size;
+  char fname[MAX_STRING_SIZE], native[] = "native";
+  strncpy(fname, data_filename.c_str(), MAX_STRING_SIZE-1); fname[MAX_STRING_SIZE-1] = '\0';
+  
+  if (MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw) != MPI_SUCCESS) {
+    if (rank == MASTER_NODE) cout << "Unable to open the XDMF data file " << data_filename << "." << endl;
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+  }
+  if (!append) MPI_File_set_size(fhw, 0);
+  MPI_File_get_size(fhw, &file_size);
+  Offset = file_size;
+  
+#else
+  
+  fstream data_file;
+  if (!append) data_file.open(data_filename.c_str(), ios::out | ios::binary | ios::trunc);
+  else data_file.open(data_filename.c_str(), ios::out | ios::binary | ios::in | ios::ate);
+  if (!data_file.is_open()) {
+    cout << "Unable to open the XDMF data file " << data_filename << "." << endl;
+    exit(EXIT_FAILURE);
+  }
+  Offset = data_file.tellp();
+  
+#endif
+  
+  if (wrt_mesh) {
+    Offset_Coord = Offset;
+    Offset += 3*nGlobal_Point*sizeof(float);
+    for (iGrid = 0; iGrid < nGrid; iGrid++) {
+      Offset_Grid_Topo[iGrid] = Offset;
+      Offset += nGlobal_Topo[iGrid]*sizeof(unsigned long);
+    }
+  }
+  Offset_Field = Offset;
+  
+  /*--- Collective writes, every rank writes its own rows (points) and its
+   contiguous part of the topologies. ---*/
+  
+#ifdef HAVE_MPI
+  
+  /*--- Byte displacements of the point rows, the global index of large meshes does not fit in an int ---*/
+  
+  MPI_Datatype rowtype, pointtype, filetype;
+  vector<MPI_Aint> Displ(nPointDomain);
+  
+  if (wrt_mesh) {
+    for (iSorted = 0; iSorted < nPointDomain; iSorted++)
+      Displ[iSorted] = (MPI_Aint)(Sorted_Points[iSorted].first*3*sizeof(float));
+    MPI_Type_contiguous(3, MPI_FLOAT, &rowtype);
+    MPI_Type_create_hindexed_block(Displ.size(), 1, Displ.data(), rowtype, &filetype);
+    MPI_Type_commit(&filetype);
+    MPI_File_set_view(fhw, (MPI_Offset)Offset_Coord, MPI_FLOAT, filetype, native, MPI_INFO_NULL);
+    MPI_File_write_all(fhw, Coords_Local.data(), Coords_Local.size(), MPI_FLOAT, MPI_STATUS_IGNORE);
+    MPI_Type_free(&filetype);
+    MPI_Type_free(&rowtype);
+    
+    for (iGrid = 0; iGrid < nGrid; iGrid++) {
+      MPI_File_set_view(fhw, (MPI_Offset)Offset_Grid_Topo[iGrid], MPI_UNSIGNED_LONG, MPI_UNSIGNED_LONG, native, MPI_INFO_NULL);
+      MPI_File_write_at_all(fhw, (MPI_Offset)Offset_Topo[iGrid], Topo_Local[iGrid].data(), nLocal_Topo[iGrid],
+                            MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+    }
+  }
+  
+  /*--- All the fields in one call, a copy of the point rows for each field ---*/
+  
+  for (iSorted = 0; iSorted < nPointDomain; iSorted++)
+    Displ[iSorted] = (MPI_Aint)(Sorted_Points[iSorted].first*sizeof(float));
+  MPI_Type_create_hindexed_block(Displ.size(), 1, Displ.data(), MPI_FLOAT, &pointtype);
+  MPI_Type_create_hvector(nFields, 1, (MPI_Aint)(nGlobal_Point*sizeof(float)), pointtype, &filetype);
+  MPI_Type_commit(&filetype);
+  MPI_File_set_view(fhw, (MPI_Offset)Offset_Field, MPI_FLOAT, filetype, native, MPI_INFO_NULL);
+  MPI_File_write_all(fhw, Values_Local.data(), Values_Local.size(), MPI_FLOAT, MPI_STATUS_IGNORE);
+  MPI_Type_free(&filetype);
+  MPI_Type_free(&pointtype);
+  
+  MPI_File_close(&fhw);
+  
+#else
+  
+  if (wrt_mesh) {
+    data_file.write((char *)Coords_Local.data(), Coords_Local.size()*sizeof(float));
+    for (iGrid = 0; iGrid < nGrid; iGrid++)
+      data_file.write((char *)Topo_Local[iGrid].data(), nLocal_Topo[iGrid]*sizeof(unsigned long));
+  }
+  data_file.write((char *)Values_Local.data(), Values_Local.size()*sizeof(float));
+  data_file.close();
+  
+#endif
+  
+  /*--- The master node writes the index, with the grids of all the
+   time steps of the run that have been written so far ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    ostringstream Mesh, Grid;
+    string Grid_Name[2] = {"Volume", "Surface"};
+    
+    /*--- Geometry and topology, written with this output or with a previous one ---*/
+    
+    if (wrt_mesh) {
+      for (iGrid = 0; iGrid < nGrid; iGrid++) {
+        Mesh << "<Topology TopologyType=\"Mixed\" NumberOfElements=\"" << nGlobal_Elem_Grid[iGrid] << "\">\n";
+        Mesh << "<DataItem Dimensions=\"" << nGlobal_Topo[iGrid] << "\" NumberType=\"Int\" Precision=\"" << sizeof(unsigned long);
+        Mesh << "\" Format=\"Binary\" Endian=\"Native\" Seek=\"" << Offset_Grid_Topo[iGrid] << "\">" << data_basename << "</DataItem>\n";
+        Mesh << "</Topology>\n";
+        Mesh << "<Geometry GeometryType=\"XYZ\">\n";
+        Mesh << "<DataItem Dimensions=\"" << nGlobal_Point << " 3\" NumberType=\"Float\" Precision=\"4\"";
+        Mesh << " Format=\"Binary\" Endian=\"Native\" Seek=\"" << Offset_Coord << "\">" << data_basename << "</DataItem>\n";
+        Mesh << "</Geometry>\n";
+        Mesh << char(0);
+      }
+      Xdmf_Mesh[index_filename] = Mesh.str();
+    }
+    
+    string Mesh_Str = Xdmf_Mesh[index_filename];
+    
+    /*--- Grids of this output: the mesh and the fields ---*/
+    
+    if (nGrid > 1) Grid << "<Grid Name=\"Iteration " << config->GetExtIter() << "\" GridType=\"Collection\" CollectionType=\"Spatial\">\n";
+    if (unsteady) Grid << "<Time Value=\"" << (config->GetUnsteady_Simulation() ? SU2_TYPE::GetValue(config->GetCurrent_UnstTime()) : double(config->GetExtIter())) << "\"/>\n";
+    
+    size_t Mesh_Begin = 0, Mesh_End;
+    for (iGrid = 0; iGrid < nGrid; iGrid++) {
+      Mesh_End = Mesh_Str.find(char(0), Mesh_Begin);
+      Grid << "<Grid Name=\"" << Grid_Name[iGrid] << "\" GridType=\"Uniform\">\n";
+      if ((nGrid == 1) && unsteady) Grid << "<Time Value=\"" << (config->GetUnsteady_Simulation() ? SU2_TYPE::GetValue(config->GetCurrent_UnstTime()) : double(config->GetExtIter())) << "\"/>\n";
+      Grid << Mesh_Str.substr(Mesh_Begin, Mesh_End-Mesh_Begin);
+      for (iField = 0; iField < nFields; iField++) {
+        Grid << "<Attribute Name=\"" << Fields[iField] << "\" AttributeType=\"Scalar\" Center=\"Node\">\n";
+        Grid << "<DataItem Dimensions=\"" << nGlobal_Point << "\" NumberType=\"Float\" Precision=\"4\" Format=\"Binary\" Endian=\"Native\" Seek=\"";
+        Grid << Offset_Field + iField*nGlobal_Point*sizeof(float) << "\">" << data_basename << "</DataItem>\n";
+        Grid << "</Attribute>\n";
+      }
+      Grid << "</Grid>\n";
+      Mesh_Begin = Mesh_End+1;
+    }
+    if (nGrid > 1) Grid << "</Grid>\n";
+    
+    if (append) Xdmf_Grids[index_filename] += Grid.str();
+    else Xdmf_Grids[index_filename] = Grid.str();
+    
+    ofstream Index_File(index_filename.c_str(), ios::out);
+    Index_File << "<?xml version=\"1.0\" ?>\n";
+    Index_File << "<Xdmf Version=\"2.0\">\n";
+    Index_File << "<Domain>\n";
+    if (unsteady) Index_File << "<Grid Name=\"Time Series\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+    Index_File << Xdmf_Grids[index_filename];
+    if (unsteady) Index_File << "</Grid>\n";
+    Index_File << "</Domain>\n";
+    Index_File << "</Xdmf>\n";
+    Index_File.close();
+    
+  }
+  
+  /*--- The other ranks only need to know that the run has started the files ---*/
+  
+  if (rank != MASTER_NODE) Xdmf_Grids[index_filename] = "";
+  
+}
+
+void COutput::SetFastOutput_Locate(CConfig *config, CGeometry *geometry, unsigned short val_iZone) {
+  
+  unsigned short iDim, iMarker, iMarker_FastOutput, iProbe, iPlane, nDim = geometry->GetnDim();
+  unsigned long iPoint, jPoint, iVertex, iEdge, pointID;
+  su2double dist, Dist_i, Dist_j, *Origin, *Normal;
+  int rankID, rank = MASTER_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Owned vertices of the markers of the surface stream ---*/
+  
+  FastOutput_Surface[val_iZone].clear();
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    for (iMarker_FastOutput = 0; iMarker_FastOutput < config->GetnMarker_FastOutput(); iMarker_FastOutput++) {
+      if (config->GetMarker_All_TagBound(iMarker) != config->GetMarker_FastOutput(iMarker_FastOutput)) continue;
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (geometry->node[iPoint]->GetDomain())
+          FastOutput_Surface[val_iZone].push_back(make_pair(iMarker, iVertex));
+      }
+    }
+  }
+  
+  /*--- Probes, each rank searches the nearest of its own points (local ADT) and
+   only the rank with the smallest distance, the lowest one for ties, stores it ---*/
+  
+  struct Probe_Location { passivedouble value; int rank; };
+  Probe_Location *Probe_Dist = new Probe_Location[config->GetnProbe()];
+  for (iProbe = 0; iProbe < config->GetnProbe(); iProbe++) {
+    Probe_Dist[iProbe].value = numeric_limits<passivedouble>::max();
+    Probe_Dist[iProbe].rank = rank;
+  }
+  
+  FastOutput_Probe[val_iZone].assign(config->GetnProbe(), -1);
+  
+  if ((config->GetnProbe() > 0) && (geometry->GetnPointDomain() > 0)) {
+    
+    vector<su2double> Coord_Domain(nDim*geometry->GetnPointDomain());
+    vector<unsigned long> Point_Domain(geometry->GetnPointDomain());
+    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+      Point_Domain[iPoint] = iPoint;
+      for (iDim = 0; iDim < nDim; iDim++)
+        Coord_Domain[iPoint*nDim+iDim] = geometry->node[iPoint]->GetCoord(iDim);
+    }
+    
+    su2_adtPointsOnlyClass PointADT(nDim, Point_Domain.size(), Coord_Domain.data(), Point_Domain.data(), false);
+    
+    for (iProbe = 0; iProbe < config->GetnProbe(); iProbe++) {
+      PointADT.DetermineNearestNode(config->GetProbe_Coord(iProbe), dist, pointID, rankID);
+      FastOutput_Probe[val_iZone][iProbe] = pointID;
+      Probe_Dist[iProbe].value = SU2_TYPE::GetValue(dist);
+    }
+    
+  }
+  
+#ifdef HAVE_MPI
+  if (config->GetnProbe() > 0) {
+    Probe_Location *Probe_Min = new Probe_Location[config->GetnProbe()];
+    MPI_Allreduce(Probe_Dist, Probe_Min, config->GetnProbe(), MPI_DOUBLE_INT, MPI_MINLOC, MPI_COMM_WORLD);
+    for (iProbe = 0; iProbe < config->GetnProbe(); iProbe++)
+      if (Probe_Min[iProbe].rank != rank) FastOutput_Probe[val_iZone][iProbe] = -1;
+    delete [] Probe_Min;
+  }
+#endif
+  
+  delete [] Probe_Dist;
+  
+  /*--- Sampling planes, edges cut by the plane and weight of their second point,
+   an edge is kept by the rank that owns its point of lower global index ---*/
+  
+  FastOutput_Plane_Edge[val_iZone].clear();
+  FastOutput_Plane_Weight[val_iZone].clear();
+  FastOutput_Plane[val_iZone].clear();
+  
+  for (iPlane = 0; iPlane < config->GetnPlane_Sample(); iPlane++) {
+    Origin = config->GetPlane_Sample_Origin(iPlane);
+    Normal = config->GetPlane_Sample_Normal(iPlane);
+    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      if (geometry->node[iPoint]->GetGlobalIndex() < geometry->node[jPoint]->GetGlobalIndex()) {
+        if (!geometry->node[iPoint]->GetDomain()) continue;
+      }
+      else if (!geometry->node[jPoint]->GetDomain()) continue;
+      Dist_i = 0.0; Dist_j = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Dist_i += (geometry->node[iPoint]->GetCoord(iDim) - Origin[iDim])*Normal[iDim];
+        Dist_j += (geometry->node[jPoint]->GetCoord(iDim) - Origin[iDim])*Normal[iDim];
+      }
+      if ((Dist_i > 0.0) != (Dist_j > 0.0)) {
+        FastOutput_Plane_Edge[val_iZone].push_back(iPoint);
+        FastOutput_Plane_Edge[val_iZone].push_back(jPoint);
+        FastOutput_Plane_Weight[val_iZone].push_back(Dist_i/(Dist_i-Dist_j));
+        FastOutput_Plane[val_iZone].push_back(iPlane);
+      }
+    }
+  }
+  
+}
+
+void COutput::SetFastOutput_Files(CSolver ****solver_container, CGeometry ***geometry, CConfig **config,
+                                  unsigned long iExtIter, unsigned short val_nZone) {
+  
+  unsigned short iZone, iDim, iVar, iProbe, nDim, nVar, nVar_Surf, nVar_Sample, iMarker;
+  unsigned long iPoint, jPoint, iVertex, iSurf, iSample, nSurf, nSample;
+  int rank = MASTER_NODE;
+  su2double Weight;
+  char buffer[MAX_STRING_SIZE];
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- The output locations are found at the first call, again at every call
+   when the grid moves, and the files of the run are started ---*/
+  
+  bool new_file = FastOutput_Probe.empty();
+  if (new_file) {
+    FastOutput_Surface.resize(val_nZone);
+    FastOutput_Probe.resize(val_nZone);
+    FastOutput_Plane_Edge.resize(val_nZone);
+    FastOutput_Plane_Weight.resize(val_nZone);
+    FastOutput_Plane.resize(val_nZone);
+  }
+  
+  for (iZone = 0; iZone < val_nZone; iZone++) {
+    
+    CGeometry *Geometry = geometry[iZone][MESH_0];
+    CSolver *FlowSolver = solver_container[iZone][MESH_0][FLOW_SOL];
+    bool grid_movement = config[iZone]->GetGrid_Movement();
+    bool compressible = (config[iZone]->GetKind_Regime() == COMPRESSIBLE);
+    bool viscous = ((config[iZone]->GetKind_Solver() == NAVIER_STOKES) || (config[iZone]->GetKind_Solver() == RANS));
+    bool wrt_mesh = (new_file || grid_movement);
+    su2double Time = (config[iZone]->GetUnsteady_Simulation() ? config[iZone]->GetCurrent_UnstTime() : su2double(iExtIter));
+    
+    if (wrt_mesh) SetFastOutput_Locate(config[iZone], Geometry, iZone);
+    
+    nDim = Geometry->GetnDim();
+    nVar = FlowSolver->GetnVar();
+    nSurf = FastOutput_Surface[iZone].size();
+    nSample = FastOutput_Plane[iZone].size();
+    nVar_Surf = (viscous ? 3+nDim : 2);
+    nVar_Sample = nVar+1;
+    
+    string filename = config[iZone]->GetFastOutput_FileName();
+    if (val_nZone > 1) {
+      SPRINTF (buffer, "_%d", SU2_TYPE::Int(iZone));
+      filename.append(buffer);
+    }
+    
+    /*--- Surface stream and plane samples of this rank. A record is written at every output:
+     header (unsigned long iteration, nDim, mesh flag, number of surface points and of their values,
+     number of samples and of their values, double time), if the mesh flag is set the global index (unsigned long)
+     and the coordinates (float) of the surface points, the coordinates (float) of the samples and their plane
+     (unsigned long), then the values (float, point by point) of the surface points and of the samples. ---*/
+    
+    if ((nSurf > 0) || (nSample > 0)) {
+      
+      vector<unsigned long> Header(7), Surf_Index, Sample_Plane;
+      vector<float> Surf_Coord, Sample_Coord, Surf_Values(nSurf*nVar_Surf), Sample_Values(nSample*nVar_Sample);
+      double Time_Value = SU2_TYPE::GetValue(Time);
+      
+      Header[0] = iExtIter; Header[1] = nDim; Header[2] = wrt_mesh;
+      Header[3] = nSurf; Header[4] = nVar_Surf; Header[5] = nSample; Header[6] = nVar_Sample;
+      
+      for (iSurf = 0; iSurf < nSurf; iSurf++) {
+        iMarker = FastOutput_Surface[iZone][iSurf].first;
+        iVertex = FastOutput_Surface[iZone][iSurf].second;
+        iPoint = Geometry->vertex[iMarker][iVertex]->GetNode();
+        if (wrt_mesh) {
+          Surf_Index.push_back(Geometry->node[iPoint]->GetGlobalIndex());
+          for (iDim = 0; iDim < nDim; iDim++)
+            Surf_Coord.push_back(float(SU2_TYPE::GetValue(Geometry->node[iPoint]->GetCoord(iDim))));
+        }
+        float *Values = &Surf_Values[iSurf*nVar_Surf];
+        Values[0] = float(SU2_TYPE::GetValue(compressible ? FlowSolver->node[iPoint]->GetPressure() : FlowSolver->node[iPoint]->GetPressureInc()));
+        Values[1] = float(SU2_TYPE::GetValue(FlowSolver->GetCPressure(iMarker, iVertex)));
+        if (viscous) {
+          for (iDim = 0; iDim < nDim; iDim++)
+            Values[2+iDim] = float(SU2_TYPE::GetValue(FlowSolver->GetCSkinFriction(iMarker, iVertex, iDim)));
+          Values[2+nDim] = float(SU2_TYPE::GetValue(FlowSolver->GetHeatFlux(iMarker, iVertex)));
+        }
+      }
+      
+      for (iSample = 0; iSample < nSample; iSample++) {
+        iPoint = FastOutput_Plane_Edge[iZone][2*iSample];
+        jPoint = FastOutput_Plane_Edge[iZone][2*iSample+1];
+        Weight = FastOutput_Plane_Weight[iZone][iSample];
+        if (wrt_mesh) {
+          Sample_Plane.push_back(FastOutput_Plane[iZone][iSample]);
+          for (iDim = 0; iDim < nDim; iDim++)
+            Sample_Coord.push_back(float(SU2_TYPE::GetValue((1.0-Weight)*Geometry->node[iPoint]->GetCoord(iDim) +
+                                                            Weight*Geometry->node[jPoint]->GetCoord(iDim))));
+        }
+        float *Values = &Sample_Values[iSample*nVar_Sample];
+        for (iVar = 0; iVar < nVar; iVar++)
+          Values[iVar] = float(SU2_TYPE::GetValue((1.0-Weight)*FlowSolver->node[iPoint]->GetSolution(iVar) +
+                                                  Weight*FlowSolver->node[jPoint]->GetSolution(iVar)));
+        if (compressible)
+          Values[nVar] = float(SU2_TYPE::GetValue((1.0-Weight)*FlowSolver->node[iPoint]->GetPressure() + Weight*FlowSolver->node[jPoint]->GetPressure()));
+        else
+          Values[nVar] = float(SU2_TYPE::GetValue((1.0-Weight)*FlowSolver->node[iPoint]->GetPressureInc() + Weight*FlowSolver->node[jPoint]->GetPressureInc()));
+      }
+      
+      SPRINTF (buffer, "_%d.dat", rank);
+      ofstream Stream_File((filename + buffer).c_str(), ios::out | ios::binary | (new_file ? ios::trunc : ios::app));
+      Stream_File.write((char *)Header.data(), Header.size()*sizeof(unsigned long));
+      Stream_File.write((char *)&Time_Value, sizeof(double));
+      if (wrt_mesh) {
+        Stream_File.write((char *)Surf_Index.data(), Surf_Index.size()*sizeof(unsigned long));
+        Stream_File.write((char *)Surf_Coord.data(), Surf_Coord.size()*sizeof(float));
+        Stream_File.write((char *)Sample_Coord.data(), Sample_Coord.size()*sizeof(float));
+        Stream_File.write((char *)Sample_Plane.data(), Sample_Plane.size()*sizeof(unsigned long));
+      }
+      Stream_File.write((char *)Surf_Values.data(), Surf_Values.size()*sizeof(float));
+      Stream_File.write((char *)Sample_Values.data(), Sample_Values.size()*sizeof(float));
+      Stream_File.close();
+      
+    }
+    
+    /*--- Probes, the owner of each probe sends its values to the master node,
+     which appends one line per output to the file of the run ---*/
+    
+    if (config[iZone]->GetnProbe() > 0) {
+      
+      unsigned long nProbe_Values = config[iZone]->GetnProbe()*nVar_Sample;
+      vector<double> Probe_Values(nProbe_Values, 0.0), Probe_Values_Global(nProbe_Values, 0.0);
+      
+      for (iProbe = 0; iProbe < config[iZone]->GetnProbe(); iProbe++) {
+        if (FastOutput_Probe[iZone][iProbe] < 0) continue;
+        iPoint = FastOutput_Probe[iZone][iProbe];
+        for (iVar = 0; iVar < nVar; iVar++)
+          Probe_Values[iProbe*nVar_Sample+iVar] = SU2_TYPE::GetValue(FlowSolver->node[iPoint]->GetSolution(iVar));
+        Probe_Values[iProbe*nVar_Sample+nVar] = SU2_TYPE::GetValue(compressible ? FlowSolver->node[iPoint]->GetPressure() : FlowSolver->node[iPoint]->GetPressureInc());
+      }
+      
+#ifdef HAVE_MPI
+      SU2_MPI::Reduce(Probe_Values.data(), Probe_Values_Global.data(), nProbe_Values, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+#else
+      Probe_Values_Global = Probe_Values;
+#endif
+      
+      if (rank == MASTER_NODE) {
+        ofstream Probe_File((filename + "_probes.csv").c_str(), ios::out | (new_file ? ios::trunc : ios::app));
+        Probe_File.precision(15);
+        if (new_file) {
+          Probe_File << "\"Iteration\", \"Time\"";
+          for (iProbe = 0; iProbe < config[iZone]->GetnProbe(); iProbe++) {
+            for (iVar = 0; iVar < nVar; iVar++) Probe_File << ", \"Probe_" << iProbe+1 << "_Conservative_" << iVar+1 << "\"";
+            Probe_File << ", \"Probe_" << iProbe+1 << "_Pressure\"";
+          }
+          Probe_File << "\n";
+        }
+        Probe_File << iExtIter << ", " << scientific << SU2_TYPE::GetValue(Time);
+        for (iSample = 0; iSample < nProbe_Values; iSample++)
+          Probe_File << ", " << Probe_Values_Global[iSample];
+        Probe_File << "\n";
+        Probe_File.close();
+      }
+      
+    }
+    
+  }
+  
+}
+
+void COutput::SetTiming_History(CSolver ****solver_container, CConfig **config, unsigned long iExtIter,
+                                unsigned short val_nZone, bool val_last) {
+  
+  unsigned short iZone, iPhase, iVar, Phase;
+  int rank = MASTER_NODE;
+  passivedouble Time[N_TIMING_PHASES+1], Time_Max[N_TIMING_PHASES+1];
+  char buffer[MAX_STRING_SIZE];
+  
+  const char *Phase_Name[N_TIMING_PHASES] = {"Other", "Preprocessing", "Gradient", "Limiter", "Convective",
+    "Viscous", "Source", "Linear_Solver", "Halo", "Output"};
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Time of the phases of the iteration in all the zones, the current
+   phase is interrupted to add its time. The last entry is the total ---*/
+  
+  for (iPhase = 0; iPhase <= N_TIMING_PHASES; iPhase++) Time[iPhase] = 0.0;
+  
+  for (iZone = 0; iZone < val_nZone; iZone++) {
+    Phase = config[iZone]->Start_Phase(PHASE_OTHER);
+    config[iZone]->Stop_Phase(Phase);
+    for (iPhase = 0; iPhase < N_TIMING_PHASES; iPhase++) {
+      Time[iPhase] += config[iZone]->GetPhase_Time(iPhase);
+      Time[N_TIMING_PHASES] += config[iZone]->GetPhase_Time(iPhase);
+    }
+    config[iZone]->Reset_Phase_Time();
+  }
+  
+  /*--- The slowest rank sets the time of the iteration ---*/
+  
+#ifdef HAVE_MPI
+  MPI_Reduce(Time, Time_Max, N_TIMING_PHASES+1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  for (iPhase = 0; iPhase <= N_TIMING_PHASES; iPhase++) Time_Max[iPhase] = Time[iPhase];
+#endif
+  
+  if (rank != MASTER_NODE) return;
+  
+  unsigned short Kind_Solver = config[ZONE_0]->GetKind_Solver();
+  bool flow = ((Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS));
+  CSolver *FlowSolver = (flow ? solver_container[ZONE_0][MESH_0][FLOW_SOL] : NULL);
+  
+  /*--- Columns of the file, written once at the start of the run ---*/
+  
+  string filename = config[ZONE_0]->GetTiming_FileName() + ".csv";
+  
+  if (Timing_Offset == 0) {
+    ostringstream Header;
+    Header << "\"Iteration\", \"Time\"";
+    for (iPhase = 0; iPhase < N_TIMING_PHASES; iPhase++) Header << ", \"Time_" << Phase_Name[iPhase] << "\"";
+    Header << ", \"Linear_Iter\", \"CFL\"";
+    if (flow) {
+      for (iVar = 0; iVar < FlowSolver->GetnVar(); iVar++) Header << ", \"Res_Flow[" << iVar << "]\"";
+      Header << ", \"CLift\", \"CDrag\"";
+    }
+    Header << "\n";
+    ofstream Timing_File(filename.c_str(), ios::out | ios::trunc);
+    Timing_File << Header.str();
+    Timing_File.close();
+    Timing_Offset = Header.str().size();
+  }
+  
+  /*--- Add the row of the iteration ---*/
+  
+  SPRINTF(buffer, "%lu, %.6e", iExtIter, Time_Max[N_TIMING_PHASES]);
+  Timing_Buffer += buffer;
+  for (iPhase = 0; iPhase < N_TIMING_PHASES; iPhase++) {
+    SPRINTF(buffer, ", %.6e", Time_Max[iPhase]);
+    Timing_Buffer += buffer;
+  }
+  SPRINTF(buffer, ", %u, %.6e", (flow ? (unsigned int)FlowSolver->GetIterLinSolver() : 0u),
+          SU2_TYPE::GetValue(config[ZONE_0]->GetCFL(MESH_0)));
+  Timing_Buffer += buffer;
+  if (flow) {
+    for (iVar = 0; iVar < FlowSolver->GetnVar(); iVar++) {
+      SPRINTF(buffer, ", %.8e", log10(SU2_TYPE::GetValue(FlowSolver->GetRes_RMS(iVar))));
+      Timing_Buffer += buffer;
+    }
+    SPRINTF(buffer, ", %.10e, %.10e", SU2_TYPE::GetValue(FlowSolver->GetTotal_CLift()),
+            SU2_TYPE::GetValue(FlowSolver->GetTotal_CDrag()));
+    Timing_Buffer += buffer;
+  }
+  Timing_Buffer += "\n";
+  
+  /*--- The rows are written in blocks of about 64 KB, so that the history
+   does not add a file access to every iteration ---*/
+  
+  if (!val_last && (Timing_Buffer.size() < 65536)) return;
+  
+#ifdef HAVE_MPI
+  if (config[ZONE_0]->GetWrt_Async_Output()) {
+    
+    /*--- The block is written in the background from a snapshot, the file
+     is completed with the other background writes (SetAsync_Flush) ---*/
+    
+    MPI_File fhw;
+    MPI_Request request;
+    
+    if (MPI_File_open(MPI_COMM_SELF, (char *)filename.c_str(), MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &fhw) == MPI_SUCCESS) {
+      
+      vector<char> *Snapshot = new vector<char>(Timing_Buffer.begin(), Timing_Buffer.end());
+      MPI_File_iwrite_at(fhw, (MPI_Offset)Timing_Offset, &(*Snapshot)[0], Snapshot->size(), MPI_BYTE, &request);
+      
+      Async_File.push_back(fhw);
+      Async_Request.push_back(request);
+      Async_Buffer.push_back(Snapshot);
+      
+      Timing_Offset += Timing_Buffer.size();
+      Timing_Buffer.clear();
+      return;
+      
+    }
+    
+    /*--- Otherwise the block is written below with the standard library ---*/
+    
+  }
+#endif
+  
+  /*--- The block goes at its offset, background writes of the previous
+   blocks may still be in progress ---*/
+  
+  fstream Timing_File(filename.c_str(), ios::in | ios::out | ios::binary);
+  if (!Timing_File.is_open()) Timing_File.open(filename.c_str(), ios::out | ios::binary);
+  Timing_File.seekp(Timing_Offset);
+  Timing_File << Timing_Buffer;
+  Timing_File.close();
+  
+  Timing_Offset += Timing_Buffer.size();
+  Timing_Buffer.clear();
+  
+}
+
+void COutput::DeallocateCoordinates(CConfig *config, CGeometry *geometry) {
+  
+  unsigned short iDim, nDim = geometry->GetnDim();
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- The master node alone owns all data found in this routine. ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    /*--- Deallocate memory for coordinate data ---*/
+    
+    for (iDim = 0; iDim < nDim; iDim++) {
+      delete [] Coords[iDim];
+    }
+    delete [] Coords;
+  }
+}
+
+void COutput::DeallocateConnectivity(CConfig *config, CGeometry *geometry, bool surf_sol) {
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  /*--- The master node alone owns all data found in this routine. ---*/
+  if (rank == MASTER_NODE) {
+    
+    /*--- Deallocate memory for connectivity data ---*/
+    if (surf_sol) {
+      if (nGlobal_Line > 0      && Conn_Line      != NULL) delete [] Conn_Line;
+      if (nGlobal_BoundTria > 0 && Conn_BoundTria != NULL) delete [] Conn_BoundTria;
+      if (nGlobal_BoundQuad > 0 && Conn_BoundQuad != NULL) delete [] Conn_BoundQuad;
+    }
+    else {
+      if (nGlobal_Tria > 0 && Conn_Tria != NULL) delete [] Conn_Tria;
+      if (Conn_Quad != NULL) delete [] Conn_Quad;
+      if (Conn_Tetr != NULL) delete [] Conn_Tetr;
+      if (Conn_Hexa != NULL) delete [] Conn_Hexa;
+      if (Conn_Pris != NULL) delete [] Conn_Pris;
+      if (Conn_Pyra != NULL) delete [] Conn_Pyra;
+    }
+    
+  }
+}
+
+void COutput::DeallocateSolution(CConfig *config, CGeometry *geometry) {
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- The master node alone owns all data found in this routine. ---*/
+  if (rank == MASTER_NODE) {
+    
+    /*--- Deallocate memory for solution data ---*/
+    for (unsigned short iVar = 0; iVar < nVar_Total; iVar++) {
+      delete [] Data[iVar];
+    }
+    delete [] Data;
+    
+  }
+}
+
+void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config) {
+  char cstr[200], buffer[50], turb_resid[1000];
+  unsigned short iMarker, iMarker_Monitoring;
+  string Monitoring_Tag, monitoring_coeff, aeroelastic_coeff;
+  
+  bool rotating_frame = config->GetRotating_Frame();
+  bool aeroelastic = config->GetAeroelastic_Simulation();
+  bool equiv_area = config->GetEquivArea();
+  bool turbulent = ((config->GetKind_Solver() == RANS) || (config->GetKind_Solver() == ADJ_RANS) ||
+                    (config->GetKind_Solver() == DISC_ADJ_RANS));
+  bool frozen_turb = config->GetFrozen_Visc();
+  bool freesurface = (config->GetKind_Regime() == FREESURFACE);
+  bool inv_design = (config->GetInvDesign_Cp() || config->GetInvDesign_HeatFlux());
+  bool output_1d = config->GetWrt_1D_Output();
+  bool output_per_surface = false;
+  bool output_massflow = (config->GetKind_ObjFunc() == MASS_FLOW_RATE);
+  if (config->GetnMarker_Monitoring() > 1) output_per_surface = true;
+  
+  unsigned short direct_diff = config->GetDirectDiff();
+  
+  bool isothermal = false;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    if ((config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ))
+      isothermal = true;
+  
+  /*--- Write file name with extension ---*/
+  
+  string filename = config->GetConv_FileName();
+  strcpy (cstr, filename.data());
+  
+  if (config->GetWrt_Unsteady() && config->GetRestart()) {
+    long iExtIter = config->GetUnst_RestartIter();
+    if (SU2_TYPE::Int(iExtIter) < 10) SPRINTF (buffer, "_0000%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 10) && (SU2_TYPE::Int(iExtIter) < 100)) SPRINTF (buffer, "_000%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 100) && (SU2_TYPE::Int(iExtIter) < 1000)) SPRINTF (buffer, "_00%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 1000) && (SU2_TYPE::Int(iExtIter) < 10000)) SPRINTF (buffer, "_0%d", SU2_TYPE::Int(iExtIter));
+    if (SU2_TYPE::Int(iExtIter) >= 10000) SPRINTF (buffer, "_%d", SU2_TYPE::Int(iExtIter));
+    strcat(cstr, buffer);
+  }
+  
+  if ((config->GetOutput_FileFormat() == TECPLOT) ||
+      (config->GetOutput_FileFormat() == FIELDVIEW)) SPRINTF (buffer, ".dat");
+  else if ((config->GetOutput_FileFormat() == TECPLOT_BINARY) ||
+           (config->GetOutput_FileFormat() == FIELDVIEW_BINARY))  SPRINTF (buffer, ".plt");
+  else if ((config->GetOutput_FileFormat() == PARAVIEW) ||
+           (config->GetOutput_FileFormat() == PARAVIEW_BINARY) ||
+           (config->GetOutput_FileFormat() == XDMF))  SPRINTF (buffer, ".csv");
+  strcat(cstr, buffer);
+  
+  ConvHist_file->open(cstr, ios::out);
+  ConvHist_file->precision(15);
+  
+  /*--- Begin of the header ---*/
+  
+  char begin[]= "\"Iteration\"";
+  
+  /*--- Header for the coefficients ---*/
+  
+  char flow_coeff[]= ",\"CLift\",\"CDrag\",\"CSideForce\",\"CMx\",\"CMy\",\"CMz\",\"CFx\",\"CFy\",\"CFz\",\"CL/CD\"";
+  char heat_coeff[]= ",\"HeatFlux_Total\",\"HeatFlux_Maximum\"";
+  char equivalent_area_coeff[]= ",\"CEquivArea\",\"CNearFieldOF\"";
+  char rotating_frame_coeff[]= ",\"CMerit\",\"CT\",\"CQ\"";
+  char free_surface_coeff[]= ",\"CFreeSurface\"";
+  char wave_coeff[]= ",\"CWave\"";
+  char fem_coeff[]= ",\"VM_Stress\"";
+  char adj_coeff[]= ",\"Sens_Geo\",\"Sens_Mach\",\"Sens_AoA\",\"Sens_Press\",\"Sens_Temp\",\"Sens_AoS\"";
+  char oneD_outputs[]= ",\"Avg_TotalPress\",\"Avg_Mach\",\"Avg_Temperature\",\"MassFlowRate\",\"FluxAvg_Pressure\",\"FluxAvg_Density\",\"FluxAvg_Velocity\",\"FluxAvg_Enthalpy\"";
+  char Cp_inverse_design[]= ",\"Cp_Diff\"";
+  char Heat_inverse_design[]= ",\"HeatFlux_Diff\"";
+  char mass_flow_rate[] = ",\"MassFlowRate\"";
+  char d_flow_coeff[] = ",\"D(CLift)\",\"D(CDrag)\",\"D(CSideForce)\",\"D(CMx)\",\"D(CMy)\",\"D(CMz)\",\"D(CFx)\",\"D(CFy)\",\"D(CFz)\",\"D(CL/CD)\"";
+  
+  /* Find the markers being monitored and create a header for them */
+  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
+    Monitoring_Tag = config->GetMarker_Monitoring(iMarker_Monitoring);
+    monitoring_coeff += ",\"CLift_"  + Monitoring_Tag + "\"";
+    monitoring_coeff += ",\"CDrag_"  + Monitoring_Tag + "\"";
+    monitoring_coeff += ",\"CSideForce_" + Monitoring_Tag + "\"";
+    monitoring_coeff += ",\"CL/CD_" + Monitoring_Tag + "\"";
+    monitoring_coeff += ",\"CFx_"    + Monitoring_Tag + "\"";
+    monitoring_coeff += ",\"CFy_"    + Monitoring_Tag + "\"";
+    monitoring_coeff += ",\"CFz_"    + Monitoring_Tag + "\"";
+    monitoring_coeff += ",\"CMx_"    + Monitoring_Tag + "\"";
+    monitoring_coeff += ",\"CMy_"    + Monitoring_Tag + "\"";
+    monitoring_coeff += ",\"CMz_"    + Monitoring_Tag + "\"";
+    aeroelastic_coeff += ",\"plunge_" + Monitoring_Tag + "\"";
+    aeroelastic_coeff += ",\"pitch_"  + Monitoring_Tag + "\"";
+  }
+  
+  /*--- Header for the residuals ---*/
+  
+  char flow_resid[]= ",\"Res_Flow[0]\",\"Res_Flow[1]\",\"Res_Flow[2]\",\"Res_Flow[3]\",\"Res_Flow[4]\"";
+  char adj_flow_resid[]= ",\"Res_AdjFlow[0]\",\"Res_AdjFlow[1]\",\"Res_AdjFlow[2]\",\"Res_AdjFlow[3]\",\"Res_AdjFlow[4]\"";
+  switch (config->GetKind_Turb_Model()) {
+    case SA:	   SPRINTF (turb_resid, ",\"Res_Turb[0]\""); break;
+    case SA_NEG: SPRINTF (turb_resid, ",\"Res_Turb[0]\""); break;
     case SST:   	SPRINTF (turb_resid, ",\"Res_Turb[0]\",\"Res_Turb[1]\""); break;
   }
   char adj_turb_resid[]= ",\"Res_AdjTurb[0]\"";
@@ -6721,6 +7991,11 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
   
   unsigned short iZone;
   
+  /*--- Complete the files of the previous output that are still being written
+   in the background, only one output is in flight at any time. ---*/
+  
+  SetAsync_Flush();
+  
   for (iZone = 0; iZone < val_nZone; iZone++) {
     
     /*--- Flags identifying the types of files to be written. ---*/
@@ -6728,12 +8003,21 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
     bool Wrt_Vol = config[iZone]->GetWrt_Vol_Sol();
     bool Wrt_Srf = config[iZone]->GetWrt_Srf_Sol();
     
+    /*--- Get the file output format ---*/
+    
+    unsigned short FileFormat = config[iZone]->GetOutput_FileFormat();
+    
+    /*--- The parallel Paraview files are written by every rank from its own
+     points and elements, nothing is merged in the master node for them. ---*/
+    
+    bool Wrt_Parallel = ((FileFormat == PARAVIEW_BINARY) || (FileFormat == XDMF));
+    
 #ifdef HAVE_MPI
     /*--- Do not merge the volume solutions if we are running in parallel.
      Force the use of SU2_SOL to merge the volume sols in this case. ---*/
     
     MPI_Comm_size(MPI_COMM_WORLD, &size);
-    if (size > SINGLE_NODE) {
+    if ((size > SINGLE_NODE) && !Wrt_Parallel) {
       Wrt_Vol = false;
       Wrt_Srf = false;
     }
@@ -6741,6 +8025,12 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
     
     bool Wrt_Csv = config[iZone]->GetWrt_Csv_Sol();
     
+    /*--- A binary restart is written by every rank from its own points, the
+     data is only merged in the master node for the other files. ---*/
+    
+    bool Wrt_Binary_Restart = GetBinary_Restart(config[iZone]);
+    bool Wrt_Merge = (((Wrt_Vol || Wrt_Srf) && !Wrt_Parallel) || !Wrt_Binary_Restart);
+    
     if (rank == MASTER_NODE) cout << endl << "Writing comma-separated values (CSV) surface files." << endl;
     
     switch (config[iZone]->GetKind_Solver()) {
@@ -6756,15 +8046,11 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
         
     }
     
-    /*--- Get the file output format ---*/
-    
-    unsigned short FileFormat = config[iZone]->GetOutput_FileFormat();
-    
     /*--- Merge the node coordinates and connectivity, if necessary. This
      is only performed if a volume solution file is requested, and it
      is active by default. ---*/
     
-    if (Wrt_Vol || Wrt_Srf) {
+    if ((Wrt_Vol || Wrt_Srf) && !Wrt_Parallel) {
       if (rank == MASTER_NODE) cout << "Merging connectivities in the Master node." << endl;
       MergeConnectivity(config[iZone], geometry[iZone][MESH_0], iZone);
     }
@@ -6773,8 +8059,10 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
      The grid coordinates are always merged and included first in the
      restart files. ---*/
     
-    if (rank == MASTER_NODE) cout << "Merging coordinates in the Master node." << endl;
-    MergeCoordinates(config[iZone], geometry[iZone][MESH_0]);
+    if (Wrt_Merge) {
+      if (rank == MASTER_NODE) cout << "Merging coordinates in the Master node." << endl;
+      MergeCoordinates(config[iZone], geometry[iZone][MESH_0]);
+    }
     
     if ((rank == MASTER_NODE) && (Wrt_Vol || Wrt_Srf)) {
       if (FileFormat == TECPLOT_BINARY) {
@@ -6790,19 +8078,49 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
     
     /*--- Merge the solution data needed for volume solutions and restarts ---*/
     
-    if (rank == MASTER_NODE) cout << "Merging solution in the Master node." << endl;
-    MergeSolution(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+    if (Wrt_Merge) {
+      if (rank == MASTER_NODE) cout << "Merging solution in the Master node." << endl;
+      MergeSolution(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+    }
+    
+    /*--- Write a binary native restart file (all ranks) ---*/
+    
+    if (Wrt_Binary_Restart) {
+      if (rank == MASTER_NODE) cout << "Writing SU2 native binary restart file." << endl;
+      SetRestart_Binary(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+    }
+    
+    /*--- Write the parallel Paraview files (all ranks) ---*/
+    
+    if ((FileFormat == PARAVIEW_BINARY) && Wrt_Vol) {
+      if (rank == MASTER_NODE) cout << "Writing Paraview XML binary volume solution files (one piece per rank)." << endl;
+      SetParaview_Parallel(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone, val_nZone, false);
+    }
+    
+    if ((FileFormat == PARAVIEW_BINARY) && Wrt_Srf) {
+      if (rank == MASTER_NODE) cout << "Writing Paraview XML binary surface solution files (one piece per rank)." << endl;
+      SetParaview_Parallel(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone, val_nZone, true);
+    }
+    
+    /*--- Write the XDMF files (all ranks), the surface grids are stored in the same files ---*/
+    
+    if ((FileFormat == XDMF) && (Wrt_Vol || Wrt_Srf)) {
+      if (rank == MASTER_NODE) cout << "Writing XDMF solution files (collective MPI-IO)." << endl;
+      SetXDMF_Parallel(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone, val_nZone, Wrt_Srf);
+    }
     
     /*--- Write restart, or Tecplot files using the merged data.
      This data lives only on the master, and these routines are currently
      executed by the master proc alone (as if in serial). ---*/
     
-    if (rank == MASTER_NODE) {
+    if ((rank == MASTER_NODE) && Wrt_Merge) {
       
       /*--- Write a native restart file ---*/
       
-      if (rank == MASTER_NODE) cout << "Writing SU2 native restart file." << endl;
-      SetRestart(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0] , iZone);
+      if (!Wrt_Binary_Restart) {
+        cout << "Writing SU2 native restart file." << endl;
+        SetRestart(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0] , iZone);
+      }
       
       if (Wrt_Vol) {
         
@@ -7176,9 +8494,12 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
       
       if (rank == MASTER_NODE) cout <<"Writing .su2 file." << endl;
       
-      /*--- Write a .su2 ASCII file ---*/
+      /*--- Write a .su2 ASCII or binary file ---*/
       
-      if (su2_file) SetSU2_MeshASCII(config[iZone], geometry[iZone]);
+      if (su2_file) {
+        if (config[iZone]->GetMesh_Out_FileFormat() == SU2_BINARY) SetSU2_MeshBinary(config[iZone], geometry[iZone]);
+        else SetSU2_MeshASCII(config[iZone], geometry[iZone]);
+      }
       
       /*--- Deallocate connectivity ---*/
       
@@ -232,4 +232,112 @@ void COutput::SetSU2_MeshASCII(CConfig *config, CGeometry *geometry) {
   
 }
 
-void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry) { }
+void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry) {
+  
+  unsigned long iElem, iPoint, iElem_Bound, nElem_Bound_, iNode, vnodes[N_POINTS_HEXAHEDRON];
+  unsigned short iMarker, iDim, nDim = geometry->GetnDim(), iChar, iPeriodic, nPeriodic = 0, VTK_Type, nMarker_;
+  su2double *center, *angles, *transl;
+  ifstream input_file;
+  string text_line, Marker_Tag;
+  string::size_type position;
+  CSU2BinaryMesh mesh(nDim);
+  
+  /*--- Connectivity data, same ordering as the ASCII file ---*/
+  
+  const unsigned short nType = 6;
+  const unsigned short Type[nType]    = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+  const unsigned short nNodes[nType]  = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                         N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+  const unsigned long nGlobal[nType]  = {nGlobal_Tria, nGlobal_Quad, nGlobal_Tetr, nGlobal_Hexa, nGlobal_Pris, nGlobal_Pyra};
+  int *Conn[nType]                    = {Conn_Tria, Conn_Quad, Conn_Tetr, Conn_Hexa, Conn_Pris, Conn_Pyra};
+  
+  for (unsigned short iType = 0; iType < nType; iType++) {
+    for (iElem = 0; iElem < nGlobal[iType]; iElem++) {
+      for (iNode = 0; iNode < nNodes[iType]; iNode++)
+        vnodes[iNode] = Conn[iType][iElem*nNodes[iType]+iNode]-1;
+      mesh.AddElem(Type[iType], nNodes[iType], vnodes);
+    }
+  }
+  
+  /*--- Node coordinates ---*/
+  
+  mesh.nPoint = nGlobal_Doma;
+  mesh.nPointDomain = geometry->GetGlobal_nPointDomain();
+  mesh.Coord.resize(nGlobal_Doma*nDim);
+  for (iPoint = 0; iPoint < nGlobal_Doma; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      mesh.Coord[iPoint*nDim+iDim] = SU2_TYPE::GetValue(Coords[iDim][iPoint]);
+  
+  /*--- Read the boundary information written by the geometry ---*/
+  
+  input_file.open("boundary.su2", ios::in);
+  
+  while (getline (input_file, text_line)) {
+    
+    position = text_line.find ("NMARK=",0);
+    if (position != string::npos) {
+      
+      text_line.erase (0,6); nMarker_ = atoi(text_line.c_str());
+      
+      for (iMarker = 0 ; iMarker < nMarker_; iMarker++) {
+        
+        getline (input_file, text_line);
+        text_line.erase (0,11);
+        for (iChar = 0; iChar < 20; iChar++) {
+          position = text_line.find( " ", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+          position = text_line.find( "\r", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+          position = text_line.find( "\n", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+        }
+        Marker_Tag = text_line.c_str();
+        
+        getline (input_file, text_line);
+        text_line.erase (0,13); nElem_Bound_ = atoi(text_line.c_str());
+        
+        if (Marker_Tag == "SEND_RECEIVE") mesh.AddMarker(Marker_Tag, config->GetMarker_All_SendRecv(iMarker));
+        else mesh.AddMarker(Marker_Tag, 0);
+        
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+          
+          getline(input_file, text_line);
+          istringstream bound_line(text_line);
+          bound_line >> VTK_Type;
+          
+          switch(VTK_Type) {
+            case LINE: case VERTEX:
+              bound_line >> vnodes[0] >> vnodes[1];
+              mesh.AddBound(VTK_Type, 2, vnodes); break;
+            case TRIANGLE:
+              bound_line >> vnodes[0] >> vnodes[1] >> vnodes[2];
+              mesh.AddBound(VTK_Type, 3, vnodes); break;
+            case QUADRILATERAL:
+              bound_line >> vnodes[0] >> vnodes[1] >> vnodes[2] >> vnodes[3];
+              mesh.AddBound(VTK_Type, 4, vnodes); break;
+          }
+        }
+      }
+    }
+    
+  }
+  
+  input_file.close();
+  
+  remove("boundary.su2");
+  
+  /*--- Periodic transformations ---*/
+  
+  nPeriodic = config->GetnPeriodicIndex();
+  for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+    center = config->GetPeriodicCenter(iPeriodic);
+    angles = config->GetPeriodicRotation(iPeriodic);
+    transl = config->GetPeriodicTranslate(iPeriodic);
+    for (iDim = 0; iDim < 3; iDim++) mesh.Periodic.push_back(SU2_TYPE::GetValue(center[iDim]));
+    for (iDim = 0; iDim < 3; iDim++) mesh.Periodic.push_back(SU2_TYPE::GetValue(angles[iDim]));
+    for (iDim = 0; iDim < 3; iDim++) mesh.Periodic.push_back(SU2_TYPE::GetValue(transl[iDim]));
+  }
+  
+  mesh.Write(config->GetMesh_Out_FileName());
+  
+}
@@ -451,6 +451,8 @@ CFEM_ElasticitySolver_Adj::~CFEM_ElasticitySolver_Adj(void) {
 }
 
 void CFEM_ElasticitySolver_Adj::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
 
   unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
@@ -528,10 +530,14 @@ void CFEM_ElasticitySolver_Adj::Set_MPI_Solution(CGeometry *geometry, CConfig *c
     }
 
   }
-
+  
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CFEM_ElasticitySolver_Adj::Set_MPI_RefGeom(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
 
   unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
@@ -609,7 +615,9 @@ void CFEM_ElasticitySolver_Adj::Set_MPI_RefGeom(CGeometry *geometry, CConfig *co
     }
 
   }
-
+  
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CFEM_ElasticitySolver_Adj::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, CNumerics **numerics,
@@ -1674,6 +1682,29 @@ CDiscAdjFEASolver::CDiscAdjFEASolver(CGeometry *geometry, CConfig *config)  : CS
 
   Hess  = NULL;
   Bess  = NULL;
+
+  LBFGS_Memory  = 0;
+  LBFGS_Count   = 0;
+  LBFGS_Head    = 0;
+  LBFGS_s       = NULL;
+  LBFGS_y       = NULL;
+  LBFGS_rho     = NULL;
+  LBFGS_alpha   = NULL;
+  LBFGS_Gamma   = 1.0;
+
+  FilterMatrix        = NULL;
+  FilterRhs           = NULL;
+  FilterSol           = NULL;
+  FilterVolume        = NULL;
+  Filter_nRow         = 0;
+  FilterMatrix_Built  = false;
+  FilterMatrix_Coord  = 0;
+
+  Projection_y        = NULL;
+  Projection_z        = NULL;
+  Projection_Lambda   = 0.0;
+  Projection_Warm     = false;
+  Projection_Volume   = 0.0;
 }
 
 CDiscAdjFEASolver::CDiscAdjFEASolver(CGeometry *geometry, CConfig *config, CSolver *direct_solver, unsigned short Kind_Solver, unsigned short iMesh)  : CSolver(){
@@ -1986,19 +2017,78 @@ CDiscAdjFEASolver::CDiscAdjFEASolver(CGeometry *geometry, CConfig *config, CSolv
       cons_factor[iCons]            = 0.0;
   }
 
-  Hess=new su2double*[geometry->GetnElem()];
-  Bess=new su2double*[geometry->GetnElem()];
-  for (iElem=0; iElem<geometry->GetnElem(); iElem++){
-     Hess[iElem]= new su2double [geometry->GetnElem()];
-     Bess[iElem]= new su2double [geometry->GetnElem()];
+  /*--- The BFGS preconditioner either keeps the dense nElem x nElem matrix or,
+   in limited-memory mode, only the last LBFGS_Memory (s,y) pairs. ---*/
+
+  Hess  = NULL;
+  Bess  = NULL;
+
+  LBFGS_Memory  = config->GetOneShotLBFGSMemory();
+  LBFGS_Count   = 0;
+  LBFGS_Head    = 0;
+  LBFGS_s       = NULL;
+  LBFGS_y       = NULL;
+  LBFGS_rho     = NULL;
+  LBFGS_alpha   = NULL;
+  LBFGS_Gamma   = 1.0;
+
+  /*--- The Helmholtz filter operator is assembled on the first call of the filter ---*/
+
+  FilterMatrix        = NULL;
+  FilterRhs           = NULL;
+  FilterSol           = NULL;
+  FilterVolume        = NULL;
+  Filter_nRow         = 0;
+  FilterMatrix_Built  = false;
+  FilterMatrix_Coord  = 0;
+
+  /*--- Work arrays of the volume projection, kept across line search steps ---*/
+
+  Projection_y        = new su2double[geometry->GetnElem()];
+  Projection_z        = new su2double[geometry->GetnElem()];
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++){
+    Projection_y[iElem] = 0.0;
+    Projection_z[iElem] = 0.0;
   }
-  for (iElem=0; iElem<geometry->GetnElem(); iElem++){
-      for (jElem=0; jElem<geometry->GetnElem(); jElem++){
-         Hess[iElem][jElem]= 0.0;
-         Bess[iElem][jElem]= 0.0;
+  Projection_Lambda   = 0.0;
+  Projection_Warm     = false;
+  Projection_Volume   = 0.0;
+
+  if (LBFGS_Memory > 0) {
+
+    LBFGS_s     = new su2double*[LBFGS_Memory];
+    LBFGS_y     = new su2double*[LBFGS_Memory];
+    LBFGS_rho   = new su2double[LBFGS_Memory];
+    LBFGS_alpha = new su2double[LBFGS_Memory];
+    for (iCons = 0; iCons < LBFGS_Memory; iCons++){
+      LBFGS_s[iCons] = new su2double[geometry->GetnElem()];
+      LBFGS_y[iCons] = new su2double[geometry->GetnElem()];
+      for (iElem = 0; iElem < geometry->GetnElem(); iElem++){
+        LBFGS_s[iCons][iElem] = 0.0;
+        LBFGS_y[iCons][iElem] = 0.0;
       }
-      Hess[iElem][iElem]=1.0;
-      Bess[iElem][iElem]=1.0;
+      LBFGS_rho[iCons]   = 0.0;
+      LBFGS_alpha[iCons] = 0.0;
+    }
+
+  }
+  else {
+
+    Hess=new su2double*[geometry->GetnElem()];
+    Bess=new su2double*[geometry->GetnElem()];
+    for (iElem=0; iElem<geometry->GetnElem(); iElem++){
+       Hess[iElem]= new su2double [geometry->GetnElem()];
+       Bess[iElem]= new su2double [geometry->GetnElem()];
+    }
+    for (iElem=0; iElem<geometry->GetnElem(); iElem++){
+        for (jElem=0; jElem<geometry->GetnElem(); jElem++){
+           Hess[iElem][jElem]= 0.0;
+           Bess[iElem][jElem]= 0.0;
+        }
+        Hess[iElem][iElem]=1.0;
+        Bess[iElem][iElem]=1.0;
+    }
+
   }
 
 }
@@ -2022,6 +2112,25 @@ CDiscAdjFEASolver::~CDiscAdjFEASolver(void){
   if (Solution_Vel   != NULL) delete [] Solution_Vel;
   if (Solution_Accel != NULL) delete [] Solution_Accel;
 
+  if (LBFGS_s != NULL) {
+    for (unsigned short iPair = 0; iPair < LBFGS_Memory; iPair++) {
+      delete [] LBFGS_s[iPair];
+      delete [] LBFGS_y[iPair];
+    }
+    delete [] LBFGS_s;
+    delete [] LBFGS_y;
+  }
+  if (LBFGS_rho   != NULL) delete [] LBFGS_rho;
+  if (LBFGS_alpha != NULL) delete [] LBFGS_alpha;
+
+  if (FilterMatrix != NULL) delete FilterMatrix;
+  if (FilterRhs    != NULL) delete FilterRhs;
+  if (FilterSol    != NULL) delete FilterSol;
+  if (FilterVolume != NULL) delete [] FilterVolume;
+
+  if (Projection_y != NULL) delete [] Projection_y;
+  if (Projection_z != NULL) delete [] Projection_z;
+
 }
 
 void CDiscAdjFEASolver::SetRecordingPiggyBack(CGeometry* geometry, CConfig *config, unsigned short kind_recording){
@@ -2777,13 +2886,24 @@ void CDiscAdjFEASolver::BFGSUpdateProjected(CGeometry *geometry, CConfig *config
 
     unsigned long iElem, jElem, kElem, lElem;
     su2double *rk,*duk,*wone;
-    rk=new su2double[geometry->GetnElem()];
-    duk=new su2double[geometry->GetnElem()];
-    wone=new su2double[geometry->GetnElem()];
     su2double vk=0;
     su2double normrk=0;
     su2double normduk=0;
 
+    /*--- Limited-memory mode: the new (s,y) pair is written directly into the
+     history and only kept if it satisfies the curvature condition. ---*/
+
+    if (LBFGS_Memory > 0) {
+        rk=LBFGS_y[LBFGS_Head];
+        duk=LBFGS_s[LBFGS_Head];
+        wone=NULL;
+    }
+    else {
+        rk=new su2double[geometry->GetnElem()];
+        duk=new su2double[geometry->GetnElem()];
+        wone=new su2double[geometry->GetnElem()];
+    }
+
     //Output of Gradients and Information
 
     std::cout<<"Gradient of Augmented Lagrangian "<<std::endl;
@@ -2800,19 +2920,44 @@ void CDiscAdjFEASolver::BFGSUpdateProjected(CGeometry *geometry, CConfig *config
     }
     std::cout<<std::endl;*/
 
+    /*--- The products are summed over the owned elements, the halo elements are copies ---*/
+
+    SetElem_Owned(geometry, config);
+
     if(ExtIter>config->GetOneShotStart()){
         for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
             rk[iElem]=Lagrange_Sens[iElem]-Lagrange_Sens_Old[iElem];
             duk[iElem]=DesignVarUpdate[iElem];
+            if (!Elem_Owned[iElem]) continue;
             vk+=rk[iElem]*duk[iElem];
             normrk+=rk[iElem]*rk[iElem];
             normduk+=duk[iElem]*duk[iElem];
         }
+        if (LBFGS_Memory > 0) {
+#ifdef HAVE_MPI
+            su2double MyProducts[3] = {vk, normrk, normduk}, Products[3];
+            SU2_MPI::Allreduce(MyProducts, Products, 3, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+            vk = Products[0]; normrk = Products[1]; normduk = Products[2];
+#endif
+        }
         std::cout<<std::endl;
         std::cout<<"vk "<<vk<<std::endl;
         std::cout<<"normduk "<<normduk<<", normrk "<<normrk<<", vk/normduk "<<vk/normduk<<std::endl;
 
-        if ((vk>0)) {
+        if (LBFGS_Memory > 0) {
+            if (vk>0) {
+                LBFGS_rho[LBFGS_Head]=1.0/vk;
+                LBFGS_Gamma=vk/normrk;
+                LBFGS_Head=(LBFGS_Head+1)%LBFGS_Memory;
+                if (LBFGS_Count<LBFGS_Memory) LBFGS_Count++;
+            }
+            else {
+                std::cout<<"!!!!!!!!!!!!!!!!ATTENTION-HESSIAN NON-POSITIVE-DEFINITE!!!!!!!!!!!!!!!!!!!"<<std::endl;
+                LBFGS_Count=0;
+                LBFGS_Head=0;
+            }
+        }
+        else if ((vk>0)) {
             su2double wtwo=0.0;
             for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
                       wone[iElem]=0.0;
@@ -2884,6 +3029,13 @@ void CDiscAdjFEASolver::BFGSUpdateProjected(CGeometry *geometry, CConfig *config
     }
 
     Lagrangian_Value_Old=Lagrangian_Value;
+    if (LBFGS_Memory > 0) {
+        for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+            UpdateSens[iElem]=-Lagrange_Sens[iElem];
+        }
+        LBFGSApply(geometry->GetnElem(), UpdateSens);
+        return;
+    }
     for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
         UpdateSens[iElem]=0.0;
         for (jElem=0;jElem<geometry->GetnElem();jElem++){
@@ -2896,6 +3048,76 @@ void CDiscAdjFEASolver::BFGSUpdateProjected(CGeometry *geometry, CConfig *config
     delete [] wone;
 }
 
+void CDiscAdjFEASolver::SetElem_Owned(CGeometry *geometry, CConfig *config){
+
+    unsigned long iElem;
+    unsigned short iNode;
+
+    if (Elem_Owned.size() == geometry->GetnElem()) return;
+
+    vector<bool> Halo;
+    geometry->GetHalo_Points(config, Halo);
+
+    Elem_Owned.assign(geometry->GetnElem(), true);
+    for (iElem = 0; iElem < geometry->GetnElem(); iElem++)
+        for (iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+            if (Halo[geometry->elem[iElem]->GetNode(iNode)]) Elem_Owned[iElem] = false;
+
+}
+
+void CDiscAdjFEASolver::LBFGSApply(unsigned long nElem, su2double *val_vector){
+
+    unsigned long iElem;
+    unsigned short iPair, iIndex;
+    su2double MyDot, Dot, beta;
+
+    if (LBFGS_Count == 0) return;
+
+    /*--- The dot products are summed over the owned elements (Elem_Owned). The curvature
+     1/rho and the scaling gamma of the pairs were reduced when the pairs were stored,
+     only the products with the vector need a reduction (one per pair and loop). ---*/
+
+    /*--- First loop, from the newest to the oldest pair ---*/
+
+    for (iPair = 0; iPair < LBFGS_Count; iPair++) {
+        iIndex = (LBFGS_Head+LBFGS_Memory-1-iPair)%LBFGS_Memory;
+        MyDot = 0.0;
+        for (iElem = 0; iElem < nElem; iElem++)
+            if (Elem_Owned[iElem]) MyDot += LBFGS_s[iIndex][iElem]*val_vector[iElem];
+#ifdef HAVE_MPI
+        SU2_MPI::Allreduce(&MyDot, &Dot, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+        Dot = MyDot;
+#endif
+        LBFGS_alpha[iIndex] = LBFGS_rho[iIndex]*Dot;
+        for (iElem = 0; iElem < nElem; iElem++)
+            val_vector[iElem] -= LBFGS_alpha[iIndex]*LBFGS_y[iIndex][iElem];
+    }
+
+    /*--- Initial inverse Hessian gamma*I scaled with the newest pair ---*/
+
+    for (iElem = 0; iElem < nElem; iElem++)
+        val_vector[iElem] *= LBFGS_Gamma;
+
+    /*--- Second loop, from the oldest to the newest pair ---*/
+
+    for (iPair = 0; iPair < LBFGS_Count; iPair++) {
+        iIndex = (LBFGS_Head+LBFGS_Memory-LBFGS_Count+iPair)%LBFGS_Memory;
+        MyDot = 0.0;
+        for (iElem = 0; iElem < nElem; iElem++)
+            if (Elem_Owned[iElem]) MyDot += LBFGS_y[iIndex][iElem]*val_vector[iElem];
+#ifdef HAVE_MPI
+        SU2_MPI::Allreduce(&MyDot, &Dot, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+        Dot = MyDot;
+#endif
+        beta = LBFGS_rho[iIndex]*Dot;
+        for (iElem = 0; iElem < nElem; iElem++)
+            val_vector[iElem] += (LBFGS_alpha[iIndex]-beta)*LBFGS_s[iIndex][iElem];
+    }
+
+}
+
 void CDiscAdjFEASolver::UpdateMultiplier(CConfig *config){
     for (unsigned short iValue=0; iValue<config->GetConstraintNum();iValue++){
         multiplier[iValue]=multiplier[iValue]+cons_factor[iValue]*SU2_TYPE::GetValue(Constraint_Save[iValue]);
@@ -3089,73 +3311,97 @@ void CDiscAdjFEASolver::LoadOldAdjoint(){
 
 void CDiscAdjFEASolver::VolumeProjection(CGeometry *geometry, CConfig *config, su2double steplen){
     su2double tol = config->GetStepTolerance();//0.001;
-    unsigned long iElem;
+    unsigned long iElem, nElem = geometry->GetnElem();
 
     const double EPS=std::numeric_limits<double>::epsilon();
 
-    su2double a,b,c,d,e,fa,fb,fc,p,q,r,s, sumlambda, tol1, xm, min1, min2;
+    su2double a,b,c,d,e,fa,fb,fc,p,q,r,s, tol1, xm, min1, min2, step, target;
+    su2double MyBounds[2], Bounds[2], MyVolume, Volume;
 
     int itermax=10000;
 
-    su2double* lambda_l = new su2double[geometry->GetnElem()];
-    su2double* lambda_u = new su2double[geometry->GetnElem()];
-    su2double* y = new su2double[geometry->GetnElem()];
-    su2double* zlambda = new su2double[geometry->GetnElem()];
+    int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
 
-    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-        y[iElem]=Density[iElem]+steplen*UpdateSens[iElem];//config->GetOSStepSize()*UpdateSens[iElem];
-        lambda_u[iElem]=y[iElem]-1.0;
-        lambda_l[iElem]=y[iElem];
-        UpdateSensOld[iElem]=UpdateSens[iElem];
-    }
+    /*--- The projected design is z(lambda) = max(0,min(y-lambda,1)), so the root
+     lies in [min(y)-1, max(y)], taken over all ranks. ---*/
 
-    su2double lambdamin = lambda_u[0];
-    su2double lambdamax = lambda_l[0];
-    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-        if(lambda_u[iElem]<lambdamin)   lambdamin=lambda_u[iElem];
-        if(lambda_l[iElem]>lambdamax)   lambdamax=lambda_l[iElem];
+    /*--- The volume only counts the elements owned by this rank (no halo
+     points), the same elements as the output, so that each element of the
+     mesh is counted once. The partition and the volume do not change between
+     design iterations, they are computed on the first projection. ---*/
+
+    if (Projection_Volume == 0.0) {
+        SetElem_Owned(geometry, config);
+        MyVolume = 0.0;
+        for (iElem = 0; iElem < nElem; iElem++)
+            if (Elem_Owned[iElem]) MyVolume += 1.0;
+#ifdef HAVE_MPI
+        SU2_MPI::Allreduce(&MyVolume, &Volume, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+        Volume = MyVolume;
+#endif
+        Projection_Volume = Volume;
     }
 
-    /*su2double step=(lambdamax-lambdamin)/1000.0;
-    for (unsigned short itera=0;itera<1000;itera++){
-        sumlambda=0.0;
-        for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-            zlambda[iElem] = max(0.0 ,min(y[iElem]-(lambdamin+step*itera),1.0));
-            sumlambda+=zlambda[iElem]*1.0;
-        }
-        std::cout<<sumlambda-geometry->GetnElem()*config->GetVolumeConstraint()<<std::endl;
-    }*/
+    MyBounds[0] = -1E30;
+    MyBounds[1] = -1E30;
+    for (iElem = 0; iElem < nElem; iElem++) {
+        Projection_y[iElem]=Density[iElem]+steplen*UpdateSens[iElem];//config->GetOSStepSize()*UpdateSens[iElem];
+        UpdateSensOld[iElem]=UpdateSens[iElem];
+        MyBounds[0]=max(MyBounds[0], 1.0-Projection_y[iElem]);
+        MyBounds[1]=max(MyBounds[1], Projection_y[iElem]);
+    }
 
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(MyBounds, Bounds, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+    Bounds[0] = MyBounds[0];
+    Bounds[1] = MyBounds[1];
+#endif
+    su2double lambdamin = -Bounds[0];
+    su2double lambdamax = Bounds[1];
+    target = Projection_Volume*config->GetVolumeConstraint();
 
     // compute zero of G(lambda) = ones*z(lambda) - volfrac*nElem in interval
     // [lambdamin,lambdamax] with tolerance tol
 
-    a = lambdamin;
-    b = lambdamax;
-    c = lambdamax;
-
-    std::cout<<"lambda: "<<lambdamin<<" "<<lambdamax<<" "<<config->GetVolumeConstraint()<<std::endl;
-
-    sumlambda=0.0;
-    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-        zlambda[iElem] = max(0.0 ,min(y[iElem]-a,1.0));
-        sumlambda+=zlambda[iElem]*1.0;
+    /*--- G is non-increasing in lambda. Starting from the previous multiplier,
+     the bracket is widened geometrically until it contains the root, which
+     between line search steps usually takes one or two evaluations. ---*/
+
+    if (Projection_Warm && Projection_Lambda > lambdamin && Projection_Lambda < lambdamax) {
+        step = max(tol, 1E-3*(lambdamax-lambdamin));
+        a = Projection_Lambda;
+        fa = VolumeProjection_Residual(a, nElem, target);
+        b = a;
+        fb = fa;
+        while (fa*fb > 0.0 && fb != 0.0) {
+            a = b;
+            fa = fb;
+            if (fa > 0.0) b = min(a+step, lambdamax);
+            else          b = max(a-step, lambdamin);
+            fb = VolumeProjection_Residual(b, nElem, target);
+            if (b == lambdamin || b == lambdamax) break;
+            step *= 4.0;
+        }
     }
-    fa=sumlambda-geometry->GetnElem()*config->GetVolumeConstraint();
-
-    sumlambda=0.0;
-    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-        zlambda[iElem] = max(0.0 ,min(y[iElem]-b,1.0));
-        sumlambda+=zlambda[iElem]*1.0;
+    else {
+        a = lambdamin;
+        b = lambdamax;
+        fa = VolumeProjection_Residual(a, nElem, target);
+        fb = VolumeProjection_Residual(b, nElem, target);
     }
-    fb=sumlambda-geometry->GetnElem()*config->GetVolumeConstraint();
-
-    //while(iter<itermax)
+    c = b;
 
     if ((fa > 0.0 && fb > 0.0) || (fa < 0.0 && fb < 0.0))
-        std::cout<<"Root must be bracketed in zbrent"<<std::endl;
+        if (rank == MASTER_NODE) std::cout<<"Root must be bracketed in zbrent"<<std::endl;
 
     fc=fb;
+    e=b-a;
+    d=b-a;
     bool found = false;
     unsigned int iter=0;
 
@@ -3213,41 +3459,61 @@ void CDiscAdjFEASolver::VolumeProjection(CGeometry *geometry, CConfig *config, s
             if (fabs(d) > tol1){
                 b += d;
             }else{
-                if (xm >= 0 && tol1>= 0)
-                    b += tol1;
-                else if (xm>= 0 && tol1 < 0)
-                    b += -tol1;
-                else if (xm<0 && tol1 >= 0)
-                    b += -tol1;
+                if (xm >= 0)
+                    b += fabs(tol1);
                 else
-                    b += tol1;
+                    b -= fabs(tol1);
             }
             iter++;
+            fb = VolumeProjection_Residual(b, nElem, target);
         }
-        sumlambda=0.0;
-        for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-            zlambda[iElem] = max(0.0 ,min(y[iElem]-b,1.0));
-            sumlambda+=zlambda[iElem]*1.0;
-        }
-        fb=sumlambda-geometry->GetnElem()*config->GetVolumeConstraint();
     }
     if (iter==itermax){
-        std::cout<<"Maximum number of iterations exceeded in zbrent"<<std::endl;
+        if (rank == MASTER_NODE) std::cout<<"Maximum number of iterations exceeded in zbrent"<<std::endl;
     }
-    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+
+    Projection_Lambda = b;
+    Projection_Warm = true;
+
+    /*--- The last evaluation is not necessarily at b, z(b) is recomputed locally ---*/
+
+    for (iElem = 0; iElem < nElem; iElem++) {
+        Projection_z[iElem] = max(0.0 ,min(Projection_y[iElem]-b,1.0));
         //if (steplen==config->GetOSStepSize()) UpdateSens[iElem]=(zlambda[iElem]-Density[iElem]);//)/config->GetOSStepSize();
-        UpdateSens[iElem]=(zlambda[iElem]-Density[iElem])/steplen;
+        UpdateSens[iElem]=(Projection_z[iElem]-Density[iElem])/steplen;
     }
 
-    delete [] lambda_l;
-    delete [] lambda_u;
-    delete [] y;
-    delete [] zlambda;
+}
+
+su2double CDiscAdjFEASolver::VolumeProjection_Residual(su2double lambda, unsigned long nElem, su2double target){
+    unsigned long iElem;
+    su2double MyVolume = 0.0, Volume;
+
+    for (iElem = 0; iElem < nElem; iElem++) {
+        Projection_z[iElem] = max(0.0 ,min(Projection_y[iElem]-lambda,1.0));
+        if (Elem_Owned[iElem]) MyVolume += Projection_z[iElem];
+    }
 
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(&MyVolume, &Volume, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+    Volume = MyVolume;
+#endif
+
+    return Volume-target;
 }
 
 
-void CDiscAdjFEASolver::DensityFiltering(CGeometry *geometry, CConfig *config, bool updsens){
+void CDiscAdjFEASolver::DensityFiltering(CGeometry *geometry, CConfig *config){
+
+    /*--- Unstructured meshes use the PDE filter, the block-tridiagonal
+     solver below only applies to NELEMX x NELEMY rectangles. ---*/
+
+    if (!config->GetHelmholtzStructured()) {
+        HelmholtzFiltering(geometry, config);
+        return;
+    }
+
     unsigned long nElemx=config->GetNx();//80;//104;
     unsigned long nElemy=config->GetNy();//24;
     unsigned long nElem= geometry->GetnElem();
@@ -3430,6 +3696,511 @@ void CDiscAdjFEASolver::DensityFiltering(CGeometry *geometry, CConfig *config, b
 
 }
 
+#ifdef HAVE_MPI
+
+/*--- MPI datatypes of the records of the filter setup. The records are passive, there
+ is no version for an AD type (su2double), such an exchange does not compile. ---*/
+
+static MPI_Datatype Filter_Datatype(const unsigned long *val_record) { return MPI_UNSIGNED_LONG; }
+
+static MPI_Datatype Filter_Datatype(const passivedouble *val_record) { return MPI_DOUBLE; }
+
+#endif
+
+template<class T>
+void CDiscAdjFEASolver::Exchange_Filter(vector<vector<T> > &Send, vector<vector<T> > &Recv){
+
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  Recv.assign(size, vector<T>());
+
+#ifdef HAVE_MPI
+
+  /*--- The records are integers or passive values, the plain MPI calls are used
+   since the SU2_MPI wrappers treat MPI_DOUBLE buffers as su2double ---*/
+
+  MPI_Datatype datatype = Filter_Datatype((T *)NULL);
+  int iProcessor, nRequest = 0;
+  unsigned long *nSend = new unsigned long[size], *nRecv = new unsigned long[size];
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    nSend[iProcessor] = Send[iProcessor].size();
+
+  MPI_Alltoall(nSend, 1, MPI_UNSIGNED_LONG, nRecv, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  MPI_Request *Request = new MPI_Request[2*size];
+  MPI_Status *Status = new MPI_Status[2*size];
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    Recv[iProcessor].resize(nRecv[iProcessor]);
+    if (nRecv[iProcessor] > 0)
+      MPI_Irecv(&Recv[iProcessor][0], nRecv[iProcessor], datatype, iProcessor, 0,
+                MPI_COMM_WORLD, &Request[nRequest++]);
+    if (nSend[iProcessor] > 0)
+      MPI_Isend(&Send[iProcessor][0], nSend[iProcessor], datatype, iProcessor, 0,
+                MPI_COMM_WORLD, &Request[nRequest++]);
+  }
+  MPI_Waitall(nRequest, Request, Status);
+
+  delete [] nSend; delete [] nRecv;
+  delete [] Request; delete [] Status;
+
+#else
+  Recv[MASTER_NODE] = Send[MASTER_NODE];
+#endif
+
+}
+
+void CDiscAdjFEASolver::SetHelmholtz_Operator(CGeometry *geometry, CConfig *config){
+
+  unsigned long iElem, iPoint, iRow, iGhost, iRecord, iFace_Nb, index, nnz, *row_ptr, *col_ind,
+  nRow, nGhost, Offset, Global_Index;
+  unsigned short iDim, iFace, iNode, nNodes, nNodesFace;
+  int iProcessor, jProcessor, iNeighbor;
+  su2double eps = config->GetHelmholtzFactor(), Face_CG[3], Face_Area, Distance, Weight,
+  Vector_0[3], Vector_1[3], Vector_2[3], Cross[3], Volume, MyTotal_Volume, Total_Volume,
+  Length_Ref, *Coord_0, *Coord_1;
+  unsigned long nElem = geometry->GetnElem(), Global_nElem;
+  vector<unsigned long> Neighbors;
+  vector<unsigned long>::iterator it;
+
+  /*--- Elements are identified across the partitions by the sorted global
+   indices of their nodes, and faces by those of the face nodes ---*/
+
+  const unsigned short nKey_Elem = 8, nKey_Face = 4;
+  vector<unsigned long> Key_Elem(nKey_Elem), Key_Face(nKey_Face);
+
+  int rank = MASTER_NODE, size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  if (rank == MASTER_NODE) cout << "Assembling the Helmholtz filter on the element dual graph." << endl;
+
+  /*--- Rows of the elements owned by this rank, the elements without halo
+   points; every element of the mesh has exactly one owner ---*/
+
+  vector<bool> Halo;
+  geometry->GetHalo_Points(config, Halo);
+
+  Filter_Row.assign(nElem, -1);
+  nRow = 0;
+  for (iElem = 0; iElem < nElem; iElem++) {
+    bool Owned = true;
+    for (iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+      if (Halo[geometry->elem[iElem]->GetNode(iNode)]) Owned = false;
+    if (Owned) Filter_Row[iElem] = nRow++;
+  }
+  Filter_nRow = nRow;
+
+  /*--- Global index of the rows, the owned elements of each rank are contiguous ---*/
+
+  unsigned long *nRow_Rank = new unsigned long[size];
+#ifdef HAVE_MPI
+  MPI_Allgather(&nRow, 1, MPI_UNSIGNED_LONG, nRow_Rank, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  nRow_Rank[MASTER_NODE] = nRow;
+#endif
+  Offset = 0; Global_nElem = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (iProcessor < rank) Offset += nRow_Rank[iProcessor];
+    Global_nElem += nRow_Rank[iProcessor];
+  }
+  delete [] nRow_Rank;
+
+  /*--- Owner of the halo copies of the elements. The keys are sent to the rank
+   of their smallest node (directory), which matches the copies with the owned
+   element and tells the owner where its row is needed. Records: key, element,
+   global row (ULONG_MAX for the copies). ---*/
+
+  vector<vector<unsigned long> > Send(size), Recv(size);
+
+  for (iElem = 0; iElem < nElem; iElem++) {
+    nNodes = geometry->elem[iElem]->GetnNodes();
+    for (iNode = 0; iNode < nKey_Elem; iNode++)
+      Key_Elem[iNode] = (iNode < nNodes ? geometry->node[geometry->elem[iElem]->GetNode(iNode)]->GetGlobalIndex() : ULONG_MAX);
+    sort(Key_Elem.begin(), Key_Elem.end());
+    iProcessor = Key_Elem[0] % size;
+    Send[iProcessor].insert(Send[iProcessor].end(), Key_Elem.begin(), Key_Elem.end());
+    Send[iProcessor].push_back(iElem);
+    Send[iProcessor].push_back(Filter_Row[iElem] >= 0 ? Offset+Filter_Row[iElem] : ULONG_MAX);
+  }
+
+  Exchange_Filter(Send, Recv);
+
+  map<vector<unsigned long>, pair<int, unsigned long> > Elem_Owner;
+  map<vector<unsigned long>, pair<int, unsigned long> >::iterator it_Owner;
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    for (iRecord = 0; iRecord < Recv[iProcessor].size(); iRecord += nKey_Elem+2)
+      if (Recv[iProcessor][iRecord+nKey_Elem+1] != ULONG_MAX) {
+        vector<unsigned long> Key(&Recv[iProcessor][iRecord], &Recv[iProcessor][iRecord+nKey_Elem]);
+        Elem_Owner[Key] = make_pair(iProcessor, Recv[iProcessor][iRecord+nKey_Elem+1]);
+      }
+
+  /*--- Replies: (0, element, global row, owner) to the rank of the copy and
+   (1, 0, global row, rank of the copy) to the owner ---*/
+
+  Send.assign(size, vector<unsigned long>());
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    for (iRecord = 0; iRecord < Recv[iProcessor].size(); iRecord += nKey_Elem+2)
+      if (Recv[iProcessor][iRecord+nKey_Elem+1] == ULONG_MAX) {
+        vector<unsigned long> Key(&Recv[iProcessor][iRecord], &Recv[iProcessor][iRecord+nKey_Elem]);
+        it_Owner = Elem_Owner.find(Key);
+        if (it_Owner == Elem_Owner.end()) continue;
+        jProcessor = it_Owner->second.first;
+        Send[iProcessor].push_back(0); Send[iProcessor].push_back(Recv[iProcessor][iRecord+nKey_Elem]);
+        Send[iProcessor].push_back(it_Owner->second.second); Send[iProcessor].push_back(jProcessor);
+        Send[jProcessor].push_back(1); Send[jProcessor].push_back(0);
+        Send[jProcessor].push_back(it_Owner->second.second); Send[jProcessor].push_back(iProcessor);
+      }
+  Elem_Owner.clear();
+
+  Exchange_Filter(Send, Recv);
+
+  /*--- Halo rows (rank, global row) and the global rows to send to each rank ---*/
+
+  set<pair<int, unsigned long> > Ghost;
+  vector<set<unsigned long> > Send_Row(size);
+  vector<pair<unsigned long, pair<int, unsigned long> > > Halo_Elem;
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    for (iRecord = 0; iRecord < Recv[iProcessor].size(); iRecord += 4) {
+      if (Recv[iProcessor][iRecord] == 0) {
+        pair<int, unsigned long> Row((int)Recv[iProcessor][iRecord+3], Recv[iProcessor][iRecord+2]);
+        Ghost.insert(Row);
+        Halo_Elem.push_back(make_pair(Recv[iProcessor][iRecord+1], Row));
+      }
+      else Send_Row[Recv[iProcessor][iRecord+3]].insert(Recv[iProcessor][iRecord+2]);
+    }
+
+  /*--- Faces of the owned elements, matched in the same way. Records: key,
+   row, face, global row, and the center of gravity of the element. ---*/
+
+  vector<vector<passivedouble> > Send_CG(size), Recv_CG(size);
+  Send.assign(size, vector<unsigned long>());
+
+  for (iElem = 0; iElem < nElem; iElem++) {
+    if (Filter_Row[iElem] < 0) continue;
+    for (iFace = 0; iFace < geometry->elem[iElem]->GetnFaces(); iFace++) {
+      nNodesFace = geometry->elem[iElem]->GetnNodesFace(iFace);
+      for (iNode = 0; iNode < nKey_Face; iNode++)
+        Key_Face[iNode] = (iNode < nNodesFace ?
+                           geometry->node[geometry->elem[iElem]->GetNode(geometry->elem[iElem]->GetFaces(iFace, iNode))]->GetGlobalIndex() : ULONG_MAX);
+      sort(Key_Face.begin(), Key_Face.end());
+      iProcessor = Key_Face[0] % size;
+      Send[iProcessor].insert(Send[iProcessor].end(), Key_Face.begin(), Key_Face.end());
+      Send[iProcessor].push_back(Filter_Row[iElem]);
+      Send[iProcessor].push_back(iFace);
+      Send[iProcessor].push_back(Offset+Filter_Row[iElem]);
+      for (iDim = 0; iDim < 3; iDim++)
+        Send_CG[iProcessor].push_back(iDim < nDim ? SU2_TYPE::GetValue(geometry->elem[iElem]->GetCG(iDim)) : 0.0);
+    }
+  }
+
+  Exchange_Filter(Send, Recv);
+  Exchange_Filter(Send_CG, Recv_CG);
+
+  /*--- Each interior face is received twice, both sides get the other one:
+   (row, face, global row of the neighbor, rank of the neighbor) ---*/
+
+  map<vector<unsigned long>, pair<int, unsigned long> > Face_First;
+  map<vector<unsigned long>, pair<int, unsigned long> >::iterator it_Face;
+
+  Send.assign(size, vector<unsigned long>());
+  Send_CG.assign(size, vector<passivedouble>());
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    for (iRecord = 0; iRecord < Recv[iProcessor].size()/(nKey_Face+3); iRecord++) {
+      unsigned long *Record = &Recv[iProcessor][iRecord*(nKey_Face+3)];
+      vector<unsigned long> Key(Record, Record+nKey_Face);
+      it_Face = Face_First.find(Key);
+      if (it_Face == Face_First.end()) { Face_First[Key] = make_pair(iProcessor, iRecord); continue; }
+      jProcessor = it_Face->second.first;
+      unsigned long *Other = &Recv[jProcessor][it_Face->second.second*(nKey_Face+3)];
+      Send[iProcessor].push_back(Record[nKey_Face]); Send[iProcessor].push_back(Record[nKey_Face+1]);
+      Send[iProcessor].push_back(Other[nKey_Face+2]); Send[iProcessor].push_back(jProcessor);
+      Send[jProcessor].push_back(Other[nKey_Face]); Send[jProcessor].push_back(Other[nKey_Face+1]);
+      Send[jProcessor].push_back(Record[nKey_Face+2]); Send[jProcessor].push_back(iProcessor);
+      for (iDim = 0; iDim < 3; iDim++) {
+        Send_CG[iProcessor].push_back(Recv_CG[jProcessor][3*it_Face->second.second+iDim]);
+        Send_CG[jProcessor].push_back(Recv_CG[iProcessor][3*iRecord+iDim]);
+      }
+    }
+  Face_First.clear();
+
+  Exchange_Filter(Send, Recv);
+  Exchange_Filter(Send_CG, Recv_CG);
+
+  /*--- Faces between the owned rows and their neighbors, the neighbors of
+   other ranks are halo rows ---*/
+
+  vector<unsigned long> Face_Row, Face_Index, Face_Global;
+  vector<int> Face_Rank;
+  vector<passivedouble> Face_CG_Nb;
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    for (iRecord = 0; iRecord < Recv[iProcessor].size()/4; iRecord++) {
+      iRow = Recv[iProcessor][4*iRecord];
+      Global_Index = Recv[iProcessor][4*iRecord+2];
+      jProcessor = Recv[iProcessor][4*iRecord+3];
+      Face_Row.push_back(iRow);
+      Face_Index.push_back(Recv[iProcessor][4*iRecord+1]);
+      Face_Global.push_back(Global_Index);
+      Face_Rank.push_back(jProcessor);
+      for (iDim = 0; iDim < 3; iDim++) Face_CG_Nb.push_back(Recv_CG[iProcessor][3*iRecord+iDim]);
+      if (jProcessor != rank) {
+        Ghost.insert(make_pair(jProcessor, Global_Index));
+        Send_Row[jProcessor].insert(Offset+iRow);
+      }
+    }
+
+  /*--- Number the halo rows by rank and global row, which is also the order
+   in which the owner sends them ---*/
+
+  map<pair<int, unsigned long>, unsigned long> Ghost_Row;
+  set<pair<int, unsigned long> >::iterator it_Ghost;
+  set<unsigned long>::iterator it_Send;
+  vector<int> Neighbor_Rank;
+  vector<vector<unsigned long> > Neighbor_Send, Neighbor_Recv;
+
+  nGhost = 0;
+  for (it_Ghost = Ghost.begin(); it_Ghost != Ghost.end(); it_Ghost++)
+    Ghost_Row[*it_Ghost] = nRow + nGhost++;
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    vector<unsigned long> Rows_Send, Rows_Recv;
+    for (it_Send = Send_Row[iProcessor].begin(); it_Send != Send_Row[iProcessor].end(); it_Send++)
+      Rows_Send.push_back(*it_Send - Offset);
+    for (it_Ghost = Ghost.begin(); it_Ghost != Ghost.end(); it_Ghost++)
+      if (it_Ghost->first == iProcessor) Rows_Recv.push_back(Ghost_Row[*it_Ghost]);
+    if (Rows_Send.empty() && Rows_Recv.empty()) continue;
+    Neighbor_Rank.push_back(iProcessor);
+    Neighbor_Send.push_back(Rows_Send);
+    Neighbor_Recv.push_back(Rows_Recv);
+  }
+
+  for (iGhost = 0; iGhost < Halo_Elem.size(); iGhost++)
+    Filter_Row[Halo_Elem[iGhost].first] = Ghost_Row[Halo_Elem[iGhost].second];
+
+  /*--- Column of the neighbor of each face ---*/
+
+  vector<unsigned long> Face_Col(Face_Row.size());
+  for (iFace_Nb = 0; iFace_Nb < Face_Row.size(); iFace_Nb++)
+    Face_Col[iFace_Nb] = (Face_Rank[iFace_Nb] == rank ? Face_Global[iFace_Nb]-Offset :
+                          Ghost_Row[make_pair(Face_Rank[iFace_Nb], Face_Global[iFace_Nb])]);
+
+  /*--- Sparsity pattern: each owned element is coupled with the elements that
+   share one of its faces, the halo rows only have the diagonal ---*/
+
+  vector<vector<unsigned long> > Row_Neighbors(nRow);
+  for (iFace_Nb = 0; iFace_Nb < Face_Row.size(); iFace_Nb++)
+    Row_Neighbors[Face_Row[iFace_Nb]].push_back(Face_Col[iFace_Nb]);
+
+  row_ptr = new unsigned long [nRow+nGhost+1];
+  row_ptr[0] = 0;
+  for (iRow = 0; iRow < nRow+nGhost; iRow++) {
+    if (iRow < nRow) {
+      Neighbors = Row_Neighbors[iRow];
+      Neighbors.push_back(iRow);
+      sort(Neighbors.begin(), Neighbors.end());
+      Row_Neighbors[iRow].assign(Neighbors.begin(), unique(Neighbors.begin(), Neighbors.end()));
+      row_ptr[iRow+1] = row_ptr[iRow] + Row_Neighbors[iRow].size();
+    }
+    else row_ptr[iRow+1] = row_ptr[iRow] + 1;
+  }
+  nnz = row_ptr[nRow+nGhost];
+
+  col_ind = new unsigned long [nnz];
+  for (iRow = 0; iRow < nRow+nGhost; iRow++) {
+    if (iRow < nRow) {
+      index = row_ptr[iRow];
+      for (it = Row_Neighbors[iRow].begin(); it != Row_Neighbors[iRow].end(); it++) {
+        col_ind[index] = *it;
+        index++;
+      }
+    }
+    else col_ind[row_ptr[iRow]] = iRow;
+  }
+
+  /*--- The matrix takes ownership of row_ptr and col_ind, the operator is
+   allocated again when the mesh changes ---*/
+
+  if (FilterMatrix != NULL) delete FilterMatrix;
+  if (FilterRhs    != NULL) delete FilterRhs;
+  if (FilterSol    != NULL) delete FilterSol;
+
+  FilterMatrix = new CSysMatrix();
+  FilterMatrix->SetIndexes(nRow+nGhost, nRow, 1, 1, row_ptr, col_ind, nnz, config);
+  FilterMatrix->SetValZero();
+  FilterMatrix->SetSendReceive_Local(Neighbor_Rank, Neighbor_Send, Neighbor_Recv);
+
+  FilterRhs = new CSysVector(nRow+nGhost, nRow, 1, 0.0);
+  FilterSol = new CSysVector(nRow+nGhost, nRow, 1, 0.0);
+
+  /*--- Element volumes, computed from the faces and the center of gravity
+   (triangles in 2D, tetrahedra over a fan of the face in 3D). ---*/
+
+  if (FilterVolume == NULL) FilterVolume = new su2double [nElem];
+
+  for (iDim = 0; iDim < 3; iDim++) {
+    Vector_0[iDim] = 0.0; Vector_1[iDim] = 0.0; Vector_2[iDim] = 0.0; Face_CG[iDim] = 0.0;
+  }
+
+  MyTotal_Volume = 0.0;
+  for (iElem = 0; iElem < nElem; iElem++) {
+    Volume = 0.0;
+    for (iFace = 0; iFace < geometry->elem[iElem]->GetnFaces(); iFace++) {
+      nNodesFace = geometry->elem[iElem]->GetnNodesFace(iFace);
+      for (iDim = 0; iDim < nDim; iDim++) Face_CG[iDim] = 0.0;
+      for (iNode = 0; iNode < nNodesFace; iNode++) {
+        iPoint = geometry->elem[iElem]->GetNode(geometry->elem[iElem]->GetFaces(iFace, iNode));
+        for (iDim = 0; iDim < nDim; iDim++) Face_CG[iDim] += geometry->node[iPoint]->GetCoord(iDim)/su2double(nNodesFace);
+      }
+      for (iNode = 0; iNode < nNodesFace; iNode++) {
+        Coord_0 = geometry->node[geometry->elem[iElem]->GetNode(geometry->elem[iElem]->GetFaces(iFace, iNode))]->GetCoord();
+        Coord_1 = geometry->node[geometry->elem[iElem]->GetNode(geometry->elem[iElem]->GetFaces(iFace, (iNode+1)%nNodesFace))]->GetCoord();
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Vector_0[iDim] = Coord_0[iDim] - geometry->elem[iElem]->GetCG(iDim);
+          Vector_1[iDim] = Coord_1[iDim] - geometry->elem[iElem]->GetCG(iDim);
+          Vector_2[iDim] = Face_CG[iDim] - geometry->elem[iElem]->GetCG(iDim);
+        }
+        if (nDim == 2) {
+          if (iNode == 0) Volume += 0.5*fabs(Vector_0[0]*Vector_1[1]-Vector_0[1]*Vector_1[0]);
+        }
+        else {
+          Cross[0] = Vector_0[1]*Vector_1[2]-Vector_0[2]*Vector_1[1];
+          Cross[1] = Vector_0[2]*Vector_1[0]-Vector_0[0]*Vector_1[2];
+          Cross[2] = Vector_0[0]*Vector_1[1]-Vector_0[1]*Vector_1[0];
+          Volume += fabs(Cross[0]*Vector_2[0]+Cross[1]*Vector_2[1]+Cross[2]*Vector_2[2])/6.0;
+        }
+      }
+    }
+    FilterVolume[iElem] = Volume;
+    if ((Filter_Row[iElem] >= 0) && ((unsigned long)Filter_Row[iElem] < nRow)) MyTotal_Volume += Volume;
+  }
+
+  /*--- Reference length: eps is given in units of the mean element size, so that the
+   operator reduces to the structured stencil (1+4eps^2, -eps^2) on a uniform grid. ---*/
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&MyTotal_Volume, &Total_Volume, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  Total_Volume = MyTotal_Volume;
+#endif
+  Length_Ref = pow(Total_Volume/su2double(Global_nElem), 1.0/su2double(nDim));
+
+  /*--- Assemble M + (eps*h)^2*K, with M the lumped element mass and K the
+   two-point flux Laplacian, weighted with the shared face area over the
+   distance between the element centers. The operator is symmetric. ---*/
+
+  vector<unsigned long> Row_Elem(nRow);
+  for (iElem = 0; iElem < nElem; iElem++)
+    if ((Filter_Row[iElem] >= 0) && ((unsigned long)Filter_Row[iElem] < nRow)) {
+      Row_Elem[Filter_Row[iElem]] = iElem;
+      FilterMatrix->AddVal2Diag(Filter_Row[iElem], FilterVolume[iElem]);
+    }
+  for (iRow = nRow; iRow < nRow+nGhost; iRow++)
+    FilterMatrix->AddVal2Diag(iRow, 1.0);
+
+  for (iFace_Nb = 0; iFace_Nb < Face_Row.size(); iFace_Nb++) {
+    iRow = Face_Row[iFace_Nb];
+    iElem = Row_Elem[iRow];
+    iFace = Face_Index[iFace_Nb];
+
+    nNodesFace = geometry->elem[iElem]->GetnNodesFace(iFace);
+    Coord_0 = geometry->node[geometry->elem[iElem]->GetNode(geometry->elem[iElem]->GetFaces(iFace, 0))]->GetCoord();
+    if (nDim == 2) {
+      Coord_1 = geometry->node[geometry->elem[iElem]->GetNode(geometry->elem[iElem]->GetFaces(iFace, 1))]->GetCoord();
+      Face_Area = sqrt(pow(Coord_1[0]-Coord_0[0], 2.0)+pow(Coord_1[1]-Coord_0[1], 2.0));
+    }
+    else {
+      for (iDim = 0; iDim < nDim; iDim++) Face_CG[iDim] = 0.0;
+      for (iNode = 0; iNode < nNodesFace; iNode++) {
+        iPoint = geometry->elem[iElem]->GetNode(geometry->elem[iElem]->GetFaces(iFace, iNode));
+        for (iDim = 0; iDim < nDim; iDim++) Face_CG[iDim] += geometry->node[iPoint]->GetCoord(iDim)/su2double(nNodesFace);
+      }
+      Face_Area = 0.0;
+      for (iNode = 0; iNode < nNodesFace; iNode++) {
+        Coord_0 = geometry->node[geometry->elem[iElem]->GetNode(geometry->elem[iElem]->GetFaces(iFace, iNode))]->GetCoord();
+        Coord_1 = geometry->node[geometry->elem[iElem]->GetNode(geometry->elem[iElem]->GetFaces(iFace, (iNode+1)%nNodesFace))]->GetCoord();
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Vector_0[iDim] = Coord_0[iDim] - Face_CG[iDim];
+          Vector_1[iDim] = Coord_1[iDim] - Face_CG[iDim];
+        }
+        Cross[0] = Vector_0[1]*Vector_1[2]-Vector_0[2]*Vector_1[1];
+        Cross[1] = Vector_0[2]*Vector_1[0]-Vector_0[0]*Vector_1[2];
+        Cross[2] = Vector_0[0]*Vector_1[1]-Vector_0[1]*Vector_1[0];
+        Face_Area += 0.5*sqrt(Cross[0]*Cross[0]+Cross[1]*Cross[1]+Cross[2]*Cross[2]);
+      }
+    }
+
+    Distance = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Distance += pow(Face_CG_Nb[3*iFace_Nb+iDim]-geometry->elem[iElem]->GetCG(iDim), 2.0);
+    Distance = sqrt(Distance);
+
+    Weight = eps*eps*Length_Ref*Length_Ref*Face_Area/Distance;
+    FilterMatrix->AddVal2Diag(iRow, Weight);
+    FilterMatrix->SetEntry(iRow, Face_Col[iFace_Nb], 0, 0, -Weight);
+  }
+
+  /*--- The preconditioner is kept until the operator is assembled again ---*/
+
+  if (config->GetKind_HelmholtzLinSolver_Prec() == AMG) FilterMatrix->BuildAMGPreconditioner(config);
+  else FilterMatrix->BuildJacobiPreconditioner();
+
+  FilterMatrix_Built = true;
+  FilterMatrix_Coord = geometry->GetCoord_Version();
+
+}
+
+void CDiscAdjFEASolver::HelmholtzFiltering(CGeometry *geometry, CConfig *config){
+
+  unsigned long iElem, nElem = geometry->GetnElem();
+
+  /*--- The operator depends on the coordinates, it is assembled again after
+   the mesh has moved or deformed ---*/
+
+  if (FilterMatrix_Coord != geometry->GetCoord_Version()) FilterMatrix_Built = false;
+  if (!FilterMatrix_Built) SetHelmholtz_Operator(geometry, config);
+
+  /*--- Right-hand side M*u, the previous update is the initial guess ---*/
+
+  for (iElem = 0; iElem < nElem; iElem++) {
+    if (Filter_Row[iElem] < 0) continue;
+    if ((unsigned long)Filter_Row[iElem] < Filter_nRow)
+      (*FilterRhs)[Filter_Row[iElem]] = FilterVolume[iElem]*UpdateSens[iElem];
+    (*FilterSol)[Filter_Row[iElem]] = UpdateSens[iElem];
+  }
+  FilterMatrix->SendReceive_Local(*FilterSol);
+
+  CSysMatrixVectorProductLocal mat_vec(*FilterMatrix);
+  CPreconditioner *precond;
+
+  /*--- The unknowns are elements, the products exchange the halo elements
+   with the pattern of the filter matrix (NULL geometry) ---*/
+
+  if (config->GetKind_HelmholtzLinSolver_Prec() == AMG) precond = new CAMGPreconditioner(*FilterMatrix, NULL, config);
+  else precond = new CJacobiPreconditionerLocal(*FilterMatrix);
+
+  CSysSolve system;
+  system.CG_LinSolver(*FilterRhs, *FilterSol, mat_vec, *precond, config->GetHelmholtzLinSolver_Error(),
+                      config->GetHelmholtzLinSolver_Iter(), false);
+
+  delete precond;
+
+  /*--- Every local element, owned or halo copy, takes the value of its owner ---*/
+
+  FilterMatrix->SendReceive_Local(*FilterSol);
+
+  for (iElem = 0; iElem < nElem; iElem++)
+    if (Filter_Row[iElem] >= 0) UpdateSens[iElem] = (*FilterSol)[Filter_Row[iElem]];
+
+}
+
 void CDiscAdjFEASolver::GaussElimination(su2double** A, su2double* b, unsigned long nElemx){
     unsigned long iElem,jElem;
     su2double **HelpOne=new su2double*[nElemx];
@@ -203,6 +203,8 @@ CAdjTurbSolver::~CAdjTurbSolver(void) {
 }
 
 void CAdjTurbSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
 	unsigned short iVar, iMarker, MarkerS, MarkerR;
 	unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
 	su2double *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
@@ -275,9 +277,13 @@ void CAdjTurbSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
     
 	}
   
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CAdjTurbSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
 	unsigned short iVar, iMarker, MarkerS, MarkerR;
 	unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
 	su2double *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
@@ -350,9 +356,14 @@ void CAdjTurbSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config)
     }
     
 	}
+  
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CAdjTurbSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
 	unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
 	unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
 	su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
@@ -472,6 +483,8 @@ void CAdjTurbSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *con
     delete [] Gradient[iVar];
   delete [] Gradient;
   
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CAdjTurbSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
@@ -86,6 +86,11 @@ CFEM_ElasticitySolver::CFEM_ElasticitySolver(void) : CSolver() {
 
   DV_Val      = NULL;
 
+  Kab_Cache        = NULL;
+  Kab_Cache_Active = false;
+  Kab_Cache_Built  = false;
+  Kab_Cache_Coord  = 0;
+
 }
 
 CFEM_ElasticitySolver::CFEM_ElasticitySolver(CGeometry *geometry, CConfig *config) : CSolver() {
@@ -203,10 +208,7 @@ CFEM_ElasticitySolver::CFEM_ElasticitySolver(CGeometry *geometry, CConfig *confi
 
   /*--- The length of the solution vector depends on whether the problem is static or dynamic ---*/
   unsigned short nSolVar;
-  unsigned long index;
-  string text_line, filename;
-  ifstream restart_file;
-  su2double dull_val;
+  string filename;
   long Dyn_RestartIter;
 
   if (dynamic) nSolVar = 3 * nVar;
@@ -241,88 +243,14 @@ CFEM_ElasticitySolver::CFEM_ElasticitySolver(CGeometry *geometry, CConfig *confi
       filename = config->GetUnsteady_FileName(filename, (int)Dyn_RestartIter);
     }
 
-    restart_file.open(filename.data(), ios::in);
-
-    /*--- In case there is no file ---*/
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no FEM restart file!!" << endl;
-      exit(EXIT_FAILURE);
-    }
-
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
-
-    long *Global2Local = new long[geometry->GetGlobal_nPointDomain()];
-
-    /*--- First, set all indices to a negative value by default ---*/
-
-    for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++)
-      Global2Local[iPoint] = -1;
-
-    /*--- Now fill array with the transform values only for local points ---*/
-
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-
-    /*--- Read all lines in the restart file ---*/
+    /*--- Read the restart file. The values of a point are the node coordinates,
+     the displacements and, for dynamic problems, the velocities and accelerations. ---*/
 
-    long iPoint_Local;
-    unsigned long iPoint_Global_Local = 0, iPoint_Global = 0; string text_line;
-    unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
-
-    /*--- The first line is the header ---*/
-
-    getline (restart_file, text_line);
-
-    while (getline (restart_file, text_line)) {
-      istringstream point_line(text_line);
-
-      /*--- Retrieve local index. If this node from the restart file lives
-       on a different processor, the value of iPoint_Local will be -1.
-       Otherwise, the local index for this node on the current processor
-       will be returned and used to instantiate the vars. ---*/
-
-      iPoint_Local = Global2Local[iPoint_Global];
-
-      if (iPoint_Local >= 0) {
-        if (dynamic){
-          if (nDim == 2) point_line >> index >> dull_val >> dull_val >> SolRest[0] >> SolRest[1] >> SolRest[2] >> SolRest[3] >> SolRest[4] >> SolRest[5];
-          if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> SolRest[0] >> SolRest[1] >> SolRest[2] >> SolRest[3] >> SolRest[4] >> SolRest[5] >> SolRest[6] >> SolRest[7] >> SolRest[8];
-        }
-        else {
-          if (nDim == 2) point_line >> index >> dull_val >> dull_val >> SolRest[0] >> SolRest[1];
-          if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> SolRest[0] >> SolRest[1] >> SolRest[2];
-        }
+    Read_Restart_File(geometry, config, filename);
 
-        node[iPoint_Local] = new CFEM_ElasVariable(SolRest, nDim, nVar, config);
-        iPoint_Global_Local++;
-      }
-      iPoint_Global++;
-    }
-
-    /*--- Detect a wrong solution file ---*/
-
-    if (iPoint_Global_Local < nPointDomain) { sbuf_NotMatching = 1; }
-
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
-#else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-
-    if (rbuf_NotMatching != 0) {
-      if (rank == MASTER_NODE) {
-        cout << endl << "The solution file " << filename.data() << " doesn't match with the mesh file!" << endl;
-        cout << "It could be empty lines at the end of the file." << endl << endl;
-      }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
-#endif
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (iVar = 0; iVar < nSolVar; iVar++) SolRest[iVar] = Restart_Data[iPoint*Restart_Fields.size()+nDim+iVar];
+      node[iPoint] = new CFEM_ElasVariable(SolRest, nDim, nVar, config);
     }
 
     /*--- Instantiate the variable class with an arbitrary solution
@@ -333,14 +261,7 @@ CFEM_ElasticitySolver::CFEM_ElasticitySolver(CGeometry *geometry, CConfig *confi
       node[iPoint] = new CFEM_ElasVariable(SolRest, nDim, nVar, config);
     }
 
-
-    /*--- Close the restart file ---*/
-
-    restart_file.close();
-
-    /*--- Free memory needed for the transformation ---*/
-
-    delete [] Global2Local;
+    Clear_Restart_Data();
 
   }
 
@@ -651,6 +572,49 @@ CFEM_ElasticitySolver::CFEM_ElasticitySolver(CGeometry *geometry, CConfig *confi
   Emin = config->GetEmin();
   //Emin=1E-9;
 
+  /*--- For linear elastic materials under small deformations, the element stiffness
+   only changes with the SIMP factor. The unscaled blocks can be cached, which takes
+   nNodes^2*nVar^2 values per element; nonlinear models are always recomputed. ---*/
+
+  Kab_Cache        = NULL;
+  Kab_Cache_Built  = false;
+  Kab_Cache_Coord  = 0;
+  Kab_Cache_Active = (config->GetFEA_StiffnessCache() &&
+                      (config->GetGeometricConditions() == SMALL_DEFORMATIONS) &&
+                      (config->GetMaterialModel() == LINEAR_ELASTIC) &&
+                      !config->GetDE_Effects());
+
+  if (config->GetFEA_StiffnessCache() && !Kab_Cache_Active && (rank == MASTER_NODE))
+    cout << "The stiffness cache is only available for linear elastic materials, the element stiffness will be recomputed." << endl;
+
+  if (Kab_Cache_Active) {
+
+    unsigned long iElem, MyCache_Size = 0, Cache_Size;
+    unsigned short nNodes;
+
+    for (iElem = 0; iElem < nElement; iElem++) {
+      nNodes = geometry->elem[iElem]->GetnNodes();
+      MyCache_Size += nNodes*nNodes*nVar*nVar;
+    }
+
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(&MyCache_Size, &Cache_Size, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#else
+    Cache_Size = MyCache_Size;
+#endif
+
+    if (rank == MASTER_NODE)
+      cout << "Caching the element stiffness matrices: " << su2double(Cache_Size*sizeof(passivedouble))/(1024.0*1024.0)
+           << " MB in total." << endl;
+
+    Kab_Cache = new passivedouble* [nElement];
+    for (iElem = 0; iElem < nElement; iElem++) {
+      nNodes = geometry->elem[iElem]->GetnNodes();
+      Kab_Cache[iElem] = new passivedouble [nNodes*nNodes*nVar*nVar];
+    }
+
+  }
+
 }
 
 CFEM_ElasticitySolver::~CFEM_ElasticitySolver(void) {
@@ -698,9 +662,17 @@ CFEM_ElasticitySolver::~CFEM_ElasticitySolver(void) {
   if (iElem_iDe != NULL) delete [] iElem_iDe;
   if (DV_Val != NULL) delete[] DV_Val;
 
+  if (Kab_Cache != NULL) {
+    for (unsigned long iElem = 0; iElem < nElement; iElem++)
+      delete [] Kab_Cache[iElem];
+    delete [] Kab_Cache;
+  }
+
 }
 
 void CFEM_ElasticitySolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
 
 
   unsigned short iVar, iMarker, MarkerS, MarkerR;
@@ -805,10 +777,14 @@ void CFEM_ElasticitySolver::Set_MPI_Solution(CGeometry *geometry, CConfig *confi
     }
 
   }
-
+  
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CFEM_ElasticitySolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
 
 
   unsigned short iVar, iMarker, MarkerS, MarkerR;
@@ -897,10 +873,14 @@ void CFEM_ElasticitySolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *c
     }
 
   }
-
+  
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CFEM_ElasticitySolver::Set_MPI_Solution_DispOnly(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
 
 
   unsigned short iVar, iMarker, MarkerS, MarkerR;
@@ -979,10 +959,14 @@ void CFEM_ElasticitySolver::Set_MPI_Solution_DispOnly(CGeometry *geometry, CConf
     }
 
   }
-
+  
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CFEM_ElasticitySolver::Set_MPI_Solution_Pred(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
 
 
   unsigned short iVar, iMarker, MarkerS, MarkerR;
@@ -1057,10 +1041,14 @@ void CFEM_ElasticitySolver::Set_MPI_Solution_Pred(CGeometry *geometry, CConfig *
     }
 
   }
-
+  
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CFEM_ElasticitySolver::Set_MPI_Solution_Pred_Old(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
 
   /*--- We are communicating the solution predicted, current and old, and the old solution ---*/
   /*--- necessary for the Aitken relaxation ---*/
@@ -1147,7 +1135,9 @@ void CFEM_ElasticitySolver::Set_MPI_Solution_Pred_Old(CGeometry *geometry, CConf
     }
 
   }
-
+  
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CFEM_ElasticitySolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *config, int val_iter) {
@@ -1173,14 +1163,7 @@ void CFEM_ElasticitySolver::LoadRestart(CGeometry **geometry, CSolver ***solver,
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 #endif
 
-  /*--- The length of the solution vector depends on whether the problem is static or dynamic ---*/
-  unsigned short nSolVar;
-  unsigned long index;
-  string text_line, filename;
-  ifstream restart_file;
-  su2double dull_val;
-  long Dyn_RestartIter;
-
+  string filename;
 
   /*--- Restart the solution from file information ---*/
 
@@ -1194,96 +1177,21 @@ void CFEM_ElasticitySolver::LoadRestart(CGeometry **geometry, CSolver ***solver,
     filename = config->GetUnsteady_FileName(filename, val_iter);
   }
 
-  restart_file.open(filename.data(), ios::in);
-
-  /*--- In case there is no file ---*/
-  if (restart_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no FEM restart file!!" << endl;
-    exit(EXIT_FAILURE);
-  }
-
-  /*--- In case this is a parallel simulation, we need to perform the
-   Global2Local index transformation first. ---*/
-
-  long *Global2Local = new long[geometry[MESH_0]->GetGlobal_nPointDomain()];
-
-  /*--- First, set all indices to a negative value by default ---*/
-
-  for (iPoint = 0; iPoint < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint++)
-    Global2Local[iPoint] = -1;
-
-  /*--- Now fill array with the transform values only for local points ---*/
-
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-    Global2Local[geometry[MESH_0]->node[iPoint]->GetGlobalIndex()] = iPoint;
-
-  /*--- Read all lines in the restart file ---*/
-
-  long iPoint_Local;
-  unsigned long iPoint_Global_Local = 0, iPoint_Global = 0;
-  unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
-
-  /*--- The first line is the header ---*/
-
-  getline (restart_file, text_line);
+  /*--- Read the restart file. The values of a point are the node coordinates,
+   the displacements and, for dynamic problems, the velocities and accelerations. ---*/
 
-  while (getline (restart_file, text_line)) {
-    istringstream point_line(text_line);
+  Read_Restart_File(geometry[MESH_0], config, filename);
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on a different processor, the value of iPoint_Local will be -1.
-     Otherwise, the local index for this node on the current processor
-     will be returned and used to instantiate the vars. ---*/
-
-    iPoint_Local = Global2Local[iPoint_Global];
-
-    if (iPoint_Local >= 0) {
-      if (dynamic){
-        if (nDim == 2) point_line >> index >> dull_val >> dull_val >> SolRest[0] >> SolRest[1] >> SolRest[2] >> SolRest[3] >> SolRest[4] >> SolRest[5];
-        if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> SolRest[0] >> SolRest[1] >> SolRest[2] >> SolRest[3] >> SolRest[4] >> SolRest[5] >> SolRest[6] >> SolRest[7] >> SolRest[8];
-      }
-      else {
-        if (nDim == 2) point_line >> index >> dull_val >> dull_val >> SolRest[0] >> SolRest[1];
-        if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> SolRest[0] >> SolRest[1] >> SolRest[2];
-      }
-
-//      node[iPoint_Local] = new CFEM_ElasVariable(SolRest, nDim, nVar, config);
-
-      for (iVar = 0; iVar < nVar; iVar++) node[iPoint_Local]->SetSolution(iVar, SolRest[iVar]);
-      if (dynamic){
-        for (iVar = 0; iVar < nVar; iVar++) node[iPoint_Local]->SetSolution_Vel(iVar, SolRest[iVar+nVar]);
-        for (iVar = 0; iVar < nVar; iVar++) node[iPoint_Local]->SetSolution_Accel(iVar, SolRest[iVar+2*nVar]);
-      }
-
-      iPoint_Global_Local++;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    passivedouble *Values = &Restart_Data[iPoint*Restart_Fields.size()+nDim];
+    for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution(iVar, Values[iVar]);
+    if (dynamic){
+      for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution_Vel(iVar, Values[iVar+nVar]);
+      for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution_Accel(iVar, Values[iVar+2*nVar]);
     }
-    iPoint_Global++;
   }
 
-  /*--- Detect a wrong solution file ---*/
-
-  if (iPoint_Global_Local < nPointDomain) { sbuf_NotMatching = 1; }
-
-#ifndef HAVE_MPI
-  rbuf_NotMatching = sbuf_NotMatching;
-#else
-  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-
-  if (rbuf_NotMatching != 0) {
-    if (rank == MASTER_NODE) {
-      cout << endl << "The solution file " << filename.data() << " doesn't match with the mesh file!" << endl;
-      cout << "It could be empty lines at the end of the file." << endl << endl;
-    }
-#ifndef HAVE_MPI
-    exit(EXIT_FAILURE);
-#else
-    MPI_Barrier(MPI_COMM_WORLD);
-    MPI_Abort(MPI_COMM_WORLD,1);
-    MPI_Finalize();
-#endif
-  }
+  Clear_Restart_Data();
 
   /*--- Instantiate the variable class with an arbitrary solution
    at any halo/periodic nodes. The initial solution can be arbitrary,
@@ -1293,14 +1201,6 @@ void CFEM_ElasticitySolver::LoadRestart(CGeometry **geometry, CSolver ***solver,
 //    node[iPoint] = new CFEM_ElasVariable(SolRest, nDim, nVar, config);
 //  }
 
-  /*--- Close the restart file ---*/
-
-  restart_file.close();
-
-  /*--- Free memory needed for the transformation ---*/
-
-  delete [] Global2Local;
-
 
 }
 
@@ -1733,27 +1633,75 @@ void CFEM_ElasticitySolver::ResetInitialCondition(CGeometry **geometry, CSolver
 
 }
 
+void CFEM_ElasticitySolver::Get_ElemKind(CGeometry *geometry, unsigned long iElem, unsigned short &nNodes, int &EL_KIND) {
+
+  switch (geometry->elem[iElem]->GetVTK_Type()) {
+    case TRIANGLE:      nNodes = 3; EL_KIND = EL_TRIA;  break;
+    case QUADRILATERAL: nNodes = 4; EL_KIND = EL_QUAD;  break;
+    case TETRAHEDRON:   nNodes = 4; EL_KIND = EL_TETRA; break;
+    case PYRAMID:       nNodes = 5; EL_KIND = EL_TRIA;  break;
+    case PRISM:         nNodes = 6; EL_KIND = EL_TRIA;  break;
+    case HEXAHEDRON:    nNodes = 8; EL_KIND = EL_HEXA;  break;
+  }
+
+}
+
 void CFEM_ElasticitySolver::Compute_StiffMatrix(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
 
   unsigned long iElem, iVar, jVar;
   unsigned short iNode, iDim, nNodes = 0;
   unsigned long indexNode[8]={0,0,0,0,0,0,0,0};
-  su2double val_Coord;
+  su2double val_Coord, SIMP_Factor;
   int EL_KIND = 0;
 
   su2double *Kab = NULL;
+  passivedouble *Kab_Elem = NULL;
   unsigned short NelNodes, jNode;
 
+  /*--- The cached blocks depend on the coordinates, they are recomputed when the mesh moved
+   (SetCoord_CG is called after every deformation or change of the geometry) ---*/
+
+  if (Kab_Cache_Active && (Kab_Cache_Coord != geometry->GetCoord_Version())) Kab_Cache_Built = false;
+
+  /*--- Once the cache is filled, the stiffness matrix is a scaled scatter of the stored blocks ---*/
+
+  if (Kab_Cache_Active && Kab_Cache_Built) {
+
+    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+
+      Get_ElemKind(geometry, iElem, nNodes, EL_KIND);
+
+      for (iNode = 0; iNode < nNodes; iNode++)
+        indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+
+      NelNodes = element_container[FEA_TERM][EL_KIND]->GetnNodes();
+
+      SIMP_Factor = Emin + pow(geometry->elem[iElem]->GetDensity()[0],penal)*(1.0-Emin);
+      Kab_Elem = Kab_Cache[iElem];
+
+      for (iNode = 0; iNode < NelNodes; iNode++){
+        for (jNode = 0; jNode < NelNodes; jNode++){
+          for (iVar = 0; iVar < nVar; iVar++){
+            for (jVar = 0; jVar < nVar; jVar++){
+              Jacobian_ij[iVar][jVar] = SIMP_Factor*Kab_Elem[iVar*nVar+jVar];
+            }
+          }
+          Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_ij);
+          Kab_Elem += nVar*nVar;
+        }
+      }
+
+    }
+
+    return;
+
+  }
+
   /*--- Loops over all the elements ---*/
 
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
 
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      {nNodes = 3; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) {nNodes = 4; EL_KIND = EL_QUAD;}
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   {nNodes = 4; EL_KIND = EL_TETRA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       {nNodes = 5; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         {nNodes = 6; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    {nNodes = 8; EL_KIND = EL_HEXA;}
+    Get_ElemKind(geometry, iElem, nNodes, EL_KIND);
 
     /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
 
@@ -1771,6 +1719,9 @@ void CFEM_ElasticitySolver::Compute_StiffMatrix(CGeometry *geometry, CSolver **s
 
     NelNodes = element_container[FEA_TERM][EL_KIND]->GetnNodes();
 
+    SIMP_Factor = Emin + pow(geometry->elem[iElem]->GetDensity()[0],penal)*(1.0-Emin);
+    if (Kab_Cache_Active) Kab_Elem = Kab_Cache[iElem];
+
     for (iNode = 0; iNode < NelNodes; iNode++){
 
       for (jNode = 0; jNode < NelNodes; jNode++){
@@ -1779,18 +1730,31 @@ void CFEM_ElasticitySolver::Compute_StiffMatrix(CGeometry *geometry, CSolver **s
 
         for (iVar = 0; iVar < nVar; iVar++){
           for (jVar = 0; jVar < nVar; jVar++){
-            Jacobian_ij[iVar][jVar] = (Emin + pow(geometry->elem[iElem]->GetDensity()[0],penal)*(1.0-Emin))*Kab[iVar*nVar+jVar];
+            Jacobian_ij[iVar][jVar] = SIMP_Factor*Kab[iVar*nVar+jVar];
           }
         }
 
         Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_ij);
 
+        /*--- The cached blocks are passive, the dependence of Kab on the material
+         properties and coordinates is not recorded once the cache is in use. ---*/
+
+        if (Kab_Cache_Active) {
+          for (iVar = 0; iVar < nVar*nVar; iVar++)
+            Kab_Elem[iVar] = SU2_TYPE::GetValue(Kab[iVar]);
+          Kab_Elem += nVar*nVar;
+        }
+
       }
 
     }
 
   }
 
+  if (Kab_Cache_Active) {
+    Kab_Cache_Built = true;
+    Kab_Cache_Coord = geometry->GetCoord_Version();
+  }
 
 }
 
@@ -1820,12 +1784,7 @@ void CFEM_ElasticitySolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geomet
   /*--- Loops over all the elements ---*/
 
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      {nNodes = 3; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) {nNodes = 4; EL_KIND = EL_QUAD;}
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   {nNodes = 4; EL_KIND = EL_TETRA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       {nNodes = 5; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         {nNodes = 6; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    {nNodes = 8; EL_KIND = EL_HEXA;}
+    Get_ElemKind(geometry, iElem, nNodes, EL_KIND);
 
     /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
 
@@ -1948,13 +1907,7 @@ void CFEM_ElasticitySolver::Compute_MassMatrix(CGeometry *geometry, CSolver **so
 
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
 
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     {nNodes = 3; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL)    {nNodes = 4; EL_KIND = EL_QUAD;}
-
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  {nNodes = 4; EL_KIND = EL_TETRA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      {nNodes = 5; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)        {nNodes = 6; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   {nNodes = 8; EL_KIND = EL_HEXA;}
+    Get_ElemKind(geometry, iElem, nNodes, EL_KIND);
 
     /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
 
@@ -2008,12 +1961,7 @@ void CFEM_ElasticitySolver::Compute_NodalStressRes(CGeometry *geometry, CSolver
 
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
 
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     {nNodes = 3; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL){nNodes = 4; EL_KIND = EL_QUAD;}
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  {nNodes = 4; EL_KIND = EL_TETRA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      {nNodes = 5; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)        {nNodes = 6; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   {nNodes = 8; EL_KIND = EL_HEXA;}
+    Get_ElemKind(geometry, iElem, nNodes, EL_KIND);
 
     /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
 
@@ -2088,12 +2036,7 @@ void CFEM_ElasticitySolver::Compute_NodalStress(CGeometry *geometry, CSolver **s
 
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
 
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     {nNodes = 3; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL){nNodes = 4; EL_KIND = EL_QUAD;}
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  {nNodes = 4; EL_KIND = EL_TETRA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      {nNodes = 5; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)        {nNodes = 6; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   {nNodes = 8; EL_KIND = EL_HEXA;}
+    Get_ElemKind(geometry, iElem, nNodes, EL_KIND);
 
     /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
 
@@ -2358,12 +2301,7 @@ void CFEM_ElasticitySolver::Compute_DeadLoad(CGeometry *geometry, CSolver **solv
 
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
 
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     {nNodes = 3; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL){nNodes = 4; EL_KIND = EL_QUAD;}
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  {nNodes = 4; EL_KIND = EL_TETRA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      {nNodes = 5; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)        {nNodes = 6; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   {nNodes = 8; EL_KIND = EL_HEXA;}
+    Get_ElemKind(geometry, iElem, nNodes, EL_KIND);
 
     /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
 
@@ -62,529 +62,260 @@ CTurbSolver::~CTurbSolver(void) {
 }
 
 void CTurbSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector, nBufferS_Scalar, nBufferR_Scalar;
-  su2double *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL, *Buffer_Receive_muT = NULL, *Buffer_Send_muT = NULL;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  MPI_Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
+  /*--- The eddy viscosity travels with the solution ---*/
   
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      nBufferS_Scalar = nVertexS;             nBufferR_Scalar = nVertexR;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      Buffer_Receive_muT = new su2double [nBufferR_Scalar];
-      Buffer_Send_muT = new su2double[nBufferS_Scalar];
-      
-      /*--- Copy the solution that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_muT[iVertex] = node[iPoint]->GetmuT();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      SU2_MPI::Sendrecv(Buffer_Send_muT, nBufferS_Scalar, MPI_DOUBLE, send_to, 1,
-                   Buffer_Receive_muT, nBufferR_Scalar, MPI_DOUBLE, receive_from, 1, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        Buffer_Receive_muT[iVertex] = node[iPoint]->GetmuT();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      delete [] Buffer_Send_muT;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy conservative variables. ---*/
-        node[iPoint]->SetmuT(Buffer_Receive_muT[iVertex]);
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution(iVar, Buffer_Receive_U[iVar*nVertexR+iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_muT;
-      delete [] Buffer_Receive_U;
-      
-    }
-    
-  }
+  InitiateComms(geometry, config, COMM_SOLUTION_EDDY);
+  CompleteComms(geometry, config);
   
 }
 
 void CTurbSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  MPI_Status status;
-#endif
+  InitiateComms(geometry, config, COMM_SOLUTION_OLD);
+  CompleteComms(geometry, config);
   
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution_Old(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution_Old(iVar, Buffer_Receive_U[iVar*nVertexR+iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
-      
-    }
-    
-  }
 }
 
 void CTurbSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
-  
-  su2double **Gradient = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Gradient[iVar] = new su2double[nDim];
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  MPI_Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
- 
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar*nDim;        nBufferR_Vector = nVertexR*nVar*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nVar*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-        }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient(iVar, iDim, Gradient[iVar][iDim]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
-    }
-    
-  }
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
+  InitiateComms(geometry, config, COMM_SOLUTION_GRADIENT);
+  CompleteComms(geometry, config);
   
 }
 
 void CTurbSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
-  
-  su2double *Limiter = new su2double [nVar];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  MPI_Status status;
-#endif
   
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-  
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Limit = new su2double [nBufferR_Vector];
-      Buffer_Send_Limit = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Limit;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetLimiter(iVar, Buffer_Receive_Limit[iVar*nVertexR+iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Limit;
-      
-    }
-    
-  }
-  
-  delete [] Limiter;
+  InitiateComms(geometry, config, COMM_SOLUTION_LIMITER);
+  CompleteComms(geometry, config);
   
 }
 
 
 void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config, unsigned short iMesh) {
   
-  su2double *Turb_i, *Turb_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j;
-  unsigned long iEdge, iPoint, jPoint;
-  unsigned short iDim, iVar;
-  
   bool second_order  = ((config->GetSpatialOrder() == SECOND_ORDER) || (config->GetSpatialOrder() == SECOND_ORDER_LIMITER));
   bool limiter       = (config->GetSpatialOrder() == SECOND_ORDER_LIMITER);
   bool grid_movement = config->GetGrid_Movement();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge and normal vectors ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Primitive variables w/o reconstruction ---*/
-    
-    V_i = solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive();
-    V_j = solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive();
-    numerics->SetPrimitive(V_i, V_j);
-    
-    /*--- Turbulent variables w/o reconstruction ---*/
-    
-    Turb_i = node[iPoint]->GetSolution();
-    Turb_j = node[jPoint]->GetSolution();
-    numerics->SetTurbVar(Turb_i, Turb_j);
-    
-    /*--- Grid Movement ---*/
-    
-    if (grid_movement)
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+  unsigned short nThread = SetEdge_Loop(geometry, config, numerics, solver_container[FLOW_SOL]->GetnPrimVar());
+  unsigned short nColor  = (nThread == 1) ? 1 : geometry->GetnEdge_Color();
+  
+  /*--- Loop over all the edges, threaded over the colors of the edge groups ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel num_threads(nThread)
+#endif
+  {
+    su2double *Turb_i, *Turb_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j;
+    unsigned long iEdge, iPoint, jPoint;
+    unsigned short iDim, iVar;
+    unsigned short iColor, thread = 0;
+    unsigned long iGroup, GroupBegin, GroupEnd, EdgeBegin, EdgeEnd;
+    
+#ifdef HAVE_OMP
+    thread = omp_get_thread_num();
+#endif
+    CNumerics *thread_numerics = numerics->GetThread_Numerics(thread);
+    CEdgeWorkspace *work = Edge_Workspace[thread];
     
-    if (second_order) {
-
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
-      }
-      
-      /*--- Mean flow primitive variables using gradient reconstruction and limiters ---*/
-      
-      Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
-      Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive();
-      if (limiter) {
-        Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive();
-      }
-      
-      for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
-        }
-        if (limiter) {
-          FlowPrimVar_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          FlowPrimVar_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          FlowPrimVar_i[iVar] = V_i[iVar] + Project_Grad_i;
-          FlowPrimVar_j[iVar] = V_j[iVar] + Project_Grad_j;
-        }
-      }
-      
-      numerics->SetPrimitive(FlowPrimVar_i, FlowPrimVar_j);
+    for (iColor = 0; iColor < nColor; iColor++) {
       
-      /*--- Turbulent variables using gradient reconstruction and limiters ---*/
+      GetEdge_Groups(geometry, nThread, iColor, GroupBegin, GroupEnd);
       
-      Gradient_i = node[iPoint]->GetGradient();
-      Gradient_j = node[jPoint]->GetGradient();
-      if (limiter) {
-        Limiter_i = node[iPoint]->GetLimiter();
-        Limiter_j = node[jPoint]->GetLimiter();
-      }
-      
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
-        }
-        if (limiter) {
-          Solution_i[iVar] = Turb_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Solution_j[iVar] = Turb_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          Solution_i[iVar] = Turb_i[iVar] + Project_Grad_i;
-          Solution_j[iVar] = Turb_j[iVar] + Project_Grad_j;
+#ifdef HAVE_OMP
+#pragma omp for schedule(dynamic,1)
+#endif
+      for (iGroup = GroupBegin; iGroup < GroupEnd; iGroup++) {
+        
+        GetEdge_Range(geometry, nThread, iGroup, EdgeBegin, EdgeEnd);
+        
+        for (iEdge = EdgeBegin; iEdge < EdgeEnd; iEdge++) {
+          
+          /*--- Points in edge and normal vectors ---*/
+          
+          iPoint = geometry->GetEdge_Nodes(iEdge)[0];
+          jPoint = geometry->GetEdge_Nodes(iEdge)[1];
+          thread_numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+          
+          /*--- Primitive variables w/o reconstruction ---*/
+          
+          V_i = solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive();
+          V_j = solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive();
+          thread_numerics->SetPrimitive(V_i, V_j);
+          
+          /*--- Turbulent variables w/o reconstruction ---*/
+          
+          Turb_i = node[iPoint]->GetSolution();
+          Turb_j = node[jPoint]->GetSolution();
+          thread_numerics->SetTurbVar(Turb_i, Turb_j);
+          
+          /*--- Grid Movement ---*/
+          
+          if (grid_movement)
+            thread_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+          
+          if (second_order) {
+
+            for (iDim = 0; iDim < nDim; iDim++) {
+              work->Vector_i[iDim] = 0.5*(geometry->GetPoint_Coord(jPoint)[iDim] - geometry->GetPoint_Coord(iPoint)[iDim]);
+              work->Vector_j[iDim] = 0.5*(geometry->GetPoint_Coord(iPoint)[iDim] - geometry->GetPoint_Coord(jPoint)[iDim]);
+            }
+            
+            /*--- Mean flow primitive variables using gradient reconstruction and limiters ---*/
+            
+            Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
+            Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive();
+            if (limiter) {
+              Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive();
+              Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive();
+            }
+            
+            for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
+              Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+              for (iDim = 0; iDim < nDim; iDim++) {
+                Project_Grad_i += work->Vector_i[iDim]*Gradient_i[iVar][iDim];
+                Project_Grad_j += work->Vector_j[iDim]*Gradient_j[iVar][iDim];
+              }
+              if (limiter) {
+                work->Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+                work->Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+              }
+              else {
+                work->Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
+                work->Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
+              }
+            }
+            
+            thread_numerics->SetPrimitive(work->Primitive_i, work->Primitive_j);
+            
+            /*--- Turbulent variables using gradient reconstruction and limiters ---*/
+            
+            Gradient_i = node[iPoint]->GetGradient();
+            Gradient_j = node[jPoint]->GetGradient();
+            if (limiter) {
+              Limiter_i = node[iPoint]->GetLimiter();
+              Limiter_j = node[jPoint]->GetLimiter();
+            }
+            
+            for (iVar = 0; iVar < nVar; iVar++) {
+              Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+              for (iDim = 0; iDim < nDim; iDim++) {
+                Project_Grad_i += work->Vector_i[iDim]*Gradient_i[iVar][iDim];
+                Project_Grad_j += work->Vector_j[iDim]*Gradient_j[iVar][iDim];
+              }
+              if (limiter) {
+                work->Solution_i[iVar] = Turb_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+                work->Solution_j[iVar] = Turb_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+              }
+              else {
+                work->Solution_i[iVar] = Turb_i[iVar] + Project_Grad_i;
+                work->Solution_j[iVar] = Turb_j[iVar] + Project_Grad_j;
+              }
+            }
+            
+            thread_numerics->SetTurbVar(work->Solution_i, work->Solution_j);
+            
+          }
+          
+          /*--- Add and subtract residual ---*/
+          
+          thread_numerics->ComputeResidual(work->Residual, work->Jacobian_i, work->Jacobian_j, config);
+          
+          LinSysRes.AddBlock(iPoint, work->Residual);
+          LinSysRes.SubtractBlock(jPoint, work->Residual);
+          
+          /*--- Implicit part ---*/
+          
+          Jacobian.AddBlock(iPoint, iPoint, work->Jacobian_i);
+          Jacobian.AddBlock(iPoint, jPoint, work->Jacobian_j);
+          Jacobian.SubtractBlock(jPoint, iPoint, work->Jacobian_i);
+          Jacobian.SubtractBlock(jPoint, jPoint, work->Jacobian_j);
+          
         }
       }
-      
-      numerics->SetTurbVar(Solution_i, Solution_j);
-      
     }
-    
-    /*--- Add and subtract residual ---*/
-    
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
-    
-    LinSysRes.AddBlock(iPoint, Residual);
-    LinSysRes.SubtractBlock(jPoint, Residual);
-    
-    /*--- Implicit part ---*/
-    
-    Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
-    
   }
   
 }
 
 void CTurbSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                    CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-  unsigned long iEdge, iPoint, jPoint;
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    /*--- Points coordinates, and normal vector ---*/
-    
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
-                       geometry->node[jPoint]->GetCoord());
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Conservative variables w/o reconstruction ---*/
-    
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive(),
-                           solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive());
-    
-    /*--- Turbulent variables w/o reconstruction, and its gradients ---*/
-    
-    numerics->SetTurbVar(node[iPoint]->GetSolution(), node[jPoint]->GetSolution());
-    numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), node[jPoint]->GetGradient());
-    
-    /*--- Menter's first blending function (only SST)---*/
-    if (config->GetKind_Turb_Model() == SST)
-      numerics->SetF1blending(node[iPoint]->GetF1blending(), node[jPoint]->GetF1blending());
-    
-    /*--- Compute residual, and Jacobians ---*/
-    
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
-    
-    /*--- Add and subtract residual, and update Jacobians ---*/
-    
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
+  unsigned short nThread = SetEdge_Loop(geometry, config, numerics, solver_container[FLOW_SOL]->GetnPrimVar());
+  unsigned short nColor  = (nThread == 1) ? 1 : geometry->GetnEdge_Color();
+  
+  /*--- Loop over all the edges, threaded over the colors of the edge groups ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel num_threads(nThread)
+#endif
+  {
+    unsigned long iEdge, iPoint, jPoint;
+    unsigned short iColor, thread = 0;
+    unsigned long iGroup, GroupBegin, GroupEnd, EdgeBegin, EdgeEnd;
     
-    Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+#ifdef HAVE_OMP
+    thread = omp_get_thread_num();
+#endif
+    CNumerics *thread_numerics = numerics->GetThread_Numerics(thread);
+    CEdgeWorkspace *work = Edge_Workspace[thread];
     
+    for (iColor = 0; iColor < nColor; iColor++) {
+      
+      GetEdge_Groups(geometry, nThread, iColor, GroupBegin, GroupEnd);
+      
+#ifdef HAVE_OMP
+#pragma omp for schedule(dynamic,1)
+#endif
+      for (iGroup = GroupBegin; iGroup < GroupEnd; iGroup++) {
+        
+        GetEdge_Range(geometry, nThread, iGroup, EdgeBegin, EdgeEnd);
+        
+        for (iEdge = EdgeBegin; iEdge < EdgeEnd; iEdge++) {
+          
+          /*--- Points in edge ---*/
+          
+          iPoint = geometry->GetEdge_Nodes(iEdge)[0];
+          jPoint = geometry->GetEdge_Nodes(iEdge)[1];
+          
+          /*--- Points coordinates, and normal vector ---*/
+          
+          thread_numerics->SetCoord(geometry->GetPoint_Coord(iPoint),
+                             geometry->GetPoint_Coord(jPoint));
+          thread_numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+          
+          /*--- Conservative variables w/o reconstruction ---*/
+          
+          thread_numerics->SetPrimitive(solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive(),
+                                 solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive());
+          
+          /*--- Turbulent variables w/o reconstruction, and its gradients ---*/
+          
+          thread_numerics->SetTurbVar(node[iPoint]->GetSolution(), node[jPoint]->GetSolution());
+          thread_numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), node[jPoint]->GetGradient());
+          
+          /*--- Menter's first blending function (only SST)---*/
+          if (config->GetKind_Turb_Model() == SST)
+            thread_numerics->SetF1blending(node[iPoint]->GetF1blending(), node[jPoint]->GetF1blending());
+          
+          /*--- Compute residual, and Jacobians ---*/
+          
+          thread_numerics->ComputeResidual(work->Residual, work->Jacobian_i, work->Jacobian_j, config);
+          
+          /*--- Add and subtract residual, and update Jacobians ---*/
+          
+          LinSysRes.SubtractBlock(iPoint, work->Residual);
+          LinSysRes.AddBlock(jPoint, work->Residual);
+          
+          Jacobian.SubtractBlock(iPoint, iPoint, work->Jacobian_i);
+          Jacobian.SubtractBlock(iPoint, jPoint, work->Jacobian_j);
+          Jacobian.AddBlock(jPoint, iPoint, work->Jacobian_i);
+          Jacobian.AddBlock(jPoint, jPoint, work->Jacobian_j);
+          
+        }
+      }
+    }
   }
   
 }
@@ -983,93 +714,30 @@ void CTurbSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
 
   /*--- Restart the solution from file information ---*/
   unsigned short iVar, iMesh;
-  unsigned long iPoint, index, iChildren, Point_Fine;
-  su2double dull_val, Area_Children, Area_Parent, *Solution_Fine;
-  bool compressible   = (config->GetKind_Regime() == COMPRESSIBLE);
+  unsigned long iPoint, iChildren, Point_Fine;
+  su2double Area_Children, Area_Parent, *Solution_Fine;
   bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
-  bool freesurface    = (config->GetKind_Regime() == FREESURFACE);
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   bool time_stepping = (config->GetUnsteady_Simulation() == TIME_STEPPING);
-  string UnstExt, text_line;
-  ifstream restart_file;
   string restart_filename = config->GetSolution_FlowFileName();
-  int rank = MASTER_NODE;
-#ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#endif
 
   /*--- Modify file name for an unsteady restart ---*/
   if (dual_time|| time_stepping)
     restart_filename = config->GetUnsteady_FileName(restart_filename, val_iter);
 
-  /*--- Open the restart file, throw an error if this fails. ---*/
-  restart_file.open(restart_filename.data(), ios::in);
-  if (restart_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no flow restart file!! " << restart_filename.data() << "."<< endl;
-    exit(EXIT_FAILURE);
-  }
-
-  /*--- In case this is a parallel simulation, we need to perform the
-   Global2Local index transformation first. ---*/
-  long *Global2Local = NULL;
-  Global2Local = new long[geometry[MESH_0]->GetGlobal_nPointDomain()];
-  /*--- First, set all indices to a negative value by default ---*/
-  for (iPoint = 0; iPoint < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint++) {
-    Global2Local[iPoint] = -1;
-  }
-
-  /*--- Now fill array with the transform values only for local points ---*/
-  for (iPoint = 0; iPoint < geometry[MESH_0]->GetnPointDomain(); iPoint++) {
-    Global2Local[geometry[MESH_0]->node[iPoint]->GetGlobalIndex()] = iPoint;
-  }
-
-  /*--- Read all lines in the restart file ---*/
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
-
-  /*--- Skip flow variables ---*/
-  unsigned short skipVars = 0;
-
-  if (compressible) {
-    if (nDim == 2) skipVars += 6;
-    if (nDim == 3) skipVars += 8;
-  }
-  if (incompressible) {
-    if (nDim == 2) skipVars += 5;
-    if (nDim == 3) skipVars += 7;
-  }
-  if (freesurface) {
-    if (nDim == 2) skipVars += 6;
-    if (nDim == 3) skipVars += 8;
-  }
-
-  /*--- The first line is the header ---*/
-  getline (restart_file, text_line);
-
-  while (getline (restart_file, text_line)) {
-    istringstream point_line(text_line);
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on a different processor, the value of iPoint_Local will be -1, as
-     initialized above. Otherwise, the local index for this node on the
-     current processor will be returned and used to instantiate the vars. ---*/
-    iPoint_Local = Global2Local[iPoint_Global];
-    if (iPoint_Local >= 0) {
-      point_line >> index;
-      for (iVar = 0; iVar < skipVars; iVar++){ point_line >> dull_val;}
-      for (iVar = 0; iVar < nVar; iVar++){ point_line >> Solution[iVar];}
-      node[iPoint_Local]->SetSolution(Solution);
-
-    }
-    iPoint_Global++;
+  /*--- Read the restart file, the turbulence variables follow the node
+   coordinates and the flow variables. ---*/
+  Read_Restart_File(geometry[MESH_0], config, restart_filename);
+  
+  unsigned short nFields = Restart_Fields.size(), skipVars = (incompressible ? 2*nDim+1 : 2*nDim+2);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[iPoint*nFields+skipVars+iVar];
+    node[iPoint]->SetSolution(Solution);
   }
-
-  /*--- Close the restart file ---*/
-  restart_file.close();
-
-  /*--- Free memory needed for the transformation ---*/
-  delete [] Global2Local;
+  
+  Clear_Restart_Data();
 
   /*--- MPI solution and compute the eddy viscosity ---*/
   solver[MESH_0][TURB_SOL]->Set_MPI_Solution(geometry[MESH_0], config);
@@ -1100,8 +768,8 @@ CTurbSASolver::CTurbSASolver(void) : CTurbSolver() { }
 
 CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned short iMesh, CFluidModel* FluidModel) : CTurbSolver() {
   unsigned short iVar, iDim, nLineLets;
-  unsigned long iPoint, index;
-  su2double Density_Inf, Viscosity_Inf, Factor_nu_Inf, Factor_nu_Engine, dull_val;
+  unsigned long iPoint;
+  su2double Density_Inf, Viscosity_Inf, Factor_nu_Inf, Factor_nu_Engine;
   
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry->GetnZone();
@@ -1109,7 +777,6 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
   bool adjoint = (config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint());
   bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
   bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
-  bool freesurface = (config->GetKind_Regime() == FREESURFACE);
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   bool time_stepping = config->GetUnsteady_Simulation() == TIME_STEPPING;
@@ -1258,7 +925,6 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
   else {
     
     /*--- Restart the solution from file information ---*/
-    ifstream restart_file;
     string filename = config->GetSolution_FlowFileName();
     su2double Density, StaticEnergy, Laminar_Viscosity, nu, nu_hat, muT = 0.0, U[5];
     int Unst_RestartIter;
@@ -1289,92 +955,39 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
       filename = config->GetUnsteady_FileName(filename, Unst_RestartIter);
     }
     
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      cout << "There is no turbulent restart file!!" << endl;
-      exit(EXIT_FAILURE);
-    }
-    
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
-    long *Global2Local;
-    Global2Local = new long[geometry->GetGlobal_nPointDomain()];
-    /*--- First, set all indices to a negative value by default ---*/
-    for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++) {
-      Global2Local[iPoint] = -1;
-    }
-    /*--- Now fill array with the transform values only for local points ---*/
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-    }
-    
-    /*--- Read all lines in the restart file ---*/
-    long iPoint_Local; unsigned long iPoint_Global = 0; string text_line;
+    /*--- Read the restart file. The values of a point are the node coordinates,
+     the flow variables and the turbulence variable. ---*/
+    Read_Restart_File(geometry, config, filename);
     
-    /*--- The first line is the header ---*/
-    getline (restart_file, text_line);
+    unsigned short nFields = Restart_Fields.size(), nVar_Flow = (incompressible ? nDim+1 : nDim+2);
     
-    while (getline (restart_file, text_line)) {
-      istringstream point_line(text_line);
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
       
-      /*--- Retrieve local index. If this node from the restart file lives
-       on a different processor, the value of iPoint_Local will be -1.
-       Otherwise, the local index for this node on the current processor
-       will be returned and used to instantiate the vars. ---*/
-      iPoint_Local = Global2Local[iPoint_Global];
-      if (iPoint_Local >= 0) {
-        if (compressible) {
-          if (nDim == 2) point_line >> index >> dull_val >> dull_val >> U[0] >> U[1] >> U[2] >> U[3] >> Solution[0];
-          if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> U[0] >> U[1] >> U[2] >> U[3] >> U[4] >> Solution[0];
-          
-          Density = U[0];
-          if (nDim == 2)
-        	  StaticEnergy = U[3]/U[0] - (U[1]*U[1] + U[2]*U[2])/(2.0*U[0]*U[0]);
-//            Pressure = Gamma_Minus_One*(U[3] - (U[1]*U[1] + U[2]*U[2])/(2.0*U[0]));
-          else
-        	  StaticEnergy = U[4]/U[0] - (U[1]*U[1] + U[2]*U[2] + U[3]*U[3] )/(2.0*U[0]*U[0]);
-//        	  Pressure = Gamma_Minus_One*(U[4] - (U[1]*U[1] + U[2]*U[2] + U[3]*U[3])/(2.0*U[0]));
-
-//          Temperature = Pressure/(Gas_Constant*Density);
-//
-//
-//          Temperature_Dim = Temperature*Temperature_Ref;
-//
-//          if (config->GetSystemMeasurements() == SI) { T_ref = 273.15; S = 110.4; Mu_ref = 1.716E-5; }
-//          if (config->GetSystemMeasurements() == US) { T_ref = 518.7; S = 198.72; Mu_ref = 3.62E-7; }
-//
-//          /*--- Calculate viscosity from a non-dim. Sutherland's Law ---*/
-//
-//          Laminar_Viscosity = Mu_ref*(pow(Temperature_Dim/T_ref, 1.5) * (T_ref+S)/(Temperature_Dim+S));
-//          Laminar_Viscosity = Laminar_Viscosity/Viscosity_Ref;
-
-          FluidModel->SetTDState_rhoe(Density, StaticEnergy);
-          Laminar_Viscosity = FluidModel->GetLaminarViscosity();
-          nu     = Laminar_Viscosity/Density;
-          nu_hat = Solution[0];
-          Ji     = nu_hat/nu;
-          Ji_3   = Ji*Ji*Ji;
-          fv1    = Ji_3/(Ji_3+cv1_3);
-          muT    = Density*fv1*nu_hat;
-          
-        }
-        if (incompressible) {
-          if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-          if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-          muT = muT_Inf;
-        }
+      passivedouble *Values = &Restart_Data[iPoint*nFields];
+      Solution[0] = Values[nDim+nVar_Flow];
+      
+      if (compressible) {
+        for (iVar = 0; iVar < nVar_Flow; iVar++) U[iVar] = Values[nDim+iVar];
         
-        if (freesurface) {
-          if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-          if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-          muT = muT_Inf;
-        }
+        Density = U[0];
+        if (nDim == 2)
+          StaticEnergy = U[3]/U[0] - (U[1]*U[1] + U[2]*U[2])/(2.0*U[0]*U[0]);
+        else
+          StaticEnergy = U[4]/U[0] - (U[1]*U[1] + U[2]*U[2] + U[3]*U[3] )/(2.0*U[0]*U[0]);
         
-        /*--- Instantiate the solution at this node, note that the eddy viscosity should be recomputed ---*/
-        node[iPoint_Local] = new CTurbSAVariable(Solution[0], muT, nDim, nVar, config);
+        FluidModel->SetTDState_rhoe(Density, StaticEnergy);
+        Laminar_Viscosity = FluidModel->GetLaminarViscosity();
+        nu     = Laminar_Viscosity/Density;
+        nu_hat = Solution[0];
+        Ji     = nu_hat/nu;
+        Ji_3   = Ji*Ji*Ji;
+        fv1    = Ji_3/(Ji_3+cv1_3);
+        muT    = Density*fv1*nu_hat;
       }
-      iPoint_Global++;
+      else muT = muT_Inf;
+      
+      /*--- Instantiate the solution at this node, note that the eddy viscosity should be recomputed ---*/
+      node[iPoint] = new CTurbSAVariable(Solution[0], muT, nDim, nVar, config);
     }
     
     /*--- Instantiate the variable class with an arbitrary solution
@@ -1384,13 +997,13 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
       node[iPoint] = new CTurbSAVariable(Solution[0], muT_Inf, nDim, nVar, config);
     }
     
-    /*--- Close the restart file ---*/
-    restart_file.close();
-    
-    /*--- Free memory needed for the transformation ---*/
-    delete [] Global2Local;
+    Clear_Restart_Data();
   }
   
+  /*--- Store the variables of all the points contiguously ---*/
+  
+  SetContiguous_Storage();
+  
   /*--- MPI solution ---*/
   Set_MPI_Solution(geometry, config);
   
@@ -1402,6 +1015,8 @@ CTurbSASolver::~CTurbSASolver(void) {
 
 void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
   
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_PREPROCESSING);
+  
   unsigned long iPoint;
 
   unsigned long ExtIter      = config->GetExtIter();
@@ -1426,8 +1041,13 @@ void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
 
   if (config->GetSpatialOrder() == SECOND_ORDER_LIMITER) SetSolution_Limiter(geometry, config);
 
-  if (limiter_flow) solver_container[FLOW_SOL]->SetPrimitive_Limiter(geometry, config);
+  if (limiter_flow) {
+    solver_container[FLOW_SOL]->SetPrimitive_Limiter(geometry, config);
+    solver_container[FLOW_SOL]->CompleteComms(geometry, config);
+  }
 
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CTurbSASolver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh) {
@@ -2478,18 +2098,13 @@ CTurbSSTSolver::CTurbSSTSolver(void) : CTurbSolver() {
 
 CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CTurbSolver() {
   unsigned short iVar, iDim, nLineLets;
-  unsigned long iPoint, index;
-  su2double dull_val;
-  ifstream restart_file;
-  string text_line;
+  unsigned long iPoint;
   
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry->GetnZone();
   bool restart = (config->GetRestart() || config->GetRestart_Flow());
   bool adjoint = (config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint());
-  bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
   bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
-  bool freesurface = (config->GetKind_Regime() == FREESURFACE);
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
 	bool time_stepping = (config->GetUnsteady_Simulation() == TIME_STEPPING);
@@ -2644,7 +2259,6 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
   else {
     
     /*--- Restart the solution from file information ---*/
-    ifstream restart_file;
     string filename = config->GetSolution_FlowFileName();
     
     /*--- Modify file name for multizone problems ---*/
@@ -2664,60 +2278,18 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     }
 
     
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      cout << "There is no turbulent restart file!!" << endl;
-      exit(EXIT_FAILURE);
-    }
-    
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
-    long *Global2Local;
-    Global2Local = new long[geometry->GetGlobal_nPointDomain()];
-    /*--- First, set all indices to a negative value by default ---*/
-    for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++) {
-      Global2Local[iPoint] = -1;
-    }
-    /*--- Now fill array with the transform values only for local points ---*/
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-    }
-    
-    /*--- Read all lines in the restart file ---*/
-    long iPoint_Local; unsigned long iPoint_Global = 0; string text_line;
-    
-    /*--- The first line is the header ---*/
-    getline (restart_file, text_line);
+    /*--- Read the restart file. The values of a point are the node coordinates,
+     the flow variables and the turbulence variables. ---*/
+    Read_Restart_File(geometry, config, filename);
     
+    unsigned short nFields = Restart_Fields.size(), nVar_Flow = (incompressible ? nDim+1 : nDim+2);
     
-    while (getline (restart_file, text_line)) {
-      istringstream point_line(text_line);
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      Solution[0] = Restart_Data[iPoint*nFields+nDim+nVar_Flow];
+      Solution[1] = Restart_Data[iPoint*nFields+nDim+nVar_Flow+1];
       
-      /*--- Retrieve local index. If this node from the restart file lives
-       on a different processor, the value of iPoint_Local will be -1.
-       Otherwise, the local index for this node on the current processor
-       will be returned and used to instantiate the vars. ---*/
-      iPoint_Local = Global2Local[iPoint_Global];
-      if (iPoint_Local >= 0) {
-        
-        if (compressible) {
-          if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1];
-          if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1];
-        }
-        if (incompressible) {
-          if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1];
-          if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1];
-        }
-        if (freesurface) {
-          if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1];
-          if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1];
-        }
-        
-        /*--- Instantiate the solution at this node, note that the muT_Inf should recomputed ---*/
-        node[iPoint_Local] = new CTurbSSTVariable(Solution[0], Solution[1], muT_Inf, nDim, nVar, constants, config);
-      }
-      iPoint_Global++;
+      /*--- Instantiate the solution at this node, note that the muT_Inf should recomputed ---*/
+      node[iPoint] = new CTurbSSTVariable(Solution[0], Solution[1], muT_Inf, nDim, nVar, constants, config);
     }
     
     /*--- Instantiate the variable class with an arbitrary solution
@@ -2727,13 +2299,13 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
       node[iPoint] = new CTurbSSTVariable(Solution[0], Solution[1], muT_Inf, nDim, nVar, constants, config);
     }
     
-    /*--- Close the restart file ---*/
-    restart_file.close();
-    
-    /*--- Free memory needed for the transformation ---*/
-    delete [] Global2Local;
+    Clear_Restart_Data();
   }
   
+  /*--- Store the variables of all the points contiguously ---*/
+  
+  SetContiguous_Storage();
+  
   /*--- MPI solution ---*/
   Set_MPI_Solution(geometry, config);
   
@@ -2747,6 +2319,8 @@ CTurbSSTSolver::~CTurbSSTSolver(void) {
 
 void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
   
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_PREPROCESSING);
+  
   unsigned long iPoint;
 
   unsigned long ExtIter      = config->GetExtIter();
@@ -2771,8 +2345,13 @@ void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contain
 
   if (config->GetSpatialOrder() == SECOND_ORDER_LIMITER) SetSolution_Limiter(geometry, config);
   
-  if (limiter_flow) solver_container[FLOW_SOL]->SetPrimitive_Limiter(geometry, config);
+  if (limiter_flow) {
+    solver_container[FLOW_SOL]->SetPrimitive_Limiter(geometry, config);
+    solver_container[FLOW_SOL]->CompleteComms(geometry, config);
+  }
 
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CTurbSSTSolver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh) {
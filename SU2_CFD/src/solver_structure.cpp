@@ -31,6 +31,43 @@
 
 #include "../include/solver_structure.hpp"
 
+CEdgeWorkspace::CEdgeWorkspace(unsigned short val_nDim, unsigned short val_nVar, unsigned short val_nPrimVar, unsigned short val_nSecondaryVar) {
+  
+  unsigned short iVar;
+  
+  nVar = val_nVar;
+  
+  Residual    = new su2double[nVar];
+  Solution_i  = new su2double[nVar];              Solution_j  = new su2double[nVar];
+  Primitive_i = new su2double[val_nPrimVar];      Primitive_j = new su2double[val_nPrimVar];
+  Secondary_i = new su2double[val_nSecondaryVar]; Secondary_j = new su2double[val_nSecondaryVar];
+  Vector_i    = new su2double[val_nDim];          Vector_j    = new su2double[val_nDim];
+  
+  Jacobian_i = new su2double*[nVar];
+  Jacobian_j = new su2double*[nVar];
+  for (iVar = 0; iVar < nVar; iVar++) {
+    Jacobian_i[iVar] = new su2double[nVar];
+    Jacobian_j[iVar] = new su2double[nVar];
+  }
+  
+}
+
+CEdgeWorkspace::~CEdgeWorkspace(void) {
+  
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    delete [] Jacobian_i[iVar];
+    delete [] Jacobian_j[iVar];
+  }
+  delete [] Jacobian_i; delete [] Jacobian_j;
+  
+  delete [] Residual;
+  delete [] Solution_i;  delete [] Solution_j;
+  delete [] Primitive_i; delete [] Primitive_j;
+  delete [] Secondary_i; delete [] Secondary_j;
+  delete [] Vector_i;    delete [] Vector_j;
+  
+}
+
 CSolver::CSolver(void) {
   
   /*--- Array initialization ---*/
@@ -69,6 +106,14 @@ CSolver::CSolver(void) {
   cvector = NULL;
   node = NULL;
   nOutputVariables = 0;
+  nSecondaryVar = 0;
+  nSecondaryVarGrad = 0;
+  Halo = NULL;
+  Variable_Storage = NULL;
+  Edge_Workspace = NULL;
+  nThread_Edge = 0;
+  Comm_Type = 0;
+  Comm_Velocity = false;
   
 }
 
@@ -89,8 +134,18 @@ CSolver::~CSolver(void) {
     delete [] node;
   }
 
+  if (Variable_Storage != NULL) delete Variable_Storage;
+  
+  if (Edge_Workspace != NULL) {
+    for (unsigned short iThread = 0; iThread < nThread_Edge; iThread++)
+      delete Edge_Workspace[iThread];
+    delete [] Edge_Workspace;
+  }
+
   /* Private */
 
+  if (Halo != NULL) delete Halo;
+
   if (Residual_RMS != NULL) delete [] Residual_RMS;
   if (Residual_Max != NULL) delete [] Residual_Max;
   if (Residual != NULL) delete [] Residual;
@@ -180,6 +235,705 @@ CSolver::~CSolver(void) {
 
 }
 
+unsigned short CSolver::GetnVar_Comms(unsigned short commType) {
+  
+  switch (commType) {
+    case COMM_SOLUTION: case COMM_SOLUTION_OLD: case COMM_SOLUTION_LIMITER: return nVar;
+    case COMM_SOLUTION_EDDY:      return nVar+1;
+    case COMM_SOLUTION_GRADIENT:  return nVar*nDim;
+    case COMM_PRIMITIVE_GRADIENT: return nPrimVarGrad*nDim;
+    case COMM_PRIMITIVE_LIMITER:  return nPrimVarGrad;
+    case COMM_UNDIVIDED_LAPLACIAN: return nVar;
+    case COMM_MAX_EIGENVALUE:     return 2;
+    case COMM_SENSOR:             return 1;
+    default: return 0;
+  }
+  
+}
+
+void CSolver::InitiateComms(CGeometry *geometry, CConfig *config, unsigned short commType, bool val_velocity) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
+  
+  unsigned short iVar, iDim, nVar_Comm = GetnVar_Comms(commType);
+  unsigned long iSend, iPoint;
+  su2double *Buffer_Send, *Buffer;
+  
+  /*--- The send/receive lists are built once, then only the values travel ---*/
+  
+  if (Halo == NULL) Halo = new CHaloExchange(geometry, config);
+  if (Halo->GetComms_Pending()) CompleteComms(geometry, config);
+  
+  Comm_Type = commType;
+  Comm_Velocity = val_velocity;
+  
+  /*--- Pack the values of the send points ---*/
+  
+  Buffer_Send = Halo->GetBuffer_Send(nVar_Comm);
+  
+  for (iSend = 0; iSend < Halo->GetnSend(); iSend++) {
+    iPoint = Halo->GetSend_Point(iSend);
+    Buffer = &Buffer_Send[iSend*nVar_Comm];
+    switch (commType) {
+      case COMM_SOLUTION:
+        for (iVar = 0; iVar < nVar; iVar++) Buffer[iVar] = node[iPoint]->GetSolution(iVar);
+        break;
+      case COMM_SOLUTION_EDDY:
+        for (iVar = 0; iVar < nVar; iVar++) Buffer[iVar] = node[iPoint]->GetSolution(iVar);
+        Buffer[nVar] = node[iPoint]->GetmuT();
+        break;
+      case COMM_SOLUTION_OLD:
+        for (iVar = 0; iVar < nVar; iVar++) Buffer[iVar] = node[iPoint]->GetSolution_Old(iVar);
+        break;
+      case COMM_SOLUTION_GRADIENT:
+        for (iVar = 0; iVar < nVar; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Buffer[iVar*nDim+iDim] = node[iPoint]->GetGradient(iVar, iDim);
+        break;
+      case COMM_SOLUTION_LIMITER:
+        for (iVar = 0; iVar < nVar; iVar++) Buffer[iVar] = node[iPoint]->GetLimiter(iVar);
+        break;
+      case COMM_PRIMITIVE_GRADIENT:
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Buffer[iVar*nDim+iDim] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
+        break;
+      case COMM_PRIMITIVE_LIMITER:
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) Buffer[iVar] = node[iPoint]->GetLimiter_Primitive(iVar);
+        break;
+      case COMM_UNDIVIDED_LAPLACIAN:
+        for (iVar = 0; iVar < nVar; iVar++) Buffer[iVar] = node[iPoint]->GetUndivided_Laplacian(iVar);
+        break;
+      case COMM_MAX_EIGENVALUE:
+        Buffer[0] = node[iPoint]->GetLambda();
+        Buffer[1] = geometry->node[iPoint]->GetnPoint();
+        break;
+      case COMM_SENSOR:
+        Buffer[0] = node[iPoint]->GetSensor();
+        break;
+    }
+  }
+  
+  Halo->StartComms(commType);
+  
+  config->Stop_Phase(Previous_Phase);
+  
+}
+
+void CSolver::CompleteComms(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short iVar, iDim, nVar_Comm = GetnVar_Comms(Comm_Type);
+  unsigned long iReceive, iPoint;
+  su2double *Buffer_Receive, *Buffer;
+  
+  if ((Halo == NULL) || !Halo->GetComms_Pending()) return;
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
+  
+  Halo->FinishComms();
+  
+  /*--- Rotate the vectors received across periodic boundaries and unpack into the halo points ---*/
+  
+  Buffer_Receive = Halo->GetBuffer_Receive();
+  
+  for (iReceive = 0; iReceive < Halo->GetnReceive(); iReceive++) {
+    iPoint = Halo->GetReceive_Point(iReceive);
+    Buffer = &Buffer_Receive[iReceive*nVar_Comm];
+    
+    if (Comm_Velocity) Halo->Rotate(iReceive, &Buffer[1]);
+    
+    switch (Comm_Type) {
+      case COMM_SOLUTION:
+        for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution(iVar, Buffer[iVar]);
+        break;
+      case COMM_SOLUTION_EDDY:
+        for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution(iVar, Buffer[iVar]);
+        node[iPoint]->SetmuT(Buffer[nVar]);
+        break;
+      case COMM_SOLUTION_OLD:
+        for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution_Old(iVar, Buffer[iVar]);
+        break;
+      case COMM_SOLUTION_GRADIENT:
+        for (iVar = 0; iVar < nVar; iVar++) {
+          Halo->Rotate(iReceive, &Buffer[iVar*nDim]);
+          for (iDim = 0; iDim < nDim; iDim++)
+            node[iPoint]->SetGradient(iVar, iDim, Buffer[iVar*nDim+iDim]);
+        }
+        break;
+      case COMM_SOLUTION_LIMITER:
+        for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetLimiter(iVar, Buffer[iVar]);
+        break;
+      case COMM_PRIMITIVE_GRADIENT:
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          Halo->Rotate(iReceive, &Buffer[iVar*nDim]);
+          for (iDim = 0; iDim < nDim; iDim++)
+            node[iPoint]->SetGradient_Primitive(iVar, iDim, Buffer[iVar*nDim+iDim]);
+        }
+        break;
+      case COMM_PRIMITIVE_LIMITER:
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) node[iPoint]->SetLimiter_Primitive(iVar, Buffer[iVar]);
+        break;
+      case COMM_UNDIVIDED_LAPLACIAN:
+        for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetUndivided_Laplacian(iVar, Buffer[iVar]);
+        break;
+      case COMM_MAX_EIGENVALUE:
+        node[iPoint]->SetLambda(Buffer[0]);
+        geometry->node[iPoint]->SetnNeighbor(SU2_TYPE::Int(Buffer[1]));
+        break;
+      case COMM_SENSOR:
+        node[iPoint]->SetSensor(Buffer[0]);
+        break;
+    }
+  }
+  
+  config->Stop_Phase(Previous_Phase);
+  
+}
+
+unsigned long CSolver::GetEdge_Overlap(CGeometry *geometry, CConfig *config, unsigned long val_edge, bool val_overlap) {
+  
+  if (!val_overlap) return val_edge;
+  
+  unsigned long nEdge_Interior = Halo->GetnEdge_Interior();
+  
+  /*--- The next edges need the values of the halo points, the last edge
+   completes the exchange when there are no edges with halo points ---*/
+  
+  if ((val_edge == nEdge_Interior) || (val_edge+1 == geometry->GetnEdge()))
+    CompleteComms(geometry, config);
+  
+  if (val_edge < nEdge_Interior) return Halo->GetEdge_Interior(val_edge);
+  
+  return Halo->GetEdge_Halo(val_edge-nEdge_Interior);
+  
+}
+
+unsigned short CSolver::SetEdge_Loop(CGeometry *geometry, CConfig *config, CNumerics *numerics, unsigned short val_nPrimVar, bool val_threaded) {
+  
+  unsigned short iThread;
+  
+  /*--- Auxiliary vectors of the threads, allocated on the first loop ---*/
+  
+  if (Edge_Workspace == NULL) {
+    nThread_Edge = 1;
+#ifdef HAVE_OMP
+    nThread_Edge = omp_get_max_threads();
+#endif
+    Edge_Workspace = new CEdgeWorkspace*[nThread_Edge];
+    for (iThread = 0; iThread < nThread_Edge; iThread++)
+      Edge_Workspace[iThread] = new CEdgeWorkspace(nDim, nVar, val_nPrimVar, nSecondaryVar);
+  }
+  
+  if (!val_threaded || (nThread_Edge == 1) || (geometry->GetnEdge_Color() == 0) || (numerics == NULL) ||
+      (numerics->GetnThread_Numerics() != nThread_Edge)) return 1;
+  
+  /*--- The threaded loop goes over the colors and not over the edges without
+   halo points first, the exchange in progress can not be overlapped ---*/
+  
+  if (GetComms_Pending()) CompleteComms(geometry, config);
+  
+  return nThread_Edge;
+  
+}
+
+void CSolver::GetEdge_Groups(CGeometry *geometry, unsigned short val_nThread, unsigned short val_color, unsigned long &val_begin, unsigned long &val_end) {
+  
+  if (val_nThread == 1) { val_begin = 0; val_end = 1; return; }
+  
+  val_begin = geometry->GetEdge_Color_Ptr(val_color);
+  val_end   = geometry->GetEdge_Color_Ptr(val_color+1);
+  
+}
+
+void CSolver::GetEdge_Range(CGeometry *geometry, unsigned short val_nThread, unsigned long val_group, unsigned long &val_begin, unsigned long &val_end) {
+  
+  if (val_nThread == 1) { val_begin = 0; val_end = geometry->GetnEdge(); return; }
+  
+  val_begin = geometry->GetEdge_Color_Group(val_group)*geometry->GetEdge_Color_GroupSize();
+  val_end   = min(val_begin+geometry->GetEdge_Color_GroupSize(), geometry->GetnEdge());
+  
+}
+
+void CSolver::SetEdge_Block_Residual(CNumerics *numerics, CEdgeWorkspace *val_work, CConfig *config, bool val_implicit) {
+  
+  unsigned short iVar, jVar, k;
+  unsigned long iPoint, jPoint;
+  CEdgeBlock *block = numerics->GetEdge_Block();
+  
+  if (block->nEdge == 0) return;
+  
+  numerics->ComputeResidual_Block(config);
+  
+  /*--- Scatter the residual and the Jacobians of each edge, the
+   points of the block belong to the group of edges of the thread ---*/
+  
+  for (k = 0; k < block->nEdge; k++) {
+    
+    iPoint = block->Point_i[k]; jPoint = block->Point_j[k];
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      val_work->Residual[iVar] = block->Residual[iVar][k];
+    
+    LinSysRes.AddBlock(iPoint, val_work->Residual);
+    LinSysRes.SubtractBlock(jPoint, val_work->Residual);
+    
+    if (val_implicit) {
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++) {
+          val_work->Jacobian_i[iVar][jVar] = block->Jacobian_i[iVar][jVar][k];
+          val_work->Jacobian_j[iVar][jVar] = block->Jacobian_j[iVar][jVar][k];
+        }
+      Jacobian.AddBlock(iPoint, iPoint, val_work->Jacobian_i);
+      Jacobian.AddBlock(iPoint, jPoint, val_work->Jacobian_j);
+      Jacobian.SubtractBlock(jPoint, iPoint, val_work->Jacobian_i);
+      Jacobian.SubtractBlock(jPoint, jPoint, val_work->Jacobian_j);
+    }
+    
+  }
+  
+  block->nEdge = 0;
+  
+}
+
+void CSolver::Read_Restart_File(CGeometry *geometry, CConfig *config, string val_filename) {
+  
+  unsigned long nPoint_Read;
+  unsigned short sbuf_NotMatching = 0, rbuf_NotMatching = 0;
+  char file_tag[9] = "";
+  ifstream restart_file;
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Open the restart file, and throw an error if this fails. ---*/
+  
+  restart_file.open(val_filename.data(), ios::in | ios::binary);
+  if (restart_file.fail()) {
+    if (rank == MASTER_NODE)
+      cout << "There is no restart file!! " << val_filename.data() << "."<< endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  /*--- The binary and compressed restart files start with a tag, otherwise the file is ASCII ---*/
+  
+  restart_file.read(file_tag, 8);
+  restart_file.close();
+  
+  if (strcmp(file_tag, "SU2RST01") == 0)
+    nPoint_Read = Read_Restart_Binary(geometry, config, val_filename);
+  else if (strcmp(file_tag, "SU2RST02") == 0)
+    nPoint_Read = Read_Restart_Compressed(geometry, config, val_filename);
+  else
+    nPoint_Read = Read_Restart_ASCII(geometry, config, val_filename);
+  
+  /*--- Detect a wrong solution file ---*/
+  
+  if (nPoint_Read < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
+  
+#ifndef HAVE_MPI
+  rbuf_NotMatching = sbuf_NotMatching;
+#else
+  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  
+  if (rbuf_NotMatching != 0) {
+    if (rank == MASTER_NODE) {
+      cout << endl << "The solution file " << val_filename.data() << " doesn't match with the mesh file!" << endl;
+      cout << "It could be empty lines at the end of the file." << endl << endl;
+    }
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+}
+
+void CSolver::Clear_Restart_Data(void) {
+  
+  vector<string>().swap(Restart_Fields);
+  vector<passivedouble>().swap(Restart_Data);
+  
+}
+
+void CSolver::Sort_GlobalIndex(CGeometry *geometry, vector<pair<unsigned long, unsigned long> > &val_sorted) {
+  
+  unsigned long iPoint, nPointDomain = geometry->GetnPointDomain();
+  
+  val_sorted.resize(nPointDomain);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    val_sorted[iPoint] = make_pair(geometry->node[iPoint]->GetGlobalIndex(), iPoint);
+  sort(val_sorted.begin(), val_sorted.end());
+  
+}
+
+unsigned long CSolver::Read_Restart_ASCII(CGeometry *geometry, CConfig *config, string val_filename) {
+  
+  unsigned long iPoint_Global = 0, iSorted = 0, index, iField, nFields;
+  string text_line, Tag;
+  ifstream restart_file;
+  vector<pair<unsigned long, unsigned long> > Sorted_Points;
+  
+  restart_file.open(val_filename.data(), ios::in);
+  
+  /*--- Identify the number of fields (and names) in the header, the PointID is not stored ---*/
+  
+  Restart_Fields.clear();
+  getline (restart_file, text_line);
+  stringstream ss(text_line);
+  while (ss >> Tag) {
+    Restart_Fields.push_back(Tag);
+    if (ss.peek() == ',') ss.ignore();
+  }
+  if (!Restart_Fields.empty()) Restart_Fields.erase(Restart_Fields.begin());
+  nFields = Restart_Fields.size();
+  
+  Restart_Data.assign(geometry->GetnPointDomain()*nFields, 0.0);
+  
+  /*--- The local points sorted by global index are matched with the lines of
+   the file as they are read, instead of using a table of the global size. ---*/
+  
+  Sort_GlobalIndex(geometry, Sorted_Points);
+  
+  while ((iSorted < Sorted_Points.size()) && getline (restart_file, text_line)) {
+    
+    if (Sorted_Points[iSorted].first == iPoint_Global) {
+      istringstream point_line(text_line);
+      passivedouble *Values = &Restart_Data[Sorted_Points[iSorted].second*nFields];
+      point_line >> index;
+      for (iField = 0; iField < nFields; iField++) point_line >> Values[iField];
+      iSorted++;
+    }
+    iPoint_Global++;
+    
+  }
+  
+  restart_file.close();
+  
+  return iSorted;
+  
+}
+
+unsigned long CSolver::Read_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename) {
+  
+  /*--- Layout of the file: the tag, the number of fields and of points, the names of
+   the fields (MAX_STRING_SIZE characters each), and the values ordered by global index. ---*/
+  
+  unsigned long header[2], iSorted, iField, nFields, nPoint_File, offset;
+  CSU2BinaryMesh::FileHandle restart_file;
+  vector<pair<unsigned long, unsigned long> > Sorted_Points;
+  
+  if (!CSU2BinaryMesh::OpenFile(val_filename, restart_file)) {
+    cout << "The restart file " << val_filename << " can not be opened." << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  CSU2BinaryMesh::ReadBlock(restart_file, val_filename, 8, header, 2*sizeof(unsigned long));
+  nFields = header[0]; nPoint_File = header[1];
+  
+  vector<char> Names(nFields*MAX_STRING_SIZE+1, '\0');
+  CSU2BinaryMesh::ReadBlock(restart_file, val_filename, 8+2*sizeof(unsigned long), &Names[0], nFields*MAX_STRING_SIZE);
+  Restart_Fields.clear();
+  for (iField = 0; iField < nFields; iField++)
+    Restart_Fields.push_back(string(&Names[iField*MAX_STRING_SIZE]));
+  offset = 8 + 2*sizeof(unsigned long) + nFields*MAX_STRING_SIZE;
+  
+  /*--- A file of another mesh is not read ---*/
+  
+  if (nPoint_File != geometry->GetGlobal_nPointDomain()) {
+    CSU2BinaryMesh::CloseFile(restart_file);
+    return 0;
+  }
+  
+  Sort_GlobalIndex(geometry, Sorted_Points);
+  
+  vector<passivedouble> Buffer(Sorted_Points.size()*nFields);
+  
+#ifdef HAVE_MPI
+  
+  /*--- Every rank reads its own rows, in increasing order of global index,
+   through a file view made of one block per point (byte displacements, the
+   global index of large meshes does not fit in an int). ---*/
+  
+  MPI_Datatype rowtype, filetype;
+  vector<MPI_Aint> Displ(Sorted_Points.size());
+  for (iSorted = 0; iSorted < Sorted_Points.size(); iSorted++)
+    Displ[iSorted] = (MPI_Aint)(Sorted_Points[iSorted].first*nFields*sizeof(passivedouble));
+  
+  MPI_Type_contiguous(nFields, MPI_DOUBLE, &rowtype);
+  MPI_Type_create_hindexed_block(Displ.size(), 1, Displ.data(), rowtype, &filetype);
+  MPI_Type_commit(&filetype);
+  
+  char native[] = "native";
+  MPI_File_set_view(restart_file, (MPI_Offset)offset, MPI_DOUBLE, filetype, native, MPI_INFO_NULL);
+  MPI_Status status;
+  int nValues_Read = 0;
+  if (MPI_File_read_all(restart_file, Buffer.data(), Buffer.size(), MPI_DOUBLE, &status) == MPI_SUCCESS)
+    MPI_Get_count(&status, MPI_DOUBLE, &nValues_Read);
+  if ((unsigned long)nValues_Read != Buffer.size()) {
+    cout << "The binary file " << val_filename << " is truncated or can not be read." << endl;
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+  }
+  
+  MPI_Type_free(&filetype);
+  MPI_Type_free(&rowtype);
+  
+#else
+  
+  /*--- All the points are local, the file is read at once ---*/
+  
+  vector<passivedouble> File_Data(nPoint_File*nFields);
+  CSU2BinaryMesh::ReadBlock(restart_file, val_filename, offset, File_Data.data(), File_Data.size()*sizeof(passivedouble));
+  for (iSorted = 0; iSorted < Sorted_Points.size(); iSorted++)
+    for (iField = 0; iField < nFields; iField++)
+      Buffer[iSorted*nFields+iField] = File_Data[Sorted_Points[iSorted].first*nFields+iField];
+  
+#endif
+  
+  CSU2BinaryMesh::CloseFile(restart_file);
+  
+  /*--- Store the values in local order ---*/
+  
+  Restart_Data.resize(Buffer.size());
+  for (iSorted = 0; iSorted < Sorted_Points.size(); iSorted++)
+    for (iField = 0; iField < nFields; iField++)
+      Restart_Data[Sorted_Points[iSorted].second*nFields+iField] = Buffer[iSorted*nFields+iField];
+  
+  return Sorted_Points.size();
+  
+}
+
+void CSolver::Decompress_Block(const unsigned char *Stream, unsigned long nRows, unsigned long nFields,
+                               const vector<passivedouble> &Tolerance, passivedouble *Rows) {
+  
+  unsigned long iRow, iField, Bits, Code;
+  unsigned short iByte, nZero, Shift;
+  long Quant;
+  bool Quantized;
+  
+  /*--- Inverse of COutput::Compress_Block, one stream per field ---*/
+  
+  for (iField = 0; iField < nFields; iField++) {
+    
+    Quantized = (*(Stream++) != 0);
+    
+    if (Quantized) {
+      Quant = 0;
+      for (iRow = 0; iRow < nRows; iRow++) {
+        Code = 0; Shift = 0;
+        while (*Stream & 0x80) { Code |= (unsigned long)(*(Stream++) & 0x7F) << Shift; Shift += 7; }
+        Code |= (unsigned long)(*(Stream++)) << Shift;
+        Quant += (long)(Code >> 1) ^ -(long)(Code & 1);
+        Rows[iRow*nFields+iField] = Quant*2.0*Tolerance[iField];
+      }
+    }
+    else {
+      Bits = 0;
+      for (iRow = 0; iRow < nRows; iRow++) {
+        nZero = *(Stream++);
+        Code = 0;
+        for (iByte = 0; iByte < 8-nZero; iByte++) Code |= (unsigned long)(*(Stream++)) << (8*iByte);
+        Bits ^= Code;
+        memcpy(&Rows[iRow*nFields+iField], &Bits, sizeof(unsigned long));
+      }
+    }
+    
+  }
+  
+}
+
+unsigned long CSolver::Read_Restart_Compressed(CGeometry *geometry, CConfig *config, string val_filename) {
+  
+  /*--- Layout of the file: the tag, the number of fields, of points and of blocks, the names of
+   the fields (MAX_STRING_SIZE characters each), the tolerances of the fields, the table of the
+   blocks (first global index, number of points, byte offset and byte size) and the blocks. ---*/
+  
+  unsigned long header[3], iSorted, iField, nFields, nPoint_File, iBlock, nBlock, offset;
+  int rank = MASTER_NODE, size = SINGLE_NODE;
+  CSU2BinaryMesh::FileHandle restart_file;
+  vector<pair<unsigned long, unsigned long> > Sorted_Points;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  if (!CSU2BinaryMesh::OpenFile(val_filename, restart_file)) {
+    cout << "The restart file " << val_filename << " can not be opened." << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  CSU2BinaryMesh::ReadBlock(restart_file, val_filename, 8, header, 3*sizeof(unsigned long));
+  nFields = header[0]; nPoint_File = header[1]; nBlock = header[2];
+  offset = 8 + 3*sizeof(unsigned long);
+  
+  vector<char> Names(nFields*MAX_STRING_SIZE+1, '\0');
+  CSU2BinaryMesh::ReadBlock(restart_file, val_filename, offset, &Names[0], nFields*MAX_STRING_SIZE);
+  Restart_Fields.clear();
+  for (iField = 0; iField < nFields; iField++)
+    Restart_Fields.push_back(string(&Names[iField*MAX_STRING_SIZE]));
+  offset += nFields*MAX_STRING_SIZE;
+  
+  vector<passivedouble> Tolerance(nFields);
+  vector<unsigned long> Table(4*nBlock), Block_Begin(nBlock);
+  CSU2BinaryMesh::ReadBlock(restart_file, val_filename, offset, Tolerance.data(), nFields*sizeof(passivedouble));
+  offset += nFields*sizeof(passivedouble);
+  CSU2BinaryMesh::ReadBlock(restart_file, val_filename, offset, Table.data(), Table.size()*sizeof(unsigned long));
+  for (iBlock = 0; iBlock < nBlock; iBlock++) Block_Begin[iBlock] = Table[4*iBlock];
+  
+  /*--- A file of another mesh is not read ---*/
+  
+  if (nPoint_File != geometry->GetGlobal_nPointDomain()) {
+    CSU2BinaryMesh::CloseFile(restart_file);
+    return 0;
+  }
+  
+  /*--- The blocks are distributed over the ranks (the file may have been written
+   with another number of ranks), every rank reads and decompresses its blocks ---*/
+  
+  vector<vector<passivedouble> > Block_Rows(nBlock);
+  vector<unsigned char> Stream;
+  
+  for (iBlock = rank; iBlock < nBlock; iBlock += size) {
+    Stream.resize(Table[4*iBlock+3]+1);
+    CSU2BinaryMesh::ReadBlock(restart_file, val_filename, Table[4*iBlock+2], Stream.data(), Table[4*iBlock+3]);
+    Block_Rows[iBlock].resize(Table[4*iBlock+1]*nFields);
+    Decompress_Block(Stream.data(), Table[4*iBlock+1], nFields, Tolerance, Block_Rows[iBlock].data());
+  }
+  
+  CSU2BinaryMesh::CloseFile(restart_file);
+  
+  Sort_GlobalIndex(geometry, Sorted_Points);
+  Restart_Data.resize(Sorted_Points.size()*nFields);
+  
+#ifdef HAVE_MPI
+  
+  /*--- The rows of the local points are requested from the ranks of their blocks ---*/
+  
+  int iProcessor;
+  unsigned long iRequest, Global_Index;
+  vector<vector<unsigned long> > Request_Send(size);
+  vector<int> Request_Rank(Sorted_Points.size());
+  
+  for (iSorted = 0; iSorted < Sorted_Points.size(); iSorted++) {
+    Global_Index = Sorted_Points[iSorted].first;
+    iBlock = upper_bound(Block_Begin.begin(), Block_Begin.end(), Global_Index) - Block_Begin.begin() - 1;
+    Request_Rank[iSorted] = iBlock % size;
+    Request_Send[iBlock % size].push_back(Global_Index);
+  }
+  
+  unsigned long *nSend = new unsigned long[size], *nRecv = new unsigned long[size];
+  unsigned long *Send_Offset = new unsigned long[size+1], *Recv_Offset = new unsigned long[size+1];
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    nSend[iProcessor] = Request_Send[iProcessor].size();
+  
+  MPI_Alltoall(nSend, 1, MPI_UNSIGNED_LONG, nRecv, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  
+  Send_Offset[0] = 0; Recv_Offset[0] = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    Send_Offset[iProcessor+1] = Send_Offset[iProcessor] + nSend[iProcessor];
+    Recv_Offset[iProcessor+1] = Recv_Offset[iProcessor] + nRecv[iProcessor];
+  }
+  vector<unsigned long> Request_Recv(Recv_Offset[size]);
+  
+  MPI_Request *Request = new MPI_Request[2*size];
+  MPI_Status *Status = new MPI_Status[2*size];
+  int nRequest = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (nRecv[iProcessor] > 0)
+      SU2_MPI::Irecv(&Request_Recv[Recv_Offset[iProcessor]], nRecv[iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, 0, MPI_COMM_WORLD, &Request[nRequest++]);
+    if (nSend[iProcessor] > 0)
+      SU2_MPI::Isend(&Request_Send[iProcessor][0], nSend[iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, 0, MPI_COMM_WORLD, &Request[nRequest++]);
+  }
+  SU2_MPI::Waitall(nRequest, Request, Status);
+  
+  /*--- Rows of the requested points, sent back in the order of the requests ---*/
+  
+  vector<passivedouble> Rows_Send(Request_Recv.size()*nFields), Rows_Recv(Send_Offset[size]*nFields);
+  for (iRequest = 0; iRequest < Request_Recv.size(); iRequest++) {
+    Global_Index = Request_Recv[iRequest];
+    iBlock = upper_bound(Block_Begin.begin(), Block_Begin.end(), Global_Index) - Block_Begin.begin() - 1;
+    copy(&Block_Rows[iBlock][(Global_Index-Block_Begin[iBlock])*nFields],
+         &Block_Rows[iBlock][(Global_Index-Block_Begin[iBlock]+1)*nFields], &Rows_Send[iRequest*nFields]);
+  }
+  
+  nRequest = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (nSend[iProcessor] > 0)
+      SU2_MPI::Irecv(&Rows_Recv[Send_Offset[iProcessor]*nFields], nSend[iProcessor]*nFields, MPI_DOUBLE,
+                     iProcessor, 1, MPI_COMM_WORLD, &Request[nRequest++]);
+    if (nRecv[iProcessor] > 0)
+      SU2_MPI::Isend(&Rows_Send[Recv_Offset[iProcessor]*nFields], nRecv[iProcessor]*nFields, MPI_DOUBLE,
+                     iProcessor, 1, MPI_COMM_WORLD, &Request[nRequest++]);
+  }
+  SU2_MPI::Waitall(nRequest, Request, Status);
+  
+  /*--- Store the values in local order, the answers of a rank are in sorted order ---*/
+  
+  for (iSorted = 0; iSorted < Sorted_Points.size(); iSorted++) {
+    iProcessor = Request_Rank[iSorted];
+    copy(&Rows_Recv[Send_Offset[iProcessor]*nFields], &Rows_Recv[(Send_Offset[iProcessor]+1)*nFields],
+         &Restart_Data[Sorted_Points[iSorted].second*nFields]);
+    Send_Offset[iProcessor]++;
+  }
+  
+  delete [] nSend; delete [] nRecv; delete [] Send_Offset; delete [] Recv_Offset;
+  delete [] Request; delete [] Status;
+  
+#else
+  
+  /*--- All the blocks are local ---*/
+  
+  for (iSorted = 0; iSorted < Sorted_Points.size(); iSorted++) {
+    unsigned long Global_Index = Sorted_Points[iSorted].first;
+    iBlock = upper_bound(Block_Begin.begin(), Block_Begin.end(), Global_Index) - Block_Begin.begin() - 1;
+    copy(&Block_Rows[iBlock][(Global_Index-Block_Begin[iBlock])*nFields],
+         &Block_Rows[iBlock][(Global_Index-Block_Begin[iBlock]+1)*nFields],
+         &Restart_Data[Sorted_Points[iSorted].second*nFields]);
+  }
+  
+#endif
+  
+  return Sorted_Points.size();
+  
+}
+
+void CSolver::SetContiguous_Storage(void) {
+  
+  unsigned long iPoint;
+  
+  if ((Variable_Storage != NULL) || (node == NULL)) return;
+  
+  /*--- One array per field, the blocks of the points are not padded ---*/
+  
+  Variable_Storage = new CVariableStorage(nPoint, 1);
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetContiguous_Storage(Variable_Storage, iPoint);
+  
+}
+
 void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
   unsigned short iVar;
   
@@ -612,6 +1366,8 @@ void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
 }
 
 void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_GRADIENT);
   unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
   unsigned short iVar, iDim, iMarker;
   su2double *Solution_Vertex, *Solution_i, *Solution_j, Solution_Average, **Gradient, DualArea,
@@ -623,12 +1379,12 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
   
   /*--- Loop interior edges ---*/
   for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    iPoint = geometry->GetEdge_Nodes(iEdge)[0];
+    jPoint = geometry->GetEdge_Nodes(iEdge)[1];
     
     Solution_i = node[iPoint]->GetSolution();
     Solution_j = node[jPoint]->GetSolution();
-    Normal = geometry->edge[iEdge]->GetNormal();
+    Normal = geometry->GetEdge_Normal(iEdge);
     for (iVar = 0; iVar< nVar; iVar++) {
       Solution_Average =  0.5 * (Solution_i[iVar] + Solution_j[iVar]);
       for (iDim = 0; iDim < nDim; iDim++) {
@@ -661,7 +1417,7 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
     for (iVar = 0; iVar < nVar; iVar++)
       for (iDim = 0; iDim < nDim; iDim++) {
         Gradient = node[iPoint]->GetGradient();
-        DualArea = geometry->node[iPoint]->GetVolume();
+        DualArea = geometry->GetPoint_Volume(iPoint);
         Grad_Val = Gradient[iVar][iDim] / (DualArea+EPS);
         node[iPoint]->SetGradient(iVar, iDim, Grad_Val);
       }
@@ -669,12 +1425,16 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
   /*--- Gradient MPI ---*/
   Set_MPI_Solution_Gradient(geometry, config);
   
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
   
-  unsigned short iDim, jDim, iVar, iNeigh;
-  unsigned long iPoint, jPoint;
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_GRADIENT);
+  
+  unsigned short iDim, jDim, iVar;
+  unsigned long iPoint, jPoint, iNeigh;
   su2double *Coord_i, *Coord_j, *Solution_i, *Solution_j,
   r11, r12, r13, r22, r23, r23_a, r23_b, r33, weight, detR2, z11, z12, z13,
   z22, z23, z33, product;
@@ -693,7 +1453,7 @@ void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
     
     /*--- Get coordinates ---*/
     
-    Coord_i = geometry->node[iPoint]->GetCoord();
+    Coord_i = geometry->GetPoint_Coord(iPoint);
     
     /*--- Get consevative solution ---*/
     
@@ -708,9 +1468,9 @@ void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
     r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
     r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
     
-    for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
-      jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-      Coord_j = geometry->node[jPoint]->GetCoord();
+    for (iNeigh = geometry->GetPoint_Neighbor_Ptr(iPoint); iNeigh < geometry->GetPoint_Neighbor_Ptr(iPoint+1); iNeigh++) {
+      jPoint = geometry->GetPoint_Neighbor(iNeigh);
+      Coord_j = geometry->GetPoint_Coord(jPoint);
       
       Solution_j = node[jPoint]->GetSolution();
       
@@ -814,6 +1574,8 @@ void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
   
   Set_MPI_Solution_Gradient(geometry, config);
   
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CSolver::SetGridVel_Gradient(CGeometry *geometry, CConfig *config) {
@@ -1044,6 +1806,8 @@ void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
 
 void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
   
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_LIMITER);
+  
   unsigned long iEdge, iPoint, jPoint;
   unsigned short iVar, iDim;
   su2double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j, *Solution_i, *Solution_j,
@@ -1064,8 +1828,8 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
     
     /*--- Point identification, Normal vector and area ---*/
     
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    iPoint = geometry->GetEdge_Nodes(iEdge)[0];
+    jPoint = geometry->GetEdge_Nodes(iEdge)[1];
     
     /*--- Get the conserved variables ---*/
     
@@ -1105,12 +1869,12 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
     
     for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
       
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
+      iPoint     = geometry->GetEdge_Nodes(iEdge)[0];
+      jPoint     = geometry->GetEdge_Nodes(iEdge)[1];
       Gradient_i = node[iPoint]->GetGradient();
       Gradient_j = node[jPoint]->GetGradient();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
+      Coord_i    = geometry->GetPoint_Coord(iPoint);
+      Coord_j    = geometry->GetPoint_Coord(jPoint);
       
       for (iVar = 0; iVar < nVar; iVar++) {
         
@@ -1160,12 +1924,12 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
     
     for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
       
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
+      iPoint     = geometry->GetEdge_Nodes(iEdge)[0];
+      jPoint     = geometry->GetEdge_Nodes(iEdge)[1];
       Gradient_i = node[iPoint]->GetGradient();
       Gradient_j = node[jPoint]->GetGradient();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
+      Coord_i    = geometry->GetPoint_Coord(iPoint);
+      Coord_j    = geometry->GetPoint_Coord(jPoint);
       
       for (iVar = 0; iVar < nVar; iVar++) {
         
@@ -1232,12 +1996,12 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
     
     for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
       
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
+      iPoint     = geometry->GetEdge_Nodes(iEdge)[0];
+      jPoint     = geometry->GetEdge_Nodes(iEdge)[1];
       Gradient_i = node[iPoint]->GetGradient();
       Gradient_j = node[jPoint]->GetGradient();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
+      Coord_i    = geometry->GetPoint_Coord(iPoint);
+      Coord_j    = geometry->GetPoint_Coord(jPoint);
       
       for (iVar = 0; iVar < nVar; iVar++) {
         
@@ -1296,6 +2060,8 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
   
   Set_MPI_Solution_Limiter(geometry, config);
   
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CSolver::SetPressureLaplacian(CGeometry *geometry, su2double *PressureLaplacian) {
@@ -1977,10 +2743,8 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 #endif
   
-  unsigned long iPoint, index, iPoint_Global;
-  long iPoint_Local;
+  unsigned long iPoint;
   unsigned short iField, iVar;
-  string Tag, text_line, AdjExt, UnstExt;
   unsigned long iExtIter = config->GetExtIter();
   bool fem = (config->GetKind_Solver() == FEM_ELASTICITY);
   
@@ -1998,7 +2762,6 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   
   /*--- Restart the solution from file information ---*/
   
-  ifstream restart_file;
   string filename;
   
   /*--- Retrieve filename from config ---*/
@@ -2025,85 +2788,29 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
 	filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
   }
   
-  /*--- Open the restart file ---*/
-  
-  restart_file.open(filename.data(), ios::in);
-  
-  /*--- In case there is no restart file ---*/
-  
-  if (restart_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "SU2 flow file " << filename << " not found" << endl;
-
-#ifndef HAVE_MPI
-    exit(EXIT_FAILURE);
-#else
-    MPI_Abort(MPI_COMM_WORLD,1);
-    MPI_Finalize();
-#endif
-    
-  }
-  
   /*--- Output the file name to the console. ---*/
   
   if (rank == MASTER_NODE)
     cout << "Reading and storing the solution from " << filename << "." << endl;
   
-  /*--- In case this is a parallel simulation, we need to perform the
-   Global2Local index transformation first. ---*/
-  
-  long *Global2Local = new long[geometry->GetGlobal_nPointDomain()];
-  
-  /*--- First, set all indices to a negative value by default ---*/
-  
-  for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++)
-    Global2Local[iPoint] = -1;
+  /*--- Read the restart file, ASCII or binary ---*/
   
-  /*--- Now fill array with the transform values only for local points ---*/
-  
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
-    Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-  
-  
-  /*--- Identify the number of fields (and names) in the restart file ---*/
-  
-  getline (restart_file, text_line);
-  stringstream ss(text_line);
-  while (ss >> Tag) {
-    config->fields.push_back(Tag);
-    if (ss.peek() == ',') ss.ignore();
-  }
+  Read_Restart_File(geometry, config, filename);
   
   /*--- Set the number of variables, one per field in the
    restart file (without including the PointID) ---*/
   
-  nVar = config->fields.size() - 1;
+  config->fields.push_back("\"PointID\"");
+  config->fields.insert(config->fields.end(), Restart_Fields.begin(), Restart_Fields.end());
+  nVar = Restart_Fields.size();
   su2double *Solution = new su2double[nVar];
   
-  /*--- Read all lines in the restart file ---*/
+  /*--- Store the solution (starting with node coordinates) --*/
   
-  iPoint_Global = 0;
-  while (getline (restart_file, text_line)) {
-    istringstream point_line(text_line);
-    
-    /*--- Retrieve local index. If this node from the restart file lives
-     on a different processor, the value of iPoint_Local will be -1.
-     Otherwise, the local index for this node on the current processor
-     will be returned and used to instantiate the vars. ---*/
-    
-    iPoint_Local = Global2Local[iPoint_Global];
-    if (iPoint_Local >= 0) {
-      
-      /*--- The PointID is not stored --*/
-      point_line >> index;
-      
-      /*--- Store the solution (starting with node coordinates) --*/
-      for (iField = 0; iField < nVar; iField++)
-        point_line >> Solution[iField];
-      
-      node[iPoint_Local] = new CBaselineVariable(Solution, nVar, config);
-    }
-    iPoint_Global++;
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    for (iField = 0; iField < nVar; iField++)
+      Solution[iField] = Restart_Data[iPoint*nVar+iField];
+    node[iPoint] = new CBaselineVariable(Solution, nVar, config);
   }
   
   /*--- Instantiate the variable class with an arbitrary solution
@@ -2116,13 +2823,7 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   for (iPoint = geometry->GetnPointDomain(); iPoint < geometry->GetnPoint(); iPoint++)
     node[iPoint] = new CBaselineVariable(Solution, nVar, config);
   
-  /*--- Close the restart file ---*/
-  
-  restart_file.close();
-  
-  /*--- Free memory needed for the transformation ---*/
-  
-  delete [] Global2Local;
+  Clear_Restart_Data();
   delete [] Solution;
   
   /*--- MPI solution ---*/
@@ -2132,6 +2833,8 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
 }
 
 void CBaselineSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short Previous_Phase = config->Start_Phase(PHASE_HALO);
   unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR, GridVel_Index;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   su2double rotMatrix[3][3], *transl, *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL, *Solution = NULL;
@@ -2319,6 +3022,8 @@ void CBaselineSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
   
   delete [] Solution;
   
+  config->Stop_Phase(Previous_Phase);
+  
 }
 
 void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *config, int val_iter) {
@@ -2330,9 +3035,7 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
   
   /*--- Restart the solution from file information ---*/
   string filename;
-  unsigned long iPoint, index;
-  string UnstExt, text_line, AdjExt;
-  ifstream solution_file;
+  unsigned long iPoint;
   unsigned short iField;
   unsigned long iExtIter = config->GetExtIter();
   bool fem = (config->GetKind_Solver() == FEM_ELASTICITY);
@@ -2362,75 +3065,26 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
 	filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
   }
 
-  /*--- Open the restart file ---*/
-  solution_file.open(filename.data(), ios::in);
-  
-  /*--- In case there is no file ---*/
-  if (solution_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no SU2 restart file!!" << endl;
-    exit(EXIT_FAILURE);
-  }
-  
   /*--- Output the file name to the console. ---*/
   if (rank == MASTER_NODE)
     cout << "Reading and storing the solution from " << filename
     << "." << endl;
   
-  /*--- Set the number of variables, one per field in the
-   restart file (without including the PointID) ---*/
+  /*--- Read the restart file, ASCII or binary. There is one variable per
+   field in the restart file (without including the PointID) ---*/
+  Read_Restart_File(geometry[ZONE_0], config, filename);
+  
   nVar = config->fields.size() - 1;
   su2double *Solution = new su2double[nVar];
   
-  /*--- In case this is a parallel simulation, we need to perform the
-   Global2Local index transformation first. ---*/
-  long *Global2Local = NULL;
-  Global2Local = new long[geometry[ZONE_0]->GetGlobal_nPointDomain()];
-  /*--- First, set all indices to a negative value by default ---*/
-  for (iPoint = 0; iPoint < geometry[ZONE_0]->GetGlobal_nPointDomain(); iPoint++) {
-    Global2Local[iPoint] = -1;
-  }
-  
-  /*--- Now fill array with the transform values only for local points ---*/
+  /*--- Store the solution (starting with node coordinates) --*/
   for (iPoint = 0; iPoint < geometry[ZONE_0]->GetnPointDomain(); iPoint++) {
-    Global2Local[geometry[ZONE_0]->node[iPoint]->GetGlobalIndex()] = iPoint;
-  }
-  
-  /*--- Read all lines in the restart file ---*/
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
-  
-  /*--- The first line is the header ---*/
-  getline (solution_file, text_line);
-  
-  while (getline (solution_file, text_line)) {
-    istringstream point_line(text_line);
-    
-    /*--- Retrieve local index. If this node from the restart file lives
-     on a different processor, the value of iPoint_Local will be -1, as
-     initialized above. Otherwise, the local index for this node on the
-     current processor will be returned and used to instantiate the vars. ---*/
-    iPoint_Local = Global2Local[iPoint_Global];
-    if (iPoint_Local >= 0) {
-      
-      /*--- The PointID is not stored --*/
-      point_line >> index;
-      
-      /*--- Store the solution (starting with node coordinates) --*/
-      for (iField = 0; iField < nVar; iField++)
-        point_line >> Solution[iField];
-      
-      node[iPoint_Local]->SetSolution(Solution);
-      
-      
-    }
-    iPoint_Global++;
+    for (iField = 0; iField < nVar; iField++)
+      Solution[iField] = Restart_Data[iPoint*Restart_Fields.size()+iField];
+    node[iPoint]->SetSolution(Solution);
   }
   
-  /*--- Close the restart file ---*/
-  solution_file.close();
-  
-  /*--- Free memory needed for the transformation ---*/
-  delete [] Global2Local;
+  Clear_Restart_Data();
   delete [] Solution;
   
 }
@@ -2444,9 +3098,7 @@ void CBaselineSolver::LoadRestart_FSI(CGeometry *geometry, CSolver ***solver, CC
 
   /*--- Restart the solution from file information ---*/
   string filename;
-  unsigned long iPoint, index;
-  string UnstExt, text_line, AdjExt;
-  ifstream solution_file;
+  unsigned long iPoint;
   unsigned short iField;
   unsigned long iExtIter = config->GetExtIter();
   bool fem = (config->GetKind_Solver() == FEM_ELASTICITY);
@@ -2476,76 +3128,26 @@ void CBaselineSolver::LoadRestart_FSI(CGeometry *geometry, CSolver ***solver, CC
 	filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
   }
 
-  /*--- Open the restart file ---*/
-  solution_file.open(filename.data(), ios::in);
-
-  /*--- In case there is no file ---*/
-  if (solution_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no SU2 restart file!!" << endl;
-    exit(EXIT_FAILURE);
-  }
-
   /*--- Output the file name to the console. ---*/
   if (rank == MASTER_NODE)
     cout << "Reading and storing the solution from " << filename
     << "." << endl;
-
-  /*--- Set the number of variables, one per field in the
-   restart file (without including the PointID) ---*/
+  
+  /*--- Read the restart file, ASCII or binary. There is one variable per
+   field in the restart file (without including the PointID) ---*/
+  Read_Restart_File(geometry, config, filename);
+  
   nVar = config->fields.size() - 1;
-
   su2double *Solution = new su2double[nVar];
-
-  /*--- In case this is a parallel simulation, we need to perform the
-   Global2Local index transformation first. ---*/
-  long *Global2Local = NULL;
-  Global2Local = new long[geometry->GetGlobal_nPointDomain()];
-  /*--- First, set all indices to a negative value by default ---*/
-  for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++) {
-    Global2Local[iPoint] = -1;
-  }
-
-  /*--- Now fill array with the transform values only for local points ---*/
+  
+  /*--- Store the solution (starting with node coordinates) --*/
   for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
-    Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-  }
-
-  /*--- Read all lines in the restart file ---*/
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
-
-  /*--- The first line is the header ---*/
-  getline (solution_file, text_line);
-
-  while (getline (solution_file, text_line)) {
-    istringstream point_line(text_line);
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on a different processor, the value of iPoint_Local will be -1, as
-     initialized above. Otherwise, the local index for this node on the
-     current processor will be returned and used to instantiate the vars. ---*/
-    iPoint_Local = Global2Local[iPoint_Global];
-    if (iPoint_Local >= 0) {
-
-      /*--- The PointID is not stored --*/
-      point_line >> index;
-
-      /*--- Store the solution (starting with node coordinates) --*/
-      for (iField = 0; iField < nVar; iField++)
-        point_line >> Solution[iField];
-
-      node[iPoint_Local]->SetSolution(Solution);
-
-
-    }
-    iPoint_Global++;
+    for (iField = 0; iField < nVar; iField++)
+      Solution[iField] = Restart_Data[iPoint*Restart_Fields.size()+iField];
+    node[iPoint]->SetSolution(Solution);
   }
-
-  /*--- Close the restart file ---*/
-  solution_file.close();
-
-  /*--- Free memory needed for the transformation ---*/
-  delete [] Global2Local;
+  
+  Clear_Restart_Data();
   delete [] Solution;
 
 }
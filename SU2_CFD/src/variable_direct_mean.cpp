@@ -402,12 +402,17 @@ CEulerVariable::~CEulerVariable(void) {
 	unsigned short iVar;
 
   if (TS_Source         != NULL) delete [] TS_Source;
+  if (WindGust          != NULL) delete [] WindGust;
+  if (WindGustDer       != NULL) delete [] WindGustDer;
+
+  /*--- Arrays moved into a CVariableStorage belong to the storage ---*/
+  
+  if (Contiguous) return;
+  
   if (Primitive         != NULL) delete [] Primitive;
   if (Secondary         != NULL) delete [] Secondary;
   if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
   if (Limiter_Secondary != NULL) delete [] Limiter_Secondary;
-  if (WindGust          != NULL) delete [] WindGust;
-  if (WindGustDer       != NULL) delete [] WindGustDer;
 
   if (Gradient_Primitive != NULL) {
     for (iVar = 0; iVar < nPrimVarGrad; iVar++)
@@ -424,6 +429,22 @@ CEulerVariable::~CEulerVariable(void) {
   
 }
 
+void CEulerVariable::SetContiguous_Storage(CVariableStorage *storage, unsigned long val_point) {
+  
+  CVariable::SetContiguous_Storage(storage, val_point);
+  
+  Solution_Max        = storage->MoveVector(CVariableStorage::SOLUTION_MAX,        val_point, Solution_Max,        nPrimVarGrad);
+  Solution_Min        = storage->MoveVector(CVariableStorage::SOLUTION_MIN,        val_point, Solution_Min,        nPrimVarGrad);
+  Undivided_Laplacian = storage->MoveVector(CVariableStorage::UNDIVIDED_LAPLACIAN, val_point, Undivided_Laplacian, nVar);
+  Primitive           = storage->MoveVector(CVariableStorage::PRIMITIVE,           val_point, Primitive,           nPrimVar);
+  Limiter_Primitive   = storage->MoveVector(CVariableStorage::LIMITER_PRIMITIVE,   val_point, Limiter_Primitive,   nPrimVarGrad);
+  Secondary           = storage->MoveVector(CVariableStorage::SECONDARY,           val_point, Secondary,           nSecondaryVar);
+  Limiter_Secondary   = storage->MoveVector(CVariableStorage::LIMITER_SECONDARY,   val_point, Limiter_Secondary,   nSecondaryVarGrad);
+  Gradient_Primitive  = storage->MoveMatrix(CVariableStorage::GRADIENT_PRIMITIVE,  val_point, Gradient_Primitive,  nPrimVarGrad, nDim);
+  Gradient_Secondary  = storage->MoveMatrix(CVariableStorage::GRADIENT_SECONDARY,  val_point, Gradient_Secondary,  nSecondaryVarGrad, nDim);
+  
+}
+
 void CEulerVariable::SetGradient_PrimitiveZero(unsigned short val_primvar) {
 	unsigned short iVar, iDim;
   
@@ -72,6 +72,15 @@ CTurbVariable::CTurbVariable(unsigned short val_nDim, unsigned short val_nvar, C
 
 CTurbVariable::~CTurbVariable(void) { }
 
+void CTurbVariable::SetContiguous_Storage(CVariableStorage *storage, unsigned long val_point) {
+  
+  CVariable::SetContiguous_Storage(storage, val_point);
+  
+  Solution_Max = storage->MoveVector(CVariableStorage::SOLUTION_MAX, val_point, Solution_Max, nVar);
+  Solution_Min = storage->MoveVector(CVariableStorage::SOLUTION_MIN, val_point, Solution_Min, nVar);
+  
+}
+
 su2double CTurbVariable::GetmuT() { return muT; }
 
 void CTurbVariable::SetmuT(su2double val_muT) { muT = val_muT; }
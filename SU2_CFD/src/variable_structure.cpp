@@ -52,6 +52,7 @@ CVariable::CVariable(void) {
   Residual_Old = NULL;
 	Residual_Sum = NULL;
 	Solution_Adj_Old = NULL;
+  Contiguous = false;
   
 }
 
@@ -74,6 +75,7 @@ CVariable::CVariable(unsigned short val_nvar, CConfig *config) {
   Residual_Old = NULL;
 	Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
+  Contiguous = false;
 
   /*--- Initialize the number of solution variables. This version
    of the constructor will be used primarily for converting the
@@ -110,6 +112,7 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
   Residual_Old = NULL;
 	Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
+  Contiguous = false;
 
 	/*--- Initializate the number of dimension and number of variables ---*/
 	nDim = val_nDim;
@@ -149,28 +152,152 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
 CVariable::~CVariable(void) {
 	unsigned short iVar;
 
-  if (Solution            != NULL) delete [] Solution;
-	if (Solution_Old        != NULL) delete [] Solution_Old;
-    if (Solution_Store        != NULL) delete [] Solution_Store;
-    if (Solution_Save        != NULL) delete [] Solution_Save;
-	if (Solution_time_n     != NULL) delete [] Solution_time_n;
-	if (Solution_time_n1    != NULL) delete [] Solution_time_n1;
-	if (Limiter             != NULL) delete [] Limiter;
-	if (Solution_Max        != NULL) delete [] Solution_Max;
-	if (Solution_Min        != NULL) delete [] Solution_Min;
+  /*--- Arrays moved into a CVariableStorage belong to the storage ---*/
+  
+  if (!Contiguous) {
+    if (Solution            != NULL) delete [] Solution;
+    if (Solution_Old        != NULL) delete [] Solution_Old;
+    if (Solution_Store      != NULL) delete [] Solution_Store;
+    if (Solution_Save       != NULL) delete [] Solution_Save;
+    if (Solution_time_n     != NULL) delete [] Solution_time_n;
+    if (Solution_time_n1    != NULL) delete [] Solution_time_n1;
+    if (Limiter             != NULL) delete [] Limiter;
+    if (Solution_Max        != NULL) delete [] Solution_Max;
+    if (Solution_Min        != NULL) delete [] Solution_Min;
+    if (Res_TruncError      != NULL) delete [] Res_TruncError;
+    if (Residual_Old        != NULL) delete [] Residual_Old;
+    if (Residual_Sum        != NULL) delete [] Residual_Sum;
+    
+    if (Gradient != NULL) {
+      for (iVar = 0; iVar < nVar; iVar++)
+        delete [] Gradient[iVar];
+      delete [] Gradient;
+    }
+  }
+  
 	if (Grad_AuxVar         != NULL) delete [] Grad_AuxVar;
 	//if (Undivided_Laplacian != NULL) delete [] Undivided_Laplacian; // Need to break pointer dependence btwn CNumerics and CVariable
-	if (Res_TruncError      != NULL) delete [] Res_TruncError;
-	if (Residual_Old        != NULL) delete [] Residual_Old;
-	if (Residual_Sum        != NULL) delete [] Residual_Sum;
   if (Solution_Adj_Old    != NULL) delete [] Solution_Adj_Old;
 
-  if (Gradient != NULL) {
-    for (iVar = 0; iVar < nVar; iVar++)
-      delete [] Gradient[iVar];
-    delete [] Gradient;
+}
+
+void CVariable::SetContiguous_Storage(CVariableStorage *storage, unsigned long val_point) {
+  
+  /*--- Arrays of size nVar common to all the variables, the derived
+   classes move the arrays whose size depends on the problem ---*/
+  
+  Solution         = storage->MoveVector(CVariableStorage::SOLUTION,         val_point, Solution,         nVar);
+  Solution_Old     = storage->MoveVector(CVariableStorage::SOLUTION_OLD,     val_point, Solution_Old,     nVar);
+  Solution_Store   = storage->MoveVector(CVariableStorage::SOLUTION_STORE,   val_point, Solution_Store,   nVar);
+  Solution_Save    = storage->MoveVector(CVariableStorage::SOLUTION_SAVE,    val_point, Solution_Save,    nVar);
+  Solution_time_n  = storage->MoveVector(CVariableStorage::SOLUTION_TIME_N,  val_point, Solution_time_n,  nVar);
+  Solution_time_n1 = storage->MoveVector(CVariableStorage::SOLUTION_TIME_N1, val_point, Solution_time_n1, nVar);
+  Limiter          = storage->MoveVector(CVariableStorage::LIMITER,          val_point, Limiter,          nVar);
+  Res_TruncError   = storage->MoveVector(CVariableStorage::RES_TRUNC_ERROR,  val_point, Res_TruncError,   nVar);
+  Residual_Old     = storage->MoveVector(CVariableStorage::RESIDUAL_OLD,     val_point, Residual_Old,     nVar);
+  Residual_Sum     = storage->MoveVector(CVariableStorage::RESIDUAL_SUM,     val_point, Residual_Sum,     nVar);
+  Gradient         = storage->MoveMatrix(CVariableStorage::GRADIENT,         val_point, Gradient,         nVar, nDim);
+  
+  Contiguous = true;
+  
+}
+
+CVariableStorage::CVariableStorage(unsigned long val_npoint, unsigned short val_npad) {
+  
+  unsigned short iField;
+  
+  nPoint = val_npoint;
+  nPad   = max(val_npad, (unsigned short)1);
+  
+  for (iField = 0; iField < N_VAR_FIELD; iField++) {
+    Field[iField]  = NULL;
+    Row[iField]    = NULL;
+    Size[iField]   = 0;
+    Stride[iField] = 0;
+    nRow[iField]   = 0;
+  }
+  
+}
+
+CVariableStorage::~CVariableStorage(void) {
+  
+  unsigned short iField;
+  
+  for (iField = 0; iField < N_VAR_FIELD; iField++) {
+    if (Field[iField] != NULL) delete [] Field[iField];
+    if (Row[iField]   != NULL) delete [] Row[iField];
+  }
+  
+}
+
+void CVariableStorage::Allocate(unsigned short val_field, unsigned long val_size, unsigned short val_nrow) {
+  
+  unsigned long iValue;
+  
+  if (Field[val_field] == NULL) {
+    Size[val_field]   = val_size;
+    Stride[val_field] = ((val_size+nPad-1)/nPad)*nPad;
+    nRow[val_field]   = val_nrow;
+    Field[val_field]  = new su2double[nPoint*Stride[val_field]];
+    for (iValue = 0; iValue < nPoint*Stride[val_field]; iValue++)
+      Field[val_field][iValue] = 0.0;
+    if (val_nrow > 0) Row[val_field] = new su2double*[nPoint*val_nrow];
+  }
+  
+  /*--- All the points of a solver must have the same layout ---*/
+  
+  if ((Size[val_field] != val_size) || (nRow[val_field] != val_nrow)) {
+    cout << "The variables of the points do not have the same size (field " << val_field << ")." << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
   }
+  
+}
 
+su2double *CVariableStorage::MoveVector(unsigned short val_field, unsigned long val_point, su2double *val_vector, unsigned short val_size) {
+  
+  unsigned short iVar;
+  su2double *Vector;
+  
+  if (val_vector == NULL) return NULL;
+  
+  Allocate(val_field, val_size, 0);
+  
+  Vector = &Field[val_field][val_point*Stride[val_field]];
+  for (iVar = 0; iVar < val_size; iVar++)
+    Vector[iVar] = val_vector[iVar];
+  
+  delete [] val_vector;
+  
+  return Vector;
+  
+}
+
+su2double **CVariableStorage::MoveMatrix(unsigned short val_field, unsigned long val_point, su2double **val_matrix,
+                                         unsigned short val_nrow, unsigned short val_ncol) {
+  
+  unsigned short iRow, iCol;
+  su2double **Matrix;
+  
+  if (val_matrix == NULL) return NULL;
+  
+  Allocate(val_field, val_nrow*val_ncol, val_nrow);
+  
+  Matrix = &Row[val_field][val_point*val_nrow];
+  for (iRow = 0; iRow < val_nrow; iRow++) {
+    Matrix[iRow] = &Field[val_field][val_point*Stride[val_field] + iRow*val_ncol];
+    for (iCol = 0; iCol < val_ncol; iCol++)
+      Matrix[iRow][iCol] = val_matrix[iRow][iCol];
+    delete [] val_matrix[iRow];
+  }
+  delete [] val_matrix;
+  
+  return Matrix;
+  
 }
 
 void CVariable::AddUnd_Lapl(su2double *val_und_lapl) {